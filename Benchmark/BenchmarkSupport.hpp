@@ -0,0 +1,320 @@
+#pragma once
+
+#include "../MainProgram/Support+Library/Support-Library.hpp"
+#include "../MainProgram/Support+Library/CPU_FeatureDispatch.hpp"
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#endif
+
+/*
+	Shared pieces of the benchmark executables: clocks, the repeat-until-stable measuring loop,
+	cache eviction, command line options and a small JSON writer for machine-readable results.
+	基准测试程序的公共部分: 计时器, 重复直到稳定的测量循环, 缓存驱逐, 命令行选项, 以及输出机器可读结果的小型 JSON 写入器。
+*/
+namespace Benchmark
+{
+	//Time stamp counter (reference cycles, not core cycles under frequency scaling); 0 on platforms without one
+	//时间戳计数器 (参考时钟周期, 变频时不等于核心周期); 不支持的平台返回0
+	inline std::uint64_t ReadCycleCounter()
+	{
+		#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+		return __rdtsc();
+		#elif defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+		return __builtin_ia32_rdtsc();
+		#else
+		return 0;
+		#endif
+	}
+
+	inline constexpr bool HasCycleCounter()
+	{
+		#if (defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))) || (defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)))
+		return true;
+		#else
+		return false;
+		#endif
+	}
+
+	//Keeps the compiler from discarding work whose result is only observable through Pointer
+	//阻止编译器删除只通过 Pointer 可观察到结果的计算
+	inline void DoNotOptimize(const void* Pointer)
+	{
+		#if defined(__GNUC__)
+		asm volatile("" : : "g"(Pointer) : "memory");
+		#else
+		static const void* volatile Sink = nullptr;
+		Sink = Pointer;
+		std::atomic_signal_fence(std::memory_order_seq_cst);
+		#endif
+	}
+
+	struct Measurement
+	{
+		std::uint64_t Iterations = 0;
+		double Seconds = 0.0;
+		std::uint64_t Cycles = 0;
+	};
+
+	/*
+		Runs Function once to warm up, then in doubling batches until the accumulated time reaches MinimumSeconds.
+		A single call that already takes longer than MinimumSeconds is measured once.
+		先运行一次预热, 然后以加倍的批次运行直到累计时间达到 MinimumSeconds; 单次调用已超过 MinimumSeconds 时只测一次。
+	*/
+	template<typename FunctionType>
+	Measurement MeasureRepeated(FunctionType&& Function, double MinimumSeconds)
+	{
+		Function();
+
+		Measurement Result;
+		std::uint64_t BatchSize = 1;
+		while (Result.Seconds < MinimumSeconds)
+		{
+			const auto StartTime = std::chrono::steady_clock::now();
+			const std::uint64_t StartCycles = ReadCycleCounter();
+			for (std::uint64_t Count = 0; Count < BatchSize; ++Count)
+				Function();
+			const std::uint64_t EndCycles = ReadCycleCounter();
+			const auto EndTime = std::chrono::steady_clock::now();
+
+			Result.Iterations += BatchSize;
+			Result.Seconds += std::chrono::duration<double>(EndTime - StartTime).count();
+			Result.Cycles += EndCycles - StartCycles;
+			BatchSize *= 2;
+		}
+		return Result;
+	}
+
+	//Reads and writes a buffer larger than the last level cache, so the next measurement starts from cold caches
+	//读写一块大于末级缓存的缓冲区, 使下一次测量从冷缓存开始
+	inline void EvictCaches()
+	{
+		static std::vector<std::uint8_t> EvictionBuffer(std::size_t(64) << 20);
+		for (std::size_t Index = 0; Index < EvictionBuffer.size(); Index += 64)
+			EvictionBuffer[Index] += 1;
+		DoNotOptimize(EvictionBuffer.data());
+	}
+
+	inline std::string CompilerName()
+	{
+		#if defined(__clang__)
+		return "clang " __clang_version__;
+		#elif defined(__GNUC__)
+		return "gcc " __VERSION__;
+		#elif defined(_MSC_VER)
+		return "msvc " + std::to_string(_MSC_FULL_VER);
+		#else
+		return "unknown";
+		#endif
+	}
+
+	//UTC time in ISO 8601, used to label result files
+	//ISO 8601 格式的 UTC 时间, 用于标记结果文件
+	inline std::string CurrentTimestamp()
+	{
+		const std::time_t Now = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
+		std::tm UniversalTime {};
+		#if defined(_MSC_VER)
+		gmtime_s(&UniversalTime, &Now);
+		#else
+		gmtime_r(&Now, &UniversalTime);
+		#endif
+		char Buffer[32] {};
+		std::strftime(Buffer, sizeof(Buffer), "%Y-%m-%dT%H:%M:%SZ", &UniversalTime);
+		return Buffer;
+	}
+
+	/*
+		Options shared by every benchmark executable:
+		--json <path>        write results as JSON ("-" writes to standard output)
+		--min-time <seconds> minimum measuring time of each data point (default 0.1)
+		--max-size <bytes>   largest message/buffer size to measure
+		--threads <count>    thread count of the all-core runs (default: hardware concurrency, 0 disables them)
+		--filter <text>      only run algorithms whose name contains text
+	*/
+	struct Options
+	{
+		std::string JsonPath;
+		double MinimumSeconds = 0.1;
+		std::size_t MaximumSize = 0;
+		unsigned ThreadCount = std::max(1U, std::thread::hardware_concurrency());
+		std::string Filter;
+
+		bool Selected(std::string_view Name) const
+		{
+			return Filter.empty() || Name.find(Filter) != std::string_view::npos;
+		}
+
+		//Returns false (after printing the usage) on an unknown or incomplete option
+		//遇到未知或不完整的选项时打印用法并返回 false
+		bool Parse(int ArgumentCount, char* ArgumentVector[], std::size_t DefaultMaximumSize)
+		{
+			MaximumSize = DefaultMaximumSize;
+			for (int Index = 1; Index < ArgumentCount; ++Index)
+			{
+				const std::string_view Argument = ArgumentVector[Index];
+				const bool HasValue = Index + 1 < ArgumentCount;
+
+				if (Argument == "--json" && HasValue)
+					JsonPath = ArgumentVector[++Index];
+				else if (Argument == "--min-time" && HasValue)
+					MinimumSeconds = std::strtod(ArgumentVector[++Index], nullptr);
+				else if (Argument == "--max-size" && HasValue)
+					MaximumSize = std::strtoull(ArgumentVector[++Index], nullptr, 10);
+				else if (Argument == "--threads" && HasValue)
+					ThreadCount = static_cast<unsigned>(std::strtoul(ArgumentVector[++Index], nullptr, 10));
+				else if (Argument == "--filter" && HasValue)
+					Filter = ArgumentVector[++Index];
+				else
+				{
+					std::cerr << "Usage: " << ArgumentVector[0]
+						<< " [--json <path|->] [--min-time <seconds>] [--max-size <bytes>] [--threads <count>] [--filter <text>]" << std::endl;
+					return false;
+				}
+			}
+			return true;
+		}
+	};
+
+	/*
+		Minimal streaming JSON writer; commas between members and elements are inserted automatically.
+		最小的流式 JSON 写入器, 成员和元素之间的逗号自动插入。
+	*/
+	class JsonWriter
+	{
+	private:
+
+		std::ostringstream Output;
+		//One entry per open object/array: true while no member or element has been written yet
+		//每个打开的对象/数组一项: 尚未写入任何成员或元素时为 true
+		std::vector<bool> IsFirstItem;
+		bool IsAfterKey = false;
+
+		void BeforeValue()
+		{
+			if (IsAfterKey)
+			{
+				IsAfterKey = false;
+				return;
+			}
+			if (!IsFirstItem.empty())
+			{
+				if (!IsFirstItem.back())
+					Output << ',';
+				IsFirstItem.back() = false;
+				Output << '\n' << std::string(IsFirstItem.size(), '\t');
+			}
+		}
+
+		void WriteString(std::string_view Text)
+		{
+			Output << '"';
+			for (const char Character : Text)
+			{
+				switch (Character)
+				{
+					case '"': Output << "\\\""; break;
+					case '\\': Output << "\\\\"; break;
+					case '\n': Output << "\\n"; break;
+					case '\t': Output << "\\t"; break;
+					default:
+						if (static_cast<unsigned char>(Character) < 0x20)
+							Output << "\\u" << std::hex << std::setw(4) << std::setfill('0') << static_cast<int>(Character) << std::dec;
+						else
+							Output << Character;
+				}
+			}
+			Output << '"';
+		}
+
+		void Close(char Bracket)
+		{
+			const bool IsEmpty = IsFirstItem.back();
+			IsFirstItem.pop_back();
+			if (!IsEmpty)
+				Output << '\n' << std::string(IsFirstItem.size(), '\t');
+			Output << Bracket;
+		}
+
+	public:
+
+		JsonWriter& BeginObject() { BeforeValue(); Output << '{'; IsFirstItem.push_back(true); return *this; }
+		JsonWriter& EndObject() { Close('}'); return *this; }
+		JsonWriter& BeginArray() { BeforeValue(); Output << '['; IsFirstItem.push_back(true); return *this; }
+		JsonWriter& EndArray() { Close(']'); return *this; }
+
+		JsonWriter& Key(std::string_view Name)
+		{
+			BeforeValue();
+			WriteString(Name);
+			Output << ": ";
+			IsAfterKey = true;
+			return *this;
+		}
+
+		JsonWriter& Value(std::string_view Text) { BeforeValue(); WriteString(Text); return *this; }
+		JsonWriter& Value(const char* Text) { return Value(std::string_view(Text)); }
+		JsonWriter& Value(bool Boolean) { BeforeValue(); Output << (Boolean ? "true" : "false"); return *this; }
+		JsonWriter& Null() { BeforeValue(); Output << "null"; return *this; }
+
+		template<typename NumberType>
+		requires std::is_arithmetic_v<NumberType>
+		JsonWriter& Value(NumberType Number)
+		{
+			BeforeValue();
+			if constexpr (std::is_floating_point_v<NumberType>)
+			{
+				if (!std::isfinite(Number))
+				{
+					Output << "null";
+					return *this;
+				}
+				Output << std::setprecision(6) << Number;
+			}
+			else
+				Output << Number;
+			return *this;
+		}
+
+		template<typename ValueType>
+		JsonWriter& Member(std::string_view Name, const ValueType& MemberValue)
+		{
+			return Key(Name).Value(MemberValue);
+		}
+
+		std::string String() const
+		{
+			return Output.str() + '\n';
+		}
+
+		//Writes the document to Path, or to standard output when Path is "-"; an empty Path writes nothing
+		//把文档写入 Path, Path 为 "-" 时写到标准输出; Path 为空时不写
+		bool Save(const std::string& Path) const
+		{
+			if (Path.empty())
+				return true;
+			if (Path == "-")
+			{
+				std::cout << String();
+				return true;
+			}
+			std::ofstream File(Path, std::ios::binary);
+			File << String();
+			return static_cast<bool>(File);
+		}
+	};
+
+	//Writes the fields every result document starts with
+	//写入每个结果文档开头的公共字段
+	inline void WriteEnvironment(JsonWriter& Writer, std::string_view BenchmarkName, const Options& RunOptions)
+	{
+		Writer.Member("benchmark", BenchmarkName)
+			.Member("schema_version", 1)
+			.Member("timestamp", CurrentTimestamp())
+			.Member("compiler", CompilerName())
+			.Member("hardware_threads", std::thread::hardware_concurrency())
+			.Member("cycle_counter", HasCycleCounter() ? "tsc" : "none")
+			.Member("cpu_features", CommonToolkit::CPU_FeatureDispatch::FeatureSetToString(CommonToolkit::CPU_FeatureDispatch::ActiveFeatures()))
+			.Member("min_time_seconds", RunOptions.MinimumSeconds);
+	}
+}
@@ -0,0 +1,576 @@
+#include "BenchmarkSupport.hpp"
+
+//namespace StreamDataCryption
+#include "../StreamDataCryption/StreamDataCryption.hpp"
+#include "../StreamDataCryption/ChinaShangYongMiMa/ZUC.hpp"
+#include "../StreamDataCryption/CipherAlgorithmSample.cpp"
+
+//namespace BlockDataCryption
+#include "../BlockDataCryption/BlockDataCryption.hpp"
+
+#include "../MainProgram/Support+Library/TitianWallCiphers.hpp"
+
+/*
+	Throughput benchmark of every cipher in the solution.
+	For each algorithm it reports the cold and warm key setup time, then cycles/byte and GB/s of encrypting a message in place,
+	for message sizes from 16 bytes to 64 megabytes, single-threaded and with one independent cipher object per thread on all cores.
+	A case stops before 64 megabytes once one pass of the next size would take much longer than the minimum measuring time.
+	Stream ciphers are measured as "generate keystream + XOR into the message" through their public interfaces,
+	so allocations made by those interfaces are part of the cost.
+	解决方案中所有密码算法的吞吐量基准测试。
+	对每个算法报告冷/热密钥设置时间, 然后报告就地加密 16 字节到 64 兆字节消息的 周期/字节 与 GB/s,
+	分为单线程和所有核心 (每个线程一个独立的密码对象) 两种情况。当下一个大小的单次处理远超最短测量时间时, 该算法在 64 兆字节之前停止。流密码通过公开接口测量 "生成密钥流 + 异或到消息",
+	因此这些接口内部的内存分配也计入成本。
+*/
+
+namespace Benchmark
+{
+	using MessageProcessor = std::function<void(std::span<std::uint8_t>)>;
+
+	struct CipherCase
+	{
+		using StageMeasurer = std::function<void(JsonWriter& Writer, double MinimumSeconds)>;
+
+		CipherCase(std::string Name, std::string Kind, std::size_t BlockByteSize, std::function<MessageProcessor()> CreateKeyed, StageMeasurer MeasureStages = {})
+			:
+			Name(std::move(Name)), Kind(std::move(Kind)), BlockByteSize(BlockByteSize), CreateKeyed(std::move(CreateKeyed)), MeasureStages(std::move(MeasureStages))
+		{
+		}
+
+		std::string Name;
+		std::string Kind;
+		//Message sizes must be a multiple of this (1 for stream ciphers)
+		//消息大小必须是它的倍数 (流密码为1)
+		std::size_t BlockByteSize = 1;
+		//Constructs and keys a new cipher object, returns the function encrypting a message in place with it
+		//构造并设置一个新的密码对象的密钥, 返回使用它就地加密消息的函数
+		std::function<MessageProcessor()> CreateKeyed;
+		//Optional: measures and reports the time of each internal stage, run after the throughput measurements
+		//可选: 测量并报告每个内部阶段的耗时, 在吞吐量测量之后运行
+		StageMeasurer MeasureStages;
+	};
+
+	inline constexpr std::array<std::uint8_t, 32> KeyBytes
+	{
+		0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E, 0x0F,
+		0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F
+	};
+
+	inline constexpr std::array<std::uint32_t, 4> KeyWords { 0x01234567, 0x89ABCDEF, 0xFEDCBA98, 0x76543210 };
+
+	inline void XorInto(std::span<std::uint8_t> Message, const std::uint8_t* KeyStream)
+	{
+		for (std::size_t Index = 0; Index < Message.size(); ++Index)
+			Message[Index] ^= KeyStream[Index];
+	}
+
+	/*
+		Runs whole batches with StageTimings until MinimumSeconds, then reports the time per batch of fill, pseudo-hadamard transform, shuffle (both passes) and substitute.
+		Every stage is timed on its own, so the clock reads make the sum somewhat larger than an untimed batch.
+		以 StageTimings 运行整批直到 MinimumSeconds, 然后报告每批中 填充, 伪哈达玛德变换, 洗牌 (两次) 与替换 的耗时。
+		每个阶段单独计时, 因此读取时钟使总和略大于不计时的一批。
+	*/
+	inline void MeasureStreamCipherBasedAESStages(JsonWriter& Writer, double MinimumSeconds)
+	{
+		using StreamDataCryption::AlgorithmSample::StreamCipherBasedAES;
+		using Nanoseconds = std::chrono::duration<double, std::nano>;
+
+		StreamCipherBasedAES Cipher(0x0123456789ABCDEFULL);
+		Cipher.GenerateBatch();
+
+		StreamCipherBasedAES::StageTimings Timings;
+		std::uint64_t BatchCount = 0;
+		const auto StartTime = std::chrono::steady_clock::now();
+		do
+		{
+			Cipher.GenerateBatch(&Timings);
+			++BatchCount;
+		}
+		while (std::chrono::duration<double>(std::chrono::steady_clock::now() - StartTime).count() < MinimumSeconds);
+
+		const std::array<std::pair<const char*, std::chrono::nanoseconds>, 4> Stages
+		{{
+			{ "fill", Timings.Fill },
+			{ "pseudo_hadamard", Timings.PseudoHadamard },
+			{ "shuffle", Timings.Shuffle },
+			{ "substitute", Timings.Substitute },
+		}};
+		double TotalNanoseconds = 0.0;
+		for (const auto& [StageName, StageTime] : Stages)
+			TotalNanoseconds += Nanoseconds(StageTime).count();
+
+		Writer.Key("stages").BeginObject().Member("batches", BatchCount);
+		for (const auto& [StageName, StageTime] : Stages)
+		{
+			const double NanosecondsPerBatch = Nanoseconds(StageTime).count() / static_cast<double>(BatchCount);
+			std::cout << std::left << std::setw(26) << "StreamCipherBasedAES" << std::right << "stage " << std::left << std::setw(16) << StageName << std::right
+				<< std::fixed << std::setprecision(1) << std::setw(12) << NanosecondsPerBatch << " ns/batch "
+				<< std::setw(6) << 100.0 * Nanoseconds(StageTime).count() / TotalNanoseconds << " %" << std::endl;
+			Writer.Member(std::string(StageName) + "_ns_per_batch", NanosecondsPerBatch);
+		}
+		Writer.EndObject();
+	}
+
+	template<typename RivestCipherType>
+	CipherCase MakeRivestCase(std::string Name)
+	{
+		return { std::move(Name), "stream", 1, []() -> MessageProcessor
+		{
+			auto Cipher = std::make_shared<RivestCipherType>();
+			Cipher->KeyScheduling(KeyBytes);
+			return [Cipher](std::span<std::uint8_t> Message)
+			{
+				const auto KeyStream = Cipher->GenerateKeyStream(Message.size());
+				XorInto(Message, KeyStream.data());
+			};
+		} };
+	}
+
+	template<typename DJBCipherType>
+	CipherCase MakeDJBCase(std::string Name)
+	{
+		return { std::move(Name), "stream", 1, []() -> MessageProcessor
+		{
+			std::array<std::uint8_t, 32> Keys = KeyBytes;
+			std::array<std::uint8_t, 8> NumberOnces {};
+			auto Cipher = std::make_shared<DJBCipherType>(Keys, NumberOnces);
+			return [Cipher](std::span<std::uint8_t> Message)
+			{
+				const auto KeyStream = Cipher->GenerateKeyStream(Message.size());
+				XorInto(Message, KeyStream.data());
+			};
+		} };
+	}
+
+	template<typename ISAACType>
+	CipherCase MakeISAACCase(std::string Name, bool IsPlusVersion)
+	{
+		return { std::move(Name), "stream", 1, [IsPlusVersion]() -> MessageProcessor
+		{
+			auto Cipher = std::make_shared<ISAACType>();
+			Cipher->IsPlusVersion = IsPlusVersion;
+			Cipher->Seed(std::string(KeyBytes.begin(), KeyBytes.end()), true);
+			return [Cipher](std::span<std::uint8_t> Message)
+			{
+				using WordType = decltype(Cipher->Generate());
+				std::size_t Index = 0;
+				for (; Index + sizeof(WordType) <= Message.size(); Index += sizeof(WordType))
+				{
+					const WordType Word = Cipher->Generate();
+					for (std::size_t ByteIndex = 0; ByteIndex < sizeof(WordType); ++ByteIndex)
+						Message[Index + ByteIndex] ^= static_cast<std::uint8_t>(Word >> (ByteIndex * 8));
+				}
+				if (Index < Message.size())
+				{
+					const WordType Word = Cipher->Generate();
+					for (std::size_t ByteIndex = 0; Index < Message.size(); ++Index, ++ByteIndex)
+						Message[Index] ^= static_cast<std::uint8_t>(Word >> (ByteIndex * 8));
+				}
+			};
+		} };
+	}
+
+	//Encrypts every 8-byte block of the message with Encrypt(uint32_t data[2], key)
+	//用 Encrypt(uint32_t data[2], key) 加密消息的每个8字节分组
+	template<typename EncryptFunctionType>
+	void EncryptBlocksOf8(std::span<std::uint8_t> Message, EncryptFunctionType&& Encrypt)
+	{
+		for (std::size_t Offset = 0; Offset < Message.size(); Offset += 8)
+		{
+			std::uint32_t Data[2];
+			std::memcpy(Data, Message.data() + Offset, 8);
+			Encrypt(Data, KeyWords.data());
+			std::memcpy(Message.data() + Offset, Data, 8);
+		}
+	}
+
+	inline std::vector<CipherCase> AllCipherCases()
+	{
+		using namespace StreamDataCryption;
+		using namespace BlockDataCryption::TinyEncryptionAlgorithmGroup;
+
+		std::vector<CipherCase> Cases;
+
+		Cases.push_back(MakeDJBCase<DJB::Salsa20>("Salsa20"));
+		Cases.push_back(MakeDJBCase<DJB::Chacha20>("Chacha20"));
+
+		Cases.push_back(MakeRivestCase<RC4::RivestCipher4>("RC4"));
+		Cases.push_back(MakeRivestCase<RC4::RivestCipher4A>("RC4A"));
+		Cases.push_back(MakeRivestCase<RC4::RivestCipher4_VMPC>("RC4-VMPC"));
+		Cases.push_back(MakeRivestCase<RC4::RivestCipher4Plus>("RC4+"));
+		Cases.push_back(MakeRivestCase<RC4::RivestCipher4_Spritz>("RC4-Spritz"));
+		Cases.push_back(MakeRivestCase<RC4::RivestCipher4Star>("RC4*"));
+
+		Cases.push_back(MakeISAACCase<ISAAC::ISAAC_32Bit>("ISAAC-32", false));
+		Cases.push_back(MakeISAACCase<ISAAC::ISAAC_32Bit>("ISAAC+-32", true));
+		Cases.push_back(MakeISAACCase<ISAAC::ISAAC_64Bit>("ISAAC-64", false));
+		Cases.push_back(MakeISAACCase<ISAAC::ISAAC_64Bit>("ISAAC+-64", true));
+
+		Cases.push_back({ "ZUC", "stream", 1, []() -> MessageProcessor
+		{
+			const std::vector<std::uint8_t> Key(KeyBytes.begin(), KeyBytes.begin() + 16);
+			const std::vector<std::uint8_t> InitialVector(16, 0);
+			auto Cipher = std::make_shared<ChinaShangYongMiMa::ZUC::ZUC>(Key, InitialVector);
+			return [Cipher](std::span<std::uint8_t> Message)
+			{
+				const auto Output = Cipher->AlgorithmEncrypt(std::vector<std::uint8_t>(Message.begin(), Message.end()));
+				std::ranges::copy(Output, Message.begin());
+			};
+		} });
+
+		Cases.push_back({ "StreamCipherBasedAES", "stream", 1, []() -> MessageProcessor
+		{
+			auto Cipher = std::make_shared<AlgorithmSample::StreamCipherBasedAES>(0x0123456789ABCDEFULL);
+			auto KeyStream = std::make_shared<std::vector<std::uint64_t>>();
+			return [Cipher, KeyStream](std::span<std::uint8_t> Message)
+			{
+				KeyStream->resize((Message.size() + 7) / 8);
+				Cipher->GenerateKeyStream(*KeyStream);
+				XorInto(Message, reinterpret_cast<const std::uint8_t*>(KeyStream->data()));
+			};
+		}, &MeasureStreamCipherBasedAESStages });
+
+		Cases.push_back({ "TitanWallStreamCipher", "stream", 1, []() -> MessageProcessor
+		{
+			auto Cipher = std::make_shared<TitanWallStreamCipher>(KeyBytes);
+			auto KeyStream = std::make_shared<std::vector<std::uint8_t>>();
+			return [Cipher, KeyStream](std::span<std::uint8_t> Message)
+			{
+				KeyStream->resize(Message.size());
+				(void)Cipher->GenerateKeyStream(*KeyStream);
+				XorInto(Message, KeyStream->data());
+			};
+		} });
+
+		Cases.push_back({ "TEA", "block", 8, []() -> MessageProcessor
+		{
+			auto Cipher = std::make_shared<TEA>();
+			return [Cipher](std::span<std::uint8_t> Message)
+			{
+				EncryptBlocksOf8(Message, [&Cipher](std::uint32_t Data[2], const std::uint32_t Key[4]) { Cipher->encrypt(Data, Key); });
+			};
+		} });
+
+		Cases.push_back({ "TEA-Unrolled", "block", 8, []() -> MessageProcessor
+		{
+			return [](std::span<std::uint8_t> Message) { EncryptBlocksOf8(Message, &TEAUnrolled<>::encrypt); };
+		} });
+
+		Cases.push_back({ "XTEA", "block", 8, []() -> MessageProcessor
+		{
+			auto Cipher = std::make_shared<XTEA>();
+			return [Cipher](std::span<std::uint8_t> Message)
+			{
+				EncryptBlocksOf8(Message, [&Cipher](std::uint32_t Data[2], const std::uint32_t Key[4]) { Cipher->encrypt(Data, Key); });
+			};
+		} });
+
+		Cases.push_back({ "XTEA-Unrolled", "block", 8, []() -> MessageProcessor
+		{
+			return [](std::span<std::uint8_t> Message) { EncryptBlocksOf8(Message, &XTEAUnrolled<>::encrypt); };
+		} });
+
+		//Multi-block ECB, dispatched to the widest SIMD kernel of this processor (APPLIED_CRYPTOGRAPHY_CPU_FEATURES selects another)
+		//多分组 ECB, 分派到本处理器最宽的 SIMD 内核 (可用 APPLIED_CRYPTOGRAPHY_CPU_FEATURES 选择其他内核)
+		Cases.push_back({ "XTEA-Blocks", "block", 8, []() -> MessageProcessor
+		{
+			auto Cipher = std::make_shared<XTEA>();
+			auto Words = std::make_shared<std::vector<std::uint32_t>>();
+			return [Cipher, Words](std::span<std::uint8_t> Message)
+			{
+				Words->resize(Message.size() / 4);
+				std::memcpy(Words->data(), Message.data(), Message.size());
+				Cipher->encryptBlocks(Words->data(), Words->size() / 2, KeyWords.data());
+				std::memcpy(Message.data(), Words->data(), Message.size());
+			};
+		} });
+
+		//XXTEA treats the whole message as one block of 32-bit words
+		//XXTEA 把整个消息当作一个由32位字组成的分组
+		Cases.push_back({ "XXTEA", "block", 8, []() -> MessageProcessor
+		{
+			auto Cipher = std::make_shared<XXTEA>();
+			auto Words = std::make_shared<std::vector<std::uint32_t>>();
+			return [Cipher, Words](std::span<std::uint8_t> Message)
+			{
+				Words->resize(Message.size() / 4);
+				std::memcpy(Words->data(), Message.data(), Message.size());
+				Cipher->encrypt(Words->data(), static_cast<int>(Words->size()), KeyWords.data());
+				std::memcpy(Message.data(), Words->data(), Message.size());
+			};
+		} });
+
+		Cases.push_back({ "XXTEA-LargeBuffer", "block", 8, []() -> MessageProcessor
+		{
+			auto Cipher = std::make_shared<XXTEA>();
+			auto Words = std::make_shared<std::vector<std::uint32_t>>();
+			return [Cipher, Words](std::span<std::uint8_t> Message)
+			{
+				Words->resize(Message.size() / 4);
+				std::memcpy(Words->data(), Message.data(), Message.size());
+				Cipher->encryptLargeBuffer(Words->data(), Words->size(), KeyWords.data());
+				std::memcpy(Message.data(), Words->data(), Message.size());
+			};
+		} });
+
+		Cases.push_back({ "TitanWallBlockCipher-ECB", "block", TitanWallBlockCipher::BlockByteSize, []() -> MessageProcessor
+		{
+			auto Cipher = std::make_shared<TitanWallBlockCipher>(KeyBytes);
+			return [Cipher](std::span<std::uint8_t> Message) { (void)Cipher->EncryptInPlace(Message); };
+		} });
+
+		//Counter mode accepts any length, the last partial block uses part of its keystream block
+		//计数器模式接受任意长度, 最后不完整的分组只使用其密钥流分组的一部分
+		Cases.push_back({ "TitanWallBlockCipher-CTR", "block", 1, []() -> MessageProcessor
+		{
+			auto Cipher = std::make_shared<TitanWallBlockCipher>(KeyBytes);
+			return [Cipher](std::span<std::uint8_t> Message)
+			{
+				constexpr std::array<std::uint32_t, 6> NumberOnce {};
+				(void)Cipher->CounterMode(Message, Message, NumberOnce);
+			};
+		} });
+
+		return Cases;
+	}
+
+	struct KeySetupResult
+	{
+		double ColdNanoseconds = 0.0;
+		double WarmNanoseconds = 0.0;
+	};
+
+	/*
+		Cold: the median of single key setups, each started right after evicting the caches.
+		Warm: the mean over repeated key setups in a loop; only construction and keying are timed, not destruction.
+		冷: 每次先驱逐缓存再做一次密钥设置, 取中位数; 热: 循环中重复密钥设置的平均值, 只计时构造和设置密钥, 不计析构。
+	*/
+	inline KeySetupResult MeasureKeySetup(const CipherCase& Case, double MinimumSeconds)
+	{
+		using Nanoseconds = std::chrono::duration<double, std::nano>;
+
+		KeySetupResult Result;
+
+		std::array<double, 9> ColdSamples {};
+		for (auto& Sample : ColdSamples)
+		{
+			EvictCaches();
+			const auto StartTime = std::chrono::steady_clock::now();
+			MessageProcessor Processor = Case.CreateKeyed();
+			Sample = Nanoseconds(std::chrono::steady_clock::now() - StartTime).count();
+		}
+		std::ranges::nth_element(ColdSamples, ColdSamples.begin() + ColdSamples.size() / 2);
+		Result.ColdNanoseconds = ColdSamples[ColdSamples.size() / 2];
+
+		MessageProcessor WarmUp = Case.CreateKeyed();
+		double TotalNanoseconds = 0.0;
+		std::uint64_t Count = 0;
+		while (TotalNanoseconds < MinimumSeconds * 1e9)
+		{
+			const auto StartTime = std::chrono::steady_clock::now();
+			MessageProcessor Processor = Case.CreateKeyed();
+			TotalNanoseconds += Nanoseconds(std::chrono::steady_clock::now() - StartTime).count();
+			++Count;
+		}
+		Result.WarmNanoseconds = TotalNanoseconds / static_cast<double>(Count);
+
+		return Result;
+	}
+
+	struct ThroughputResult
+	{
+		unsigned Threads = 1;
+		std::size_t MessageBytes = 0;
+		Measurement Measured;
+
+		double GigabytesPerSecond() const
+		{
+			return static_cast<double>(MessageBytes) * Threads * Measured.Iterations / Measured.Seconds / 1e9;
+		}
+
+		//Cycles spent per byte on each core; null (NaN) without a cycle counter
+		//每个核心上每字节花费的周期; 没有周期计数器时为 NaN
+		double CyclesPerByte() const
+		{
+			if (!HasCycleCounter())
+				return std::numeric_limits<double>::quiet_NaN();
+			return static_cast<double>(Measured.Cycles) / (static_cast<double>(MessageBytes) * Measured.Iterations);
+		}
+	};
+
+	inline ThroughputResult MeasureSingleThread(const CipherCase& Case, std::size_t MessageBytes, double MinimumSeconds)
+	{
+		MessageProcessor Processor = Case.CreateKeyed();
+		std::vector<std::uint8_t> Message(MessageBytes, 0x5A);
+
+		ThroughputResult Result;
+		Result.MessageBytes = MessageBytes;
+		Result.Measured = MeasureRepeated([&] { Processor(Message); }, MinimumSeconds);
+		DoNotOptimize(Message.data());
+		return Result;
+	}
+
+	/*
+		Every thread owns a keyed cipher object and a message, and runs Iterations encryptions once all threads are released together.
+		Iterations comes from the single-threaded run of the same size, so both take about the same time when scaling is perfect.
+		每个线程拥有一个已设置密钥的密码对象和一条消息, 所有线程同时开始后各自运行 Iterations 次加密。
+		Iterations 来自相同大小的单线程测量, 因此在完美扩展时两者耗时大致相同。
+	*/
+	inline ThroughputResult MeasureAllThreads(const CipherCase& Case, std::size_t MessageBytes, unsigned ThreadCount, std::uint64_t Iterations)
+	{
+		std::vector<MessageProcessor> Processors;
+		std::vector<std::vector<std::uint8_t>> Messages;
+		for (unsigned ThreadIndex = 0; ThreadIndex < ThreadCount; ++ThreadIndex)
+		{
+			Processors.push_back(Case.CreateKeyed());
+			Messages.emplace_back(MessageBytes, 0x5A);
+		}
+
+		std::atomic<bool> IsStarted { false };
+		std::atomic<unsigned> ReadyCount { 0 };
+		std::vector<std::thread> Workers;
+		for (unsigned ThreadIndex = 0; ThreadIndex < ThreadCount; ++ThreadIndex)
+		{
+			Workers.emplace_back([&, ThreadIndex]
+			{
+				Processors[ThreadIndex](Messages[ThreadIndex]);
+				ReadyCount.fetch_add(1);
+				while (!IsStarted.load(std::memory_order_acquire))
+					std::this_thread::yield();
+				for (std::uint64_t Count = 0; Count < Iterations; ++Count)
+					Processors[ThreadIndex](Messages[ThreadIndex]);
+				DoNotOptimize(Messages[ThreadIndex].data());
+			});
+		}
+
+		while (ReadyCount.load() < ThreadCount)
+			std::this_thread::yield();
+
+		const auto StartTime = std::chrono::steady_clock::now();
+		const std::uint64_t StartCycles = ReadCycleCounter();
+		IsStarted.store(true, std::memory_order_release);
+		for (auto& Worker : Workers)
+			Worker.join();
+		const std::uint64_t EndCycles = ReadCycleCounter();
+		const auto EndTime = std::chrono::steady_clock::now();
+
+		ThroughputResult Result;
+		Result.Threads = ThreadCount;
+		Result.MessageBytes = MessageBytes;
+		Result.Measured.Iterations = Iterations;
+		Result.Measured.Seconds = std::chrono::duration<double>(EndTime - StartTime).count();
+		Result.Measured.Cycles = EndCycles - StartCycles;
+		return Result;
+	}
+
+	inline void WriteThroughput(JsonWriter& Writer, const ThroughputResult& Result)
+	{
+		Writer.BeginObject()
+			.Member("threads", Result.Threads)
+			.Member("message_bytes", Result.MessageBytes)
+			.Member("iterations", Result.Measured.Iterations)
+			.Member("seconds", Result.Measured.Seconds)
+			.Member("gigabytes_per_second", Result.GigabytesPerSecond())
+			.Member("cycles_per_byte", Result.CyclesPerByte())
+			.EndObject();
+	}
+
+	inline void PrintThroughput(const std::string& Name, const ThroughputResult& Result)
+	{
+		std::cout << std::left << std::setw(26) << Name << std::right
+			<< std::setw(4) << Result.Threads << " threads "
+			<< std::setw(10) << Result.MessageBytes << " bytes "
+			<< std::fixed << std::setprecision(3) << std::setw(10) << Result.GigabytesPerSecond() << " GB/s "
+			<< std::setprecision(2) << std::setw(10) << Result.CyclesPerByte() << " cycles/byte" << std::endl;
+	}
+}
+
+auto main(int argument_cout, char* argument_vector[]) -> int
+{
+	using namespace Benchmark;
+
+	//16 bytes to 64 megabytes, in steps of 4x
+	//16 字节到 64 兆字节, 每次乘以4
+	constexpr std::size_t SmallestMessageBytes = 16;
+	constexpr std::size_t LargestMessageBytes = std::size_t(64) << 20;
+	//All-core runs skip sizes whose buffers together would exceed this
+	//所有核心测量时跳过缓冲区总和超过此值的大小
+	constexpr std::size_t AllThreadsMemoryLimit = std::size_t(1) << 30;
+	//A case stops growing the message once one pass of the next size is expected to take longer than this many minimum measuring times,
+	//so slow ciphers (TitanWallStreamCipher runs at kilobytes per second) do not keep a default run busy for hours; raise --min-time to measure them further
+	//当下一个大小的单次处理预计超过这么多个最短测量时间时, 该算法不再增大消息,
+	//使慢速密码 (TitanWallStreamCipher 每秒只处理几千字节) 不会让默认运行持续数小时; 要测量更大的消息可增大 --min-time
+	constexpr double PassSecondsBudget = 10.0;
+
+	Options RunOptions;
+	if (!RunOptions.Parse(argument_cout, argument_vector, LargestMessageBytes))
+		return 1;
+
+	JsonWriter Writer;
+	Writer.BeginObject();
+	WriteEnvironment(Writer, "cipher", RunOptions);
+	Writer.Key("results").BeginArray();
+
+	for (const CipherCase& Case : AllCipherCases())
+	{
+		if (!RunOptions.Selected(Case.Name))
+			continue;
+
+		const KeySetupResult KeySetup = MeasureKeySetup(Case, RunOptions.MinimumSeconds);
+		std::cout << std::left << std::setw(26) << Case.Name << std::right << "key setup: cold "
+			<< std::fixed << std::setprecision(1) << KeySetup.ColdNanoseconds << " ns, warm " << KeySetup.WarmNanoseconds << " ns" << std::endl;
+
+		Writer.BeginObject()
+			.Member("algorithm", Case.Name)
+			.Member("kind", Case.Kind)
+			.Member("block_bytes", Case.BlockByteSize);
+		Writer.Key("key_setup").BeginObject()
+			.Member("cold_ns", KeySetup.ColdNanoseconds)
+			.Member("warm_ns", KeySetup.WarmNanoseconds)
+			.EndObject();
+		Writer.Key("throughput").BeginArray();
+
+		for (std::size_t MessageBytes = SmallestMessageBytes; MessageBytes <= RunOptions.MaximumSize; MessageBytes *= 4)
+		{
+			if (MessageBytes % Case.BlockByteSize != 0)
+				continue;
+
+			const ThroughputResult SingleThread = MeasureSingleThread(Case, MessageBytes, RunOptions.MinimumSeconds);
+			PrintThroughput(Case.Name, SingleThread);
+			WriteThroughput(Writer, SingleThread);
+
+			if (RunOptions.ThreadCount > 1 && MessageBytes * RunOptions.ThreadCount <= AllThreadsMemoryLimit)
+			{
+				const ThroughputResult AllThreads = MeasureAllThreads(Case, MessageBytes, RunOptions.ThreadCount, SingleThread.Measured.Iterations);
+				PrintThroughput(Case.Name, AllThreads);
+				WriteThroughput(Writer, AllThreads);
+			}
+
+			//The next size is 4 times larger, so one pass of it takes about 4 times as long
+			//下一个大小是4倍, 因此其单次处理大约需要4倍时间
+			const double NextPassSeconds = 4.0 * SingleThread.Measured.Seconds / static_cast<double>(SingleThread.Measured.Iterations);
+			if (MessageBytes * 4 <= RunOptions.MaximumSize && NextPassSeconds > PassSecondsBudget * RunOptions.MinimumSeconds)
+			{
+				std::cout << std::left << std::setw(26) << Case.Name << std::right << "larger sizes skipped, one pass of " << MessageBytes * 4 << " bytes would take about "
+					<< std::fixed << std::setprecision(1) << NextPassSeconds << " s" << std::endl;
+				break;
+			}
+		}
+
+		Writer.EndArray();
+
+		if (Case.MeasureStages)
+			Case.MeasureStages(Writer, RunOptions.MinimumSeconds);
+
+		Writer.EndObject();
+	}
+
+	Writer.EndArray().EndObject();
+
+	if (!Writer.Save(RunOptions.JsonPath))
+	{
+		std::cerr << "Cannot write " << RunOptions.JsonPath << std::endl;
+		return 1;
+	}
+	return 0;
+}
@@ -0,0 +1,312 @@
+#include "BenchmarkSupport.hpp"
+
+//namespace RandomNumberGenerators
+#include "../RandomNumberGenerators/PseudoRandomNumberGenerators.hpp"
+
+/*
+	Speed comparison of every pseudo-random number generator in RandomNumberGenerators, with std::mt19937_64 as the reference.
+	For each generator it reports:
+	ns/value of single calls, bulk-fill GB/s (and cycles/byte) of writing a buffer of outputs, the cost of constructing and seeding
+	one object, and the size of the object's state.
+	Generators that have a fill(std::span<result_type>) member are bulk-filled through it, the others with a loop of single calls.
+	Some generators write to std::cout while generating; standard output is discarded while they are measured.
+	RandomNumberGenerators 中所有伪随机数生成器的速度比较, 以 std::mt19937_64 为参照。
+	对每个生成器报告: 单次调用的 纳秒/值, 批量填充缓冲区的 GB/s (以及 周期/字节), 构造并设置种子的成本, 以及对象状态的大小。
+	有 fill(std::span<result_type>) 成员的生成器通过它批量填充, 其它的用单次调用循环填充。
+	有些生成器在生成时会写 std::cout; 测量期间丢弃标准输出。
+*/
+
+namespace Benchmark
+{
+	struct GeneratorResult
+	{
+		std::string Name;
+		std::string Family;
+		unsigned OutputBits = 0;
+		std::size_t StateBytes = 0;
+		double SeedNanoseconds = 0.0;
+		double NanosecondsPerValue = 0.0;
+		Measurement Bulk;
+		std::size_t BulkBytes = 0;
+
+		double BulkGigabytesPerSecond() const
+		{
+			return static_cast<double>(BulkBytes) * Bulk.Iterations / Bulk.Seconds / 1e9;
+		}
+
+		double BulkCyclesPerByte() const
+		{
+			if (!HasCycleCounter())
+				return std::numeric_limits<double>::quiet_NaN();
+			return static_cast<double>(Bulk.Cycles) / (static_cast<double>(BulkBytes) * Bulk.Iterations);
+		}
+	};
+
+	//Discards everything written to it
+	//丢弃写入的所有内容
+	class NullStreamBuffer : public std::streambuf
+	{
+	protected:
+		int_type overflow(int_type Character) override { return traits_type::not_eof(Character); }
+		std::streamsize xsputn(const char*, std::streamsize Count) override { return Count; }
+	};
+
+	template<typename EngineType, typename ValueType>
+	concept BulkFillable = requires(EngineType& Engine, std::span<ValueType> Values)
+	{
+		Engine.fill(Values);
+	};
+
+	/*
+		Measures one generator. EngineType is constructed from SeedValue; Next(Engine&) returns one output of ValueType.
+		测量一个生成器。EngineType 由 SeedValue 构造; Next(Engine&) 返回一个 ValueType 类型的输出。
+	*/
+	template<typename EngineType, typename SeedType, typename NextFunctionType>
+	GeneratorResult MeasureGenerator(std::string Name, std::string Family, SeedType SeedValue, NextFunctionType&& Next, const Options& RunOptions)
+	{
+		using ValueType = std::invoke_result_t<NextFunctionType&, EngineType&>;
+		static_assert(std::is_unsigned_v<ValueType>);
+
+		NullStreamBuffer DiscardBuffer;
+		std::streambuf* const StandardOutputBuffer = std::cout.rdbuf(&DiscardBuffer);
+
+		GeneratorResult Result;
+		Result.Name = std::move(Name);
+		Result.Family = std::move(Family);
+		Result.OutputBits = std::numeric_limits<ValueType>::digits;
+		Result.StateBytes = sizeof(EngineType);
+
+		//Seeding: construct into reused storage, so only construction and seeding are timed
+		//设置种子: 在复用的存储中构造, 只计时构造和设置种子
+		{
+			std::optional<EngineType> Slot;
+			const Measurement Seeding = MeasureRepeated([&] { Slot.emplace(SeedValue); DoNotOptimize(&*Slot); }, RunOptions.MinimumSeconds);
+			Result.SeedNanoseconds = Seeding.Seconds * 1e9 / static_cast<double>(Seeding.Iterations);
+		}
+
+		auto Engine = std::make_unique<EngineType>(SeedValue);
+
+		//Single calls: every output is folded into an accumulator that escapes at the end
+		//单次调用: 每个输出都折叠进一个最后逃逸的累加器
+		{
+			constexpr std::size_t CallsPerBatch = 4096;
+			ValueType Accumulator = 0;
+			const Measurement Calls = MeasureRepeated([&]
+			{
+				for (std::size_t Count = 0; Count < CallsPerBatch; ++Count)
+					Accumulator ^= Next(*Engine);
+			}, RunOptions.MinimumSeconds);
+			DoNotOptimize(&Accumulator);
+			Result.NanosecondsPerValue = Calls.Seconds * 1e9 / (static_cast<double>(Calls.Iterations) * CallsPerBatch);
+		}
+
+		//Bulk fill of a buffer of RunOptions.MaximumSize bytes
+		//批量填充 RunOptions.MaximumSize 字节的缓冲区
+		{
+			std::vector<ValueType> Values(std::max<std::size_t>(1, RunOptions.MaximumSize / sizeof(ValueType)));
+			Result.BulkBytes = Values.size() * sizeof(ValueType);
+			Result.Bulk = MeasureRepeated([&]
+			{
+				if constexpr (BulkFillable<EngineType, ValueType>)
+					Engine->fill(std::span<ValueType>(Values));
+				else
+				{
+					for (auto& Value : Values)
+						Value = Next(*Engine);
+				}
+				DoNotOptimize(Values.data());
+			}, RunOptions.MinimumSeconds);
+		}
+
+		std::cout.rdbuf(StandardOutputBuffer);
+		return Result;
+	}
+
+	/*
+		Linear_Congruential and Nonlinear_InversiveCongruential are functions of (Seed, Iterations);
+		these adapters keep the last output as the next seed, so one call with Iterations = 1 produces one value.
+		Linear_Congruential 与 Nonlinear_InversiveCongruential 是 (Seed, Iterations) 的函数;
+		这些适配器把上一个输出作为下一个种子, 因此每次以 Iterations = 1 调用产生一个值。
+	*/
+	struct LinearCongruentialState
+	{
+		std::uint64_t Value;
+		explicit LinearCongruentialState(std::uint64_t Seed) : Value(Seed) {}
+	};
+
+	struct InversiveCongruentialState
+	{
+		std::uint64_t Value;
+		explicit InversiveCongruentialState(std::uint64_t Seed) : Value(Seed) {}
+	};
+
+	//Measures generators one after another and prints a line for each
+	//依次测量生成器并为每个打印一行
+	struct GeneratorRunner
+	{
+		const Options& RunOptions;
+		std::vector<GeneratorResult> Results;
+
+		template<typename EngineType, typename SeedType, typename NextFunctionType>
+		void Add(std::string Name, std::string Family, SeedType SeedValue, NextFunctionType&& Next)
+		{
+			if (!RunOptions.Selected(Name))
+				return;
+
+			Results.push_back(MeasureGenerator<EngineType>(std::move(Name), std::move(Family), SeedValue, Next, RunOptions));
+			const GeneratorResult& Result = Results.back();
+			std::cout << std::left << std::setw(32) << Result.Name << std::right << std::fixed
+				<< std::setprecision(2) << std::setw(10) << Result.NanosecondsPerValue << " ns/value "
+				<< std::setprecision(3) << std::setw(9) << Result.BulkGigabytesPerSecond() << " GB/s bulk "
+				<< std::setprecision(1) << std::setw(12) << Result.SeedNanoseconds << " ns seed "
+				<< std::setw(7) << Result.StateBytes << " bytes state" << std::endl;
+		}
+	};
+
+	inline std::vector<GeneratorResult> RunAllGenerators(const Options& RunOptions)
+	{
+		using namespace PseudoRandomNumberGenerators;
+		using namespace PseudoRandomNumberGenerators::Xorshift;
+
+		GeneratorRunner Runner { RunOptions, {} };
+
+		auto CallOperator = [](auto& Engine) { return Engine(); };
+		auto Call32Bit = [](auto& Engine) { return Engine.NumberGeneration32Bit(1); };
+		auto Call64Bit = [](auto& Engine) { return Engine.NumberGeneration64Bit(1); };
+
+		Runner.Add<std::mt19937_64>("std::mt19937_64", "reference", std::uint64_t(1), CallOperator);
+		Runner.Add<std::mt19937>("std::mt19937", "reference", std::uint32_t(1), CallOperator);
+
+		Runner.Add<MersenneTwister32Bit>("MersenneTwister32Bit", "mersenne-twister", std::uint32_t(1), [](auto& Engine) { return Engine.NumberGeneration(1); });
+		Runner.Add<MersenneTwister64Bit>("MersenneTwister64Bit", "mersenne-twister", std::uint64_t(1), [](auto& Engine) { return Engine.NumberGeneration(1); });
+		Runner.Add<MersenneTwister32BitBlock>("MersenneTwister32BitBlock", "mersenne-twister", std::uint32_t(1), CallOperator);
+		Runner.Add<MersenneTwister64BitBlock>("MersenneTwister64BitBlock", "mersenne-twister", std::uint64_t(1), CallOperator);
+
+		Runner.Add<ComplementaryMultiplyWithCarry>("CMWC-32", "multiply-with-carry", std::uint32_t(1), Call32Bit);
+		Runner.Add<ComplementaryMultiplyWithCarry>("CMWC-64", "multiply-with-carry", std::uint64_t(1), Call64Bit);
+		Runner.Add<ComplementaryMultiplyWithCarry32Bit4096>("CMWC4096-32", "multiply-with-carry", std::uint64_t(1), CallOperator);
+		Runner.Add<ComplementaryMultiplyWithCarry64Bit4096>("CMWC4096-64", "multiply-with-carry", std::uint64_t(1), CallOperator);
+		Runner.Add<LaneBufferedGenerator<cmwc4096x4>>("cmwc4096x4", "multiply-with-carry", std::uint64_t(1), CallOperator);
+		Runner.Add<LaneBufferedGenerator<cmwc4096x8>>("cmwc4096x8", "multiply-with-carry", std::uint64_t(1), CallOperator);
+
+		Runner.Add<BlumBlumShub>("BlumBlumShub", "blum-blum-shub", std::uint64_t(1), CallOperator);
+
+		Runner.Add<LinearCongruentialState>("Linear_Congruential", "congruential", std::uint64_t(1), [](auto& State)
+		{
+			return State.Value = Linear_Congruential(State.Value, 1);
+		});
+		Runner.Add<LinearCongruentialGenerator<LinearCongruentialModulus::TwoPower64>>("LinearCongruentialGenerator<2^64>", "congruential", std::uint64_t(1), CallOperator);
+		Runner.Add<LinearCongruentialGenerator<LinearCongruentialModulus::TwoPower64Minus1>>("LinearCongruentialGenerator<2^64-1>", "congruential", std::uint64_t(1), CallOperator);
+		Runner.Add<InversiveCongruentialState>("Nonlinear_InversiveCongruential", "congruential", std::uint64_t(1), [](auto& State)
+		{
+			return State.Value = static_cast<std::uint64_t>(Nonlinear_InversiveCongruential(State.Value, 1));
+		});
+		Runner.Add<InversiveCongruentialGenerator>("InversiveCongruentialGenerator", "congruential", std::uint64_t(1), CallOperator);
+		Runner.Add<InversiveCongruentialGeneratorBatch<16>>("InversiveCongruentialBatch<16>", "congruential", std::uint64_t(1), CallOperator);
+
+		Runner.Add<AdditionWithCarry<std::uint64_t, 11, 28>>("AWC<u64,11,28>", "lagged-fibonacci", std::uint64_t(1), CallOperator);
+		Runner.Add<SubtractWithBorrow<std::uint64_t, 5, 62>>("SWB<u64,5,62>", "lagged-fibonacci", std::uint64_t(1), CallOperator);
+		Runner.Add<SubtractWithCarry<std::uint64_t, 5, 62>>("SWC<u64,5,62>", "lagged-fibonacci", std::uint64_t(1), CallOperator);
+		Runner.Add<AdditionWithCarryBlock<std::uint64_t, 11, 28>>("AWCBlock<u64,11,28>", "lagged-fibonacci", std::uint64_t(1), CallOperator);
+		Runner.Add<SubtractWithBorrowBlock<std::uint64_t, 5, 62>>("SWBBlock<u64,5,62>", "lagged-fibonacci", std::uint64_t(1), CallOperator);
+		Runner.Add<SubtractWithCarryBlock<std::uint64_t, 5, 62>>("SWCBlock<u64,5,62>", "lagged-fibonacci", std::uint64_t(1), CallOperator);
+		Runner.Add<SubtractWithCarryBlock<std::uint32_t, 3, 17>>("SWCBlock<u32,3,17>", "lagged-fibonacci", std::uint64_t(1), CallOperator);
+
+		Runner.Add<xorshiro128>("xorshiro128", "xoshiro", std::uint64_t(1), CallOperator);
+		Runner.Add<xorshiro256>("xorshiro256", "xoshiro", std::uint64_t(1), CallOperator);
+		Runner.Add<xorshiro512>("xorshiro512", "xoshiro", std::uint64_t(1), CallOperator);
+		Runner.Add<xorshiro1024>("xorshiro1024", "xoshiro", std::uint64_t(1), CallOperator);
+		Runner.Add<LaneBufferedGenerator<xorshiro256x4>>("xorshiro256x4", "xoshiro", std::uint64_t(1), CallOperator);
+		Runner.Add<LaneBufferedGenerator<xorshiro256x8>>("xorshiro256x8", "xoshiro", std::uint64_t(1), CallOperator);
+		Runner.Add<LaneBufferedGenerator<xorshiro512x4>>("xorshiro512x4", "xoshiro", std::uint64_t(1), CallOperator);
+		Runner.Add<LaneBufferedGenerator<xorshiro512x8>>("xorshiro512x8", "xoshiro", std::uint64_t(1), CallOperator);
+
+		Runner.Add<XorShift32>("XorShift32", "xorshift", std::uint32_t(1), Call32Bit);
+		Runner.Add<XorShift32Plus>("XorShift32Plus", "xorshift", std::uint32_t(1), Call32Bit);
+		Runner.Add<XorShift32PlusPlus>("XorShift32PlusPlus", "xorshift", std::uint32_t(1), Call32Bit);
+		Runner.Add<XorShift32Star>("XorShift32Star", "xorshift", std::uint32_t(1), Call32Bit);
+		Runner.Add<XorShift32StarStar>("XorShift32StarStar", "xorshift", std::uint32_t(1), Call32Bit);
+		Runner.Add<XorShift64>("XorShift64", "xorshift", std::uint64_t(1), Call64Bit);
+		Runner.Add<XorShift64Plus>("XorShift64Plus", "xorshift", std::uint64_t(1), Call64Bit);
+		Runner.Add<XorShift64PlusPlus>("XorShift64PlusPlus", "xorshift", std::uint64_t(1), Call64Bit);
+		Runner.Add<XorShift64Star>("XorShift64Star", "xorshift", std::uint64_t(1), Call64Bit);
+		Runner.Add<XorShift64StarStar>("XorShift64StarStar", "xorshift", std::uint64_t(1), Call64Bit);
+		Runner.Add<XorShift128>("XorShift128", "xorshift", std::uint64_t(1), Call64Bit);
+		Runner.Add<XorShift128Star>("XorShift128Star", "xorshift", std::uint64_t(1), Call64Bit);
+		Runner.Add<XorShift256>("XorShift256", "xorshift", std::uint64_t(1), Call64Bit);
+		Runner.Add<XorShift256Star>("XorShift256Star", "xorshift", std::uint64_t(1), Call64Bit);
+		Runner.Add<XorShift512>("XorShift512", "xorshift", std::uint64_t(1), Call64Bit);
+		Runner.Add<XorShift512Star>("XorShift512Star", "xorshift", std::uint64_t(1), Call64Bit);
+		Runner.Add<XorShift1024>("XorShift1024", "xorshift", std::uint64_t(1), Call64Bit);
+		Runner.Add<XorShift1024Star>("XorShift1024Star", "xorshift", std::uint64_t(1), Call64Bit);
+
+		Runner.Add<xorshift32>("xorshift32", "xorshift", std::uint64_t(1), CallOperator);
+		Runner.Add<xorshift32plus>("xorshift32plus", "xorshift", std::uint64_t(1), CallOperator);
+		Runner.Add<xorshift32plusplus>("xorshift32plusplus", "xorshift", std::uint64_t(1), CallOperator);
+		Runner.Add<xorshift32star>("xorshift32star", "xorshift", std::uint64_t(1), CallOperator);
+		Runner.Add<xorshift32starstar>("xorshift32starstar", "xorshift", std::uint64_t(1), CallOperator);
+		Runner.Add<xorshift64>("xorshift64", "xorshift", std::uint64_t(1), CallOperator);
+		Runner.Add<xorshift64plus>("xorshift64plus", "xorshift", std::uint64_t(1), CallOperator);
+		Runner.Add<xorshift64plusplus>("xorshift64plusplus", "xorshift", std::uint64_t(1), CallOperator);
+		Runner.Add<xorshift64star>("xorshift64star", "xorshift", std::uint64_t(1), CallOperator);
+		Runner.Add<xorshift64starstar>("xorshift64starstar", "xorshift", std::uint64_t(1), CallOperator);
+		Runner.Add<xorshift128>("xorshift128", "xorshift", std::uint64_t(1), CallOperator);
+		Runner.Add<xorshift128star>("xorshift128star", "xorshift", std::uint64_t(1), CallOperator);
+		Runner.Add<xorshift256>("xorshift256", "xorshift", std::uint64_t(1), CallOperator);
+		Runner.Add<xorshift256star>("xorshift256star", "xorshift", std::uint64_t(1), CallOperator);
+		Runner.Add<xorshift512>("xorshift512", "xorshift", std::uint64_t(1), CallOperator);
+		Runner.Add<xorshift512star>("xorshift512star", "xorshift", std::uint64_t(1), CallOperator);
+		Runner.Add<xorshift1024>("xorshift1024", "xorshift", std::uint64_t(1), CallOperator);
+		Runner.Add<xorshift1024star>("xorshift1024star", "xorshift", std::uint64_t(1), CallOperator);
+
+		return std::move(Runner.Results);
+	}
+}
+
+auto main(int argument_cout, char* argument_vector[]) -> int
+{
+	using namespace Benchmark;
+
+	//Default bulk-fill buffer: 1 megabyte
+	//默认批量填充缓冲区: 1 兆字节
+	constexpr std::size_t BulkFillBytes = std::size_t(1) << 20;
+
+	Options RunOptions;
+	if (!RunOptions.Parse(argument_cout, argument_vector, BulkFillBytes))
+		return 1;
+
+	const std::vector<GeneratorResult> Results = RunAllGenerators(RunOptions);
+
+	//Speed relative to std::mt19937_64 (> 1 is faster), when the reference was run
+	//相对 std::mt19937_64 的速度 (> 1 表示更快), 仅当运行了参照生成器时
+	const auto Reference = std::ranges::find(Results, std::string("std::mt19937_64"), &GeneratorResult::Name);
+
+	JsonWriter Writer;
+	Writer.BeginObject();
+	WriteEnvironment(Writer, "prng", RunOptions);
+	Writer.Member("bulk_bytes", RunOptions.MaximumSize);
+	Writer.Key("results").BeginArray();
+	for (const GeneratorResult& Result : Results)
+	{
+		Writer.BeginObject()
+			.Member("generator", Result.Name)
+			.Member("family", Result.Family)
+			.Member("output_bits", Result.OutputBits)
+			.Member("state_bytes", Result.StateBytes)
+			.Member("seed_ns", Result.SeedNanoseconds)
+			.Member("ns_per_value", Result.NanosecondsPerValue)
+			.Member("bulk_gigabytes_per_second", Result.BulkGigabytesPerSecond())
+			.Member("bulk_cycles_per_byte", Result.BulkCyclesPerByte());
+		if (Reference != Results.end())
+			Writer.Member("bulk_speed_vs_mt19937_64", Result.BulkGigabytesPerSecond() / Reference->BulkGigabytesPerSecond());
+		Writer.EndObject();
+	}
+	Writer.EndArray().EndObject();
+
+	if (!Writer.Save(RunOptions.JsonPath))
+	{
+		std::cerr << "Cannot write " << RunOptions.JsonPath << std::endl;
+		return 1;
+	}
+	return 0;
+}
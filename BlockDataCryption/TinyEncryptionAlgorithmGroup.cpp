@@ -1,4 +1,5 @@
 #include "TinyEncryptionAlgorithmGroup.h"
+#include "TinyEncryptionAlgorithmKernels.h"
 
 namespace BlockDataCryption::TinyEncryptionAlgorithmGroup
 {
@@ -21,8 +22,8 @@ namespace BlockDataCryption::TinyEncryptionAlgorithmGroup
 	void TEA::decrypt( uint32_t data[ 2 ], const uint32_t key[ 4 ] )
 	{
 		//5 = log2(32): 2^{5} = 32
-		//set up: sum is (delta << 5) & 0xFFFFFFFF
-		uint32_t leftBlock = data[ 0 ], rightBlock = data[ 1 ], sum = 0xC6EF3720;
+		//set up: sum is (delta << 5) & 0xFFFFFFFF = 0xC6EF3720
+		uint32_t leftBlock = data[ 0 ], rightBlock = data[ 1 ], sum = DELTA << 5;
 
 		// Main decryption loop (32 rounds)
 		for ( int round = 0; round < 32; round++ )
@@ -54,7 +55,8 @@ namespace BlockDataCryption::TinyEncryptionAlgorithmGroup
 
 	void XTEA::decrypt( uint32_t data[ 2 ], const uint32_t key[ 4 ] )
 	{
-		uint32_t leftBlock = data[ 0 ], rightBlock = data[ 1 ], sum = 0xC6EF3720;
+		//set up: sum is (delta << 5) & 0xFFFFFFFF = 0xC6EF3720
+		uint32_t leftBlock = data[ 0 ], rightBlock = data[ 1 ], sum = DELTA << 5;
 
 		// Main decryption loop (32 rounds)
 		for ( int round = 0; round < 32; round++ )
@@ -68,6 +70,74 @@ namespace BlockDataCryption::TinyEncryptionAlgorithmGroup
 		data[ 1 ] = rightBlock;
 	}
 
+	namespace
+	{
+		using CommonToolkit::CPU_FeatureDispatch::CPU_Feature;
+		using CommonToolkit::CPU_FeatureDispatch::NoFeatures;
+
+		size_t XTEAEncryptBlocksPortable( uint32_t* data, size_t blockCount, const uint32_t key[ 4 ] )
+		{
+			for ( size_t blockIndex = 0; blockIndex < blockCount; blockIndex++ )
+				XTEAUnrolled<32>::encrypt( data + blockIndex * 2, key );
+			return blockCount;
+		}
+
+		size_t XTEADecryptBlocksPortable( uint32_t* data, size_t blockCount, const uint32_t key[ 4 ] )
+		{
+			for ( size_t blockIndex = 0; blockIndex < blockCount; blockIndex++ )
+				XTEAUnrolled<32>::decrypt( data + blockIndex * 2, key );
+			return blockCount;
+		}
+
+		#if defined( APPLIED_CRYPTOGRAPHY_HAS_AVX512_KERNELS )
+		constexpr XTEABlockKernels XTEAKernelsAVX512 { "avx512", static_cast<uint32_t>( CPU_Feature::AVX512F ), &Kernels::XTEAEncryptBlocksAVX512, &Kernels::XTEADecryptBlocksAVX512 };
+		#endif
+		#if defined( APPLIED_CRYPTOGRAPHY_HAS_AVX2_KERNELS )
+		constexpr XTEABlockKernels XTEAKernelsAVX2 { "avx2", static_cast<uint32_t>( CPU_Feature::AVX2 ), &Kernels::XTEAEncryptBlocksAVX2, &Kernels::XTEADecryptBlocksAVX2 };
+		#endif
+		#if defined( APPLIED_CRYPTOGRAPHY_HAS_SSE2_KERNELS )
+		constexpr XTEABlockKernels XTEAKernelsSSE2 { "sse2", static_cast<uint32_t>( CPU_Feature::SSE2 ), &Kernels::XTEAEncryptBlocksSSE2, &Kernels::XTEADecryptBlocksSSE2 };
+		#endif
+		constexpr XTEABlockKernels XTEAKernelsPortable { "portable", NoFeatures, &XTEAEncryptBlocksPortable, &XTEADecryptBlocksPortable };
+
+		constexpr const XTEABlockKernels* XTEAKernelCandidates[] =
+		{
+			#if defined( APPLIED_CRYPTOGRAPHY_HAS_AVX512_KERNELS )
+			&XTEAKernelsAVX512,
+			#endif
+			#if defined( APPLIED_CRYPTOGRAPHY_HAS_AVX2_KERNELS )
+			&XTEAKernelsAVX2,
+			#endif
+			#if defined( APPLIED_CRYPTOGRAPHY_HAS_SSE2_KERNELS )
+			&XTEAKernelsSSE2,
+			#endif
+			&XTEAKernelsPortable,
+		};
+	}
+
+	std::span<const XTEABlockKernels* const> XTEA::blockKernelCandidates()
+	{
+		return XTEAKernelCandidates;
+	}
+
+	const XTEABlockKernels& XTEA::blockKernels()
+	{
+		static const XTEABlockKernels& Selected = CommonToolkit::CPU_FeatureDispatch::SelectKernelTable( blockKernelCandidates() );
+		return Selected;
+	}
+
+	void XTEA::encryptBlocks( uint32_t* data, size_t blockCount, const uint32_t key[ 4 ] )
+	{
+		const size_t processedCount = blockKernels().encryptBlocks( data, blockCount, key );
+		XTEAEncryptBlocksPortable( data + processedCount * 2, blockCount - processedCount, key );
+	}
+
+	void XTEA::decryptBlocks( uint32_t* data, size_t blockCount, const uint32_t key[ 4 ] )
+	{
+		const size_t processedCount = blockKernels().decryptBlocks( data, blockCount, key );
+		XTEADecryptBlocksPortable( data + processedCount * 2, blockCount - processedCount, key );
+	}
+
 	uint32_t XXTEA::computeMX( uint32_t RightBlock, uint32_t LeftBlock, uint32_t sum, const uint32_t* key, unsigned blockIndex, uint32_t keySelector )
 	{
 		// Splitting the formula for clarity:
@@ -141,4 +211,114 @@ namespace BlockDataCryption::TinyEncryptionAlgorithmGroup
 
 		} while (--rounds);
 	}
+
+	/*
+		Every cycle of XXTEA reads the last word of the previous cycle (the first word needs $X_{\omega - 1}$ of the cycle before it),
+		so the 6 + 52/n cycles cannot be interleaved over blocks of the buffer. Each cycle is one forward (or backward) stream instead,
+		with MX inlined, the 4 key words of the cycle selected once by the key selector and kept in registers, and the block loop unrolled by 4
+		so that $(blockIndex \& 3) \oplus KeySelector_{i}$ is known at compile time.
+	*/
+	void XXTEA::encryptLargeBuffer(uint32_t* data, size_t length, uint32_t const key[4])
+	{
+		//XXTEA is only defined for two or more words, a single word cannot be decrypted again
+		if (data == nullptr || length < 2)
+			return;
+
+		const size_t lastIndex = length - 1;
+
+		//$[\text{round} \div X\omega] + 1$
+		size_t rounds = 6 + 52 / length;
+		//$\Delta_{0} = 1 \times 0x9E3779B9$
+		uint32_t sum = 0;
+		uint32_t RightBlock = data[lastIndex];  // This is the lastBlock for the first iteration
+		uint32_t LeftBlock = 0;
+
+		do {
+			//$\Delta_{i + 1} = \Delta_{i} + 0x9E3779B9$
+			sum += DELTA;
+			//$KeySelector_{i} = \Delta_{i} \gg 2$
+			const uint32_t keySelector = (sum >> 2) & 3;
+			const uint32_t key0 = key[0 ^ keySelector];
+			const uint32_t key1 = key[1 ^ keySelector];
+			const uint32_t key2 = key[2 ^ keySelector];
+			const uint32_t key3 = key[3 ^ keySelector];
+
+			size_t blockIndex = 0;
+			for (; blockIndex + 4 <= lastIndex; blockIndex += 4) {
+				LeftBlock = data[blockIndex + 1];
+				RightBlock = data[blockIndex] += mixWord(RightBlock, LeftBlock, sum, key0);
+				LeftBlock = data[blockIndex + 2];
+				RightBlock = data[blockIndex + 1] += mixWord(RightBlock, LeftBlock, sum, key1);
+				LeftBlock = data[blockIndex + 3];
+				RightBlock = data[blockIndex + 2] += mixWord(RightBlock, LeftBlock, sum, key2);
+				LeftBlock = data[blockIndex + 4];
+				RightBlock = data[blockIndex + 3] += mixWord(RightBlock, LeftBlock, sum, key3);
+			}
+
+			for (; blockIndex < lastIndex; blockIndex++) {
+				LeftBlock = data[blockIndex + 1];
+				RightBlock = data[blockIndex] += mixWord(RightBlock, LeftBlock, sum, key[(blockIndex & 3) ^ keySelector]);
+			}
+
+			LeftBlock = data[0];  // This is the firstBlock for the next iteration
+			RightBlock = data[lastIndex] += mixWord(RightBlock, LeftBlock, sum, key[(lastIndex & 3) ^ keySelector]);
+
+		} while (--rounds);
+	}
+
+	void XXTEA::decryptLargeBuffer(uint32_t* data, size_t length, uint32_t const key[4])
+	{
+		//XXTEA is only defined for two or more words, a single word cannot be decrypted again
+		if (data == nullptr || length < 2)
+			return;
+
+		const size_t lastIndex = length - 1;
+
+		//$[\text{round} \div X\omega] + 1$
+		size_t rounds = 6 + 52 / length;
+		//$\Delta_{\text{round} - 1} = \text{round} \times 0x9E3779B9$
+		uint32_t sum = static_cast<uint32_t>(rounds) * DELTA;
+		uint32_t LeftBlock = data[0];  // This is the firstBlock for the first iteration
+		uint32_t RightBlock = 0;
+
+		do {
+			//$KeySelector_{i} = \Delta_{i} \gg 2$
+			const uint32_t keySelector = (sum >> 2) & 3;
+			const uint32_t key0 = key[0 ^ keySelector];
+			const uint32_t key1 = key[1 ^ keySelector];
+			const uint32_t key2 = key[2 ^ keySelector];
+			const uint32_t key3 = key[3 ^ keySelector];
+
+			size_t blockIndex = lastIndex;
+
+			//Walk down until (blockIndex & 3) == 3, so that the unrolled loop below uses key3, key2, key1, key0 in order
+			for (; blockIndex > 0 && (blockIndex & 3) != 3; blockIndex--) {
+				RightBlock = data[blockIndex - 1];
+				LeftBlock = data[blockIndex] -= mixWord(RightBlock, LeftBlock, sum, key[(blockIndex & 3) ^ keySelector]);
+			}
+
+			for (; blockIndex >= 4; blockIndex -= 4) {
+				RightBlock = data[blockIndex - 1];
+				LeftBlock = data[blockIndex] -= mixWord(RightBlock, LeftBlock, sum, key3);
+				RightBlock = data[blockIndex - 2];
+				LeftBlock = data[blockIndex - 1] -= mixWord(RightBlock, LeftBlock, sum, key2);
+				RightBlock = data[blockIndex - 3];
+				LeftBlock = data[blockIndex - 2] -= mixWord(RightBlock, LeftBlock, sum, key1);
+				RightBlock = data[blockIndex - 4];
+				LeftBlock = data[blockIndex - 3] -= mixWord(RightBlock, LeftBlock, sum, key0);
+			}
+
+			for (; blockIndex > 0; blockIndex--) {
+				RightBlock = data[blockIndex - 1];
+				LeftBlock = data[blockIndex] -= mixWord(RightBlock, LeftBlock, sum, key[(blockIndex & 3) ^ keySelector]);
+			}
+
+			RightBlock = data[lastIndex];  // This is the lastBlock for the next iteration
+			LeftBlock = data[0] -= mixWord(RightBlock, LeftBlock, sum, key0);
+
+			//$\Delta_{i - 1} = \Delta_{i} - 0x9E3779B9$
+			sum -= DELTA;
+
+		} while (--rounds);
+	}
 } // namespace BlockDataCryption::TinyEncryptionAlgorithmGroup
\ No newline at end of file
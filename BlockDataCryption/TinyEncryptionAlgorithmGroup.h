@@ -1,6 +1,7 @@
 #pragma once
 
 #include "../MainProgram/Support+Library/Support-Library.hpp"
+#include "../MainProgram/Support+Library/CPU_FeatureDispatch.hpp"
 
 namespace BlockDataCryption::TinyEncryptionAlgorithmGroup
 {
@@ -9,7 +10,7 @@ namespace BlockDataCryption::TinyEncryptionAlgorithmGroup
 	private:
 		// Constant used for the encryption and decryption process
 		// A key schedule constant
-		const uint32_t DELTA = 0x9e3779b9;
+		static constexpr uint32_t DELTA = 0x9e3779b9;
 
 	public:
 		// Encrypts the given data using the TEA algorithm
@@ -19,11 +20,21 @@ namespace BlockDataCryption::TinyEncryptionAlgorithmGroup
 		void decrypt( uint32_t data[ 2 ], const uint32_t key[ 4 ] );
 	};
 
+	// Function pointer table of one multi-block XTEA kernel (see TinyEncryptionAlgorithmKernels.h), selected at runtime by CPU features
+	struct XTEABlockKernels
+	{
+		const char* Name;
+		CommonToolkit::CPU_FeatureDispatch::CPU_FeatureSet RequiredFeatures;
+		// Both return how many leading blocks they processed
+		size_t ( *encryptBlocks )( uint32_t* data, size_t blockCount, const uint32_t key[ 4 ] );
+		size_t ( *decryptBlocks )( uint32_t* data, size_t blockCount, const uint32_t key[ 4 ] );
+	};
+
 	class XTEA
 	{
 	private:
 		// Constant used for the encryption and decryption process
-		const uint32_t DELTA = 0x9e3779b9;
+		static constexpr uint32_t DELTA = 0x9e3779b9;
 
 	public:
 		// Encrypts the given data using the XTEA algorithm
@@ -31,23 +42,261 @@ namespace BlockDataCryption::TinyEncryptionAlgorithmGroup
 
 		// Decrypts the given data using the XTEA algorithm
 		void decrypt( uint32_t data[ 2 ], const uint32_t key[ 4 ] );
+
+		// Encrypts blockCount consecutive blocks (ECB) with the widest SIMD kernel the processor supports (same result as encrypt on every block)
+		void encryptBlocks( uint32_t* data, size_t blockCount, const uint32_t key[ 4 ] );
+
+		// Decrypts blockCount consecutive blocks (ECB) with the widest SIMD kernel the processor supports (same result as decrypt on every block)
+		void decryptBlocks( uint32_t* data, size_t blockCount, const uint32_t key[ 4 ] );
+
+		// Every compiled kernel, best first; the last one is portable
+		static std::span<const XTEABlockKernels* const> blockKernelCandidates();
+
+		// The kernel encryptBlocks/decryptBlocks use, chosen once from the candidates
+		static const XTEABlockKernels& blockKernels();
 	};
 
 	class XXTEA
 	{
 	private:
 		// Constant used for the encryption and decryption process
-		const uint32_t DELTA = 0x9e3779b9;
+		static constexpr uint32_t DELTA = 0x9e3779b9;
 
 		// Helper function to compute the mixed result based on the current state
 		inline uint32_t computeMX(uint32_t previousBlock, uint32_t currentBlock, uint32_t sum, const uint32_t* key, unsigned blockIndex, uint32_t keySelector);
 
+		// Same MX formula as computeMX, but the key word is already selected by the caller, so the large-buffer path can keep it in a register
+		static constexpr uint32_t mixWord( uint32_t RightBlock, uint32_t LeftBlock, uint32_t sum, uint32_t keyWord )
+		{
+			return ( ( ( RightBlock >> 5 ) ^ ( LeftBlock << 2 ) ) + ( ( LeftBlock >> 3 ) ^ ( RightBlock << 4 ) ) ) ^ ( ( sum ^ LeftBlock ) + ( keyWord ^ RightBlock ) );
+		}
+
 	public:
 		// Encrypts the given data using the XXTEA algorithm
 		void encrypt( uint32_t* data, int length, uint32_t const key[ 4 ] );
 
 		// Decrypts the given data using the XXTEA algorithm
 		void decrypt( uint32_t* data, int length, uint32_t const key[ 4 ] );
+
+		// Encrypts the given data using the XXTEA algorithm, for multi-kilobyte buffers (same result as encrypt, length must be at least 2)
+		void encryptLargeBuffer( uint32_t* data, size_t length, uint32_t const key[ 4 ] );
+
+		// Decrypts the given data using the XXTEA algorithm, for multi-kilobyte buffers (same result as decrypt, length must be at least 2)
+		void decryptLargeBuffer( uint32_t* data, size_t length, uint32_t const key[ 4 ] );
+	};
+
+	/*
+		Compile-time round-unrolled variants of TEA, XTEA and XXTEA.
+		The sum of every round is read from a constexpr table and the round loop is expanded by a fold expression,
+		so each round uses constant sums (and constant key indices for XTEA/XXTEA) instead of a runtime `sum += DELTA`.
+		With 32 rounds (and any word count for XXTEA) the output is the same as the TEA, XTEA and XXTEA classes above.
+	*/
+
+	template <unsigned Rounds = 32>
+	class TEAUnrolled
+	{
+		static_assert( Rounds > 0, "TEA needs at least one round" );
+
+	private:
+		// Constant used for the encryption and decryption process
+		// A key schedule constant
+		static constexpr uint32_t DELTA = 0x9e3779b9;
+
+		// RoundSums[round] = (round + 1) * DELTA, the sum used by that round
+		static constexpr std::array<uint32_t, Rounds> RoundSums = []()
+		{
+			std::array<uint32_t, Rounds> Sums {};
+			uint32_t sum = 0;
+			for ( unsigned round = 0; round < Rounds; round++ )
+			{
+				sum += DELTA;
+				Sums[ round ] = sum;
+			}
+			return Sums;
+		}();
+
+		template <unsigned Round>
+		static void encryptRound( uint32_t& leftBlock, uint32_t& rightBlock, const uint32_t key[ 4 ] )
+		{
+			constexpr uint32_t sum = RoundSums[ Round ];
+			leftBlock += ( ( rightBlock << 4 ) + key[ 0 ] ) ^ ( rightBlock + sum ) ^ ( ( rightBlock >> 5 ) + key[ 1 ] );
+			rightBlock += ( ( leftBlock << 4 ) + key[ 2 ] ) ^ ( leftBlock + sum ) ^ ( ( leftBlock >> 5 ) + key[ 3 ] );
+		}
+
+		template <unsigned Round>
+		static void decryptRound( uint32_t& leftBlock, uint32_t& rightBlock, const uint32_t key[ 4 ] )
+		{
+			constexpr uint32_t sum = RoundSums[ Round ];
+			rightBlock -= ( ( leftBlock << 4 ) + key[ 2 ] ) ^ ( leftBlock + sum ) ^ ( ( leftBlock >> 5 ) + key[ 3 ] );
+			leftBlock -= ( ( rightBlock << 4 ) + key[ 0 ] ) ^ ( rightBlock + sum ) ^ ( ( rightBlock >> 5 ) + key[ 1 ] );
+		}
+
+	public:
+		// Encrypts the given data using the TEA algorithm
+		static void encrypt( uint32_t data[ 2 ], const uint32_t key[ 4 ] )
+		{
+			uint32_t leftBlock = data[ 0 ], rightBlock = data[ 1 ];
+
+			[ & ]<unsigned... Round>( std::integer_sequence<unsigned, Round...> )
+			{
+				( encryptRound<Round>( leftBlock, rightBlock, key ), ... );
+			}( std::make_integer_sequence<unsigned, Rounds> {} );
+
+			data[ 0 ] = leftBlock;
+			data[ 1 ] = rightBlock;
+		}
+
+		// Decrypts the given data using the TEA algorithm
+		static void decrypt( uint32_t data[ 2 ], const uint32_t key[ 4 ] )
+		{
+			uint32_t leftBlock = data[ 0 ], rightBlock = data[ 1 ];
+
+			[ & ]<unsigned... Round>( std::integer_sequence<unsigned, Round...> )
+			{
+				( decryptRound<Rounds - 1 - Round>( leftBlock, rightBlock, key ), ... );
+			}( std::make_integer_sequence<unsigned, Rounds> {} );
+
+			data[ 0 ] = leftBlock;
+			data[ 1 ] = rightBlock;
+		}
+	};
+
+	template <unsigned Rounds = 32>
+	class XTEAUnrolled
+	{
+		static_assert( Rounds > 0, "XTEA needs at least one round" );
+
+	private:
+		// Constant used for the encryption and decryption process
+		static constexpr uint32_t DELTA = 0x9e3779b9;
+
+		// RoundSums[round] = round * DELTA, XTEA reads the sum before and after it is incremented
+		static constexpr std::array<uint32_t, Rounds + 1> RoundSums = []()
+		{
+			std::array<uint32_t, Rounds + 1> Sums {};
+			for ( unsigned round = 1; round <= Rounds; round++ )
+				Sums[ round ] = Sums[ round - 1 ] + DELTA;
+			return Sums;
+		}();
+
+		template <unsigned Round>
+		static void encryptRound( uint32_t& leftBlock, uint32_t& rightBlock, const uint32_t key[ 4 ] )
+		{
+			constexpr uint32_t sum = RoundSums[ Round ];
+			constexpr uint32_t nextSum = RoundSums[ Round + 1 ];
+			leftBlock += ( ( ( rightBlock << 4 ) ^ ( rightBlock >> 5 ) ) + rightBlock ) ^ ( sum + key[ sum & 3 ] );
+			rightBlock += ( ( ( leftBlock << 4 ) ^ ( leftBlock >> 5 ) ) + leftBlock ) ^ ( nextSum + key[ ( nextSum >> 11 ) & 3 ] );
+		}
+
+		template <unsigned Round>
+		static void decryptRound( uint32_t& leftBlock, uint32_t& rightBlock, const uint32_t key[ 4 ] )
+		{
+			constexpr uint32_t sum = RoundSums[ Round ];
+			constexpr uint32_t nextSum = RoundSums[ Round + 1 ];
+			rightBlock -= ( ( ( leftBlock << 4 ) ^ ( leftBlock >> 5 ) ) + leftBlock ) ^ ( nextSum + key[ ( nextSum >> 11 ) & 3 ] );
+			leftBlock -= ( ( ( rightBlock << 4 ) ^ ( rightBlock >> 5 ) ) + rightBlock ) ^ ( sum + key[ sum & 3 ] );
+		}
+
+	public:
+		// Encrypts the given data using the XTEA algorithm
+		static void encrypt( uint32_t data[ 2 ], const uint32_t key[ 4 ] )
+		{
+			uint32_t leftBlock = data[ 0 ], rightBlock = data[ 1 ];
+
+			[ & ]<unsigned... Round>( std::integer_sequence<unsigned, Round...> )
+			{
+				( encryptRound<Round>( leftBlock, rightBlock, key ), ... );
+			}( std::make_integer_sequence<unsigned, Rounds> {} );
+
+			data[ 0 ] = leftBlock;
+			data[ 1 ] = rightBlock;
+		}
+
+		// Decrypts the given data using the XTEA algorithm
+		static void decrypt( uint32_t data[ 2 ], const uint32_t key[ 4 ] )
+		{
+			uint32_t leftBlock = data[ 0 ], rightBlock = data[ 1 ];
+
+			[ & ]<unsigned... Round>( std::integer_sequence<unsigned, Round...> )
+			{
+				( decryptRound<Rounds - 1 - Round>( leftBlock, rightBlock, key ), ... );
+			}( std::make_integer_sequence<unsigned, Rounds> {} );
+
+			data[ 0 ] = leftBlock;
+			data[ 1 ] = rightBlock;
+		}
+	};
+
+	// XXTEA derives its cycle count from the word count (6 + 52 / length), so the unrolled variant fixes the block length at compile time
+	template <std::size_t Length>
+	class XXTEAUnrolled
+	{
+		static_assert( Length >= 2, "XXTEA is only defined for two or more words" );
+
+	private:
+		// Constant used for the encryption and decryption process
+		static constexpr uint32_t DELTA = 0x9e3779b9;
+
+		//$[\text{round} \div X\omega] + 1$
+		static constexpr unsigned Cycles = 6 + 52 / Length;
+
+		//$\Delta_{i} = (i + 1) \times 0x9E3779B9$
+		static constexpr std::array<uint32_t, Cycles> CycleSums = []()
+		{
+			std::array<uint32_t, Cycles> Sums {};
+			uint32_t sum = 0;
+			for ( unsigned cycle = 0; cycle < Cycles; cycle++ )
+			{
+				sum += DELTA;
+				Sums[ cycle ] = sum;
+			}
+			return Sums;
+		}();
+
+		static constexpr uint32_t mixWord( uint32_t RightBlock, uint32_t LeftBlock, uint32_t sum, uint32_t keyWord )
+		{
+			return ( ( ( RightBlock >> 5 ) ^ ( LeftBlock << 2 ) ) + ( ( LeftBlock >> 3 ) ^ ( RightBlock << 4 ) ) ) ^ ( ( sum ^ LeftBlock ) + ( keyWord ^ RightBlock ) );
+		}
+
+		template <unsigned Cycle, std::size_t... BlockIndex>
+		static void encryptCycle( uint32_t* data, const uint32_t key[ 4 ], std::index_sequence<BlockIndex...> )
+		{
+			constexpr uint32_t sum = CycleSums[ Cycle ];
+			constexpr uint32_t keySelector = ( sum >> 2 ) & 3;
+
+			uint32_t RightBlock = data[ Length - 1 ];
+			( ( RightBlock = data[ BlockIndex ] += mixWord( RightBlock, data[ ( BlockIndex + 1 ) % Length ], sum, key[ ( BlockIndex & 3 ) ^ keySelector ] ) ), ... );
+		}
+
+		template <unsigned Cycle, std::size_t... BlockIndex>
+		static void decryptCycle( uint32_t* data, const uint32_t key[ 4 ], std::index_sequence<BlockIndex...> )
+		{
+			constexpr uint32_t sum = CycleSums[ Cycle ];
+			constexpr uint32_t keySelector = ( sum >> 2 ) & 3;
+
+			// Walks blockIndex = Length - 1 down to 0
+			uint32_t LeftBlock = data[ 0 ];
+			( ( LeftBlock = data[ Length - 1 - BlockIndex ] -= mixWord( data[ ( 2 * Length - 2 - BlockIndex ) % Length ], LeftBlock, sum, key[ ( ( Length - 1 - BlockIndex ) & 3 ) ^ keySelector ] ) ), ... );
+		}
+
+	public:
+		// Encrypts the given data using the XXTEA algorithm
+		static void encrypt( uint32_t* data, uint32_t const key[ 4 ] )
+		{
+			[ & ]<unsigned... Cycle>( std::integer_sequence<unsigned, Cycle...> )
+			{
+				( encryptCycle<Cycle>( data, key, std::make_index_sequence<Length> {} ), ... );
+			}( std::make_integer_sequence<unsigned, Cycles> {} );
+		}
+
+		// Decrypts the given data using the XXTEA algorithm
+		static void decrypt( uint32_t* data, uint32_t const key[ 4 ] )
+		{
+			[ & ]<unsigned... Cycle>( std::integer_sequence<unsigned, Cycle...> )
+			{
+				( decryptCycle<Cycles - 1 - Cycle>( data, key, std::make_index_sequence<Length> {} ), ... );
+			}( std::make_integer_sequence<unsigned, Cycles> {} );
+		}
 	};
 
 	inline void UnitTest()
@@ -91,4 +340,202 @@ namespace BlockDataCryption::TinyEncryptionAlgorithmGroup
 		xxtea.decrypt( data, 2, key );
 		std::cout << "XXTEA Decrypted Data: " << data[ 0 ] << ", " << data[ 1 ] << std::endl;
 	}
+
+	// Cross-check the round-unrolled variants against the TEA, XTEA and XXTEA classes
+	inline void TestTinyEncryptionAlgorithmUnrolled()
+	{
+		TEA	  tea;
+		XTEA  xtea;
+		XXTEA xxtea;
+
+		std::mt19937 PRNG( 1 );
+		uint32_t key[ 4 ] = { 0x01234567, 0x89ABCDEF, 0xFEDCBA98, 0x76543210 };
+
+		bool IsAllPassed = true;
+		for ( size_t Count = 0; Count < 1024; ++Count )
+		{
+			std::array<uint32_t, 7> PlainData {};
+			for ( auto& Word : PlainData )
+				Word = PRNG();
+
+			std::array<uint32_t, 7> ReferenceData( PlainData );
+			std::array<uint32_t, 7> UnrolledData( PlainData );
+
+			tea.encrypt( ReferenceData.data(), key );
+			TEAUnrolled<32>::encrypt( UnrolledData.data(), key );
+			IsAllPassed &= ReferenceData == UnrolledData;
+			TEAUnrolled<32>::decrypt( UnrolledData.data(), key );
+			IsAllPassed &= UnrolledData == PlainData;
+
+			xtea.encrypt( ReferenceData.data() + 2, key );
+			XTEAUnrolled<32>::encrypt( UnrolledData.data() + 2, key );
+			UnrolledData[ 0 ] = ReferenceData[ 0 ];
+			UnrolledData[ 1 ] = ReferenceData[ 1 ];
+			IsAllPassed &= ReferenceData == UnrolledData;
+			XTEAUnrolled<32>::decrypt( UnrolledData.data() + 2, key );
+			IsAllPassed &= std::equal( UnrolledData.begin() + 2, UnrolledData.end(), PlainData.begin() + 2 );
+
+			ReferenceData = PlainData;
+			UnrolledData = PlainData;
+			xxtea.encrypt( ReferenceData.data(), 7, key );
+			XXTEAUnrolled<7>::encrypt( UnrolledData.data(), key );
+			IsAllPassed &= ReferenceData == UnrolledData;
+			XXTEAUnrolled<7>::decrypt( UnrolledData.data(), key );
+			IsAllPassed &= UnrolledData == PlainData;
+
+			ReferenceData = PlainData;
+			UnrolledData = PlainData;
+			xxtea.encrypt( ReferenceData.data(), 2, key );
+			XXTEAUnrolled<2>::encrypt( UnrolledData.data(), key );
+			IsAllPassed &= ReferenceData == UnrolledData;
+			XXTEAUnrolled<2>::decrypt( UnrolledData.data(), key );
+			IsAllPassed &= UnrolledData == PlainData;
+
+			// Other round counts only need to round trip
+			UnrolledData = PlainData;
+			TEAUnrolled<64>::encrypt( UnrolledData.data(), key );
+			XTEAUnrolled<64>::encrypt( UnrolledData.data() + 2, key );
+			IsAllPassed &= UnrolledData != PlainData;
+			XTEAUnrolled<64>::decrypt( UnrolledData.data() + 2, key );
+			TEAUnrolled<64>::decrypt( UnrolledData.data(), key );
+			IsAllPassed &= UnrolledData == PlainData;
+		}
+
+		std::cout << "TEA/XTEA/XXTEA round-unrolled cross-check: " << ( IsAllPassed ? "passed" : "failed" ) << std::endl;
+	}
+
+	// Cross-check the XXTEA large-buffer path against the original encrypt/decrypt functions
+	inline void TestXXTEALargeBuffer()
+	{
+		XXTEA xxtea;
+
+		std::mt19937 PRNG( 1 );
+		uint32_t key[ 4 ] = { 0x01234567, 0x89ABCDEF, 0xFEDCBA98, 0x76543210 };
+
+		bool IsAllPassed = true;
+		for ( size_t length : { 2, 3, 4, 5, 6, 7, 8, 9, 13, 16, 17, 52, 53, 64, 255, 1024, 4099, 65536 } )
+		{
+			std::vector<uint32_t> PlainData( length );
+			for ( auto& Word : PlainData )
+				Word = PRNG();
+
+			std::vector<uint32_t> ReferenceData( PlainData );
+			std::vector<uint32_t> LargeBufferData( PlainData );
+
+			xxtea.encrypt( ReferenceData.data(), static_cast<int>( length ), key );
+			xxtea.encryptLargeBuffer( LargeBufferData.data(), length, key );
+			bool IsSameCipher = ReferenceData == LargeBufferData;
+
+			xxtea.decrypt( ReferenceData.data(), static_cast<int>( length ), key );
+			xxtea.decryptLargeBuffer( LargeBufferData.data(), length, key );
+			bool IsSamePlain = ReferenceData == LargeBufferData && LargeBufferData == PlainData;
+
+			if ( !IsSameCipher || !IsSamePlain )
+			{
+				std::cout << "XXTEA large-buffer path mismatch with " << length << " words!" << std::endl;
+				IsAllPassed = false;
+			}
+		}
+
+		std::cout << "XXTEA large-buffer cross-check: " << ( IsAllPassed ? "passed" : "failed" ) << std::endl;
+	}
+
+	// Cross-check every multi-block XTEA kernel this processor can run against the one-block encrypt/decrypt functions
+	inline void TestXTEABlocks()
+	{
+		XTEA xtea;
+
+		std::mt19937 PRNG( 1 );
+		uint32_t key[ 4 ] = { 0x01234567, 0x89ABCDEF, 0xFEDCBA98, 0x76543210 };
+
+		bool IsAllPassed = true;
+		for ( const XTEABlockKernels* Kernels : XTEA::blockKernelCandidates() )
+		{
+			if ( !CommonToolkit::CPU_FeatureDispatch::HasFeatures( Kernels->RequiredFeatures ) )
+			{
+				std::cout << "XTEA " << Kernels->Name << " kernel: skipped (not supported by this processor)" << std::endl;
+				continue;
+			}
+
+			bool IsPassed = true;
+			for ( size_t blockCount : { 0, 1, 3, 4, 5, 7, 8, 9, 15, 16, 17, 31, 32, 33, 47, 64, 100, 1000 } )
+			{
+				std::vector<uint32_t> PlainData( blockCount * 2 );
+				for ( auto& Word : PlainData )
+					Word = PRNG();
+
+				std::vector<uint32_t> ReferenceData( PlainData );
+				for ( size_t blockIndex = 0; blockIndex < blockCount; blockIndex++ )
+					xtea.encrypt( ReferenceData.data() + blockIndex * 2, key );
+
+				// A kernel leaves the blocks after its last whole group to the caller, here the one-block functions
+				std::vector<uint32_t> KernelData( PlainData );
+				size_t processedCount = Kernels->encryptBlocks( KernelData.data(), blockCount, key );
+				for ( size_t blockIndex = processedCount; blockIndex < blockCount; blockIndex++ )
+					xtea.encrypt( KernelData.data() + blockIndex * 2, key );
+				IsPassed &= processedCount <= blockCount && KernelData == ReferenceData;
+
+				processedCount = Kernels->decryptBlocks( KernelData.data(), blockCount, key );
+				for ( size_t blockIndex = processedCount; blockIndex < blockCount; blockIndex++ )
+					xtea.decrypt( KernelData.data() + blockIndex * 2, key );
+				IsPassed &= KernelData == PlainData;
+			}
+
+			std::cout << "XTEA " << Kernels->Name << " kernel cross-check: " << ( IsPassed ? "passed" : "failed" ) << std::endl;
+			IsAllPassed &= IsPassed;
+		}
+
+		// The dispatched entry points, including the tail after the last whole group
+		std::vector<uint32_t> PlainData( 2 * 1003 );
+		for ( auto& Word : PlainData )
+			Word = PRNG();
+		std::vector<uint32_t> ReferenceData( PlainData ), DispatchedData( PlainData );
+		for ( size_t blockIndex = 0; blockIndex < 1003; blockIndex++ )
+			xtea.encrypt( ReferenceData.data() + blockIndex * 2, key );
+		xtea.encryptBlocks( DispatchedData.data(), 1003, key );
+		IsAllPassed &= DispatchedData == ReferenceData;
+		xtea.decryptBlocks( DispatchedData.data(), 1003, key );
+		IsAllPassed &= DispatchedData == PlainData;
+
+		std::cout << "XTEA multi-block (dispatched to " << XTEA::blockKernels().Name << "): " << ( IsAllPassed ? "passed" : "failed" ) << std::endl;
+	}
+
+	// Measure throughput of the original and the large-buffer XXTEA path, from 8 bytes to 1 megabytes
+	inline void BenchmarkXXTEALargeBuffer()
+	{
+		XXTEA xxtea;
+
+		std::mt19937 PRNG( 1 );
+		uint32_t key[ 4 ] = { 0x01234567, 0x89ABCDEF, 0xFEDCBA98, 0x76543210 };
+
+		const auto backup_io_format_flags = std::cout.flags();
+
+		for ( size_t ByteSize = 8; ByteSize <= 1048576; ByteSize *= 2 )
+		{
+			const size_t length = ByteSize / sizeof( uint32_t );
+			std::vector<uint32_t> Data( length );
+			for ( auto& Word : Data )
+				Word = PRNG();
+
+			// Repeat small buffers so that every size processes about 16 megabytes
+			const size_t Repeat = std::max<size_t>( 1, ( size_t( 1 ) << 24 ) / ByteSize );
+
+			auto StartTime = std::chrono::steady_clock::now();
+			for ( size_t Count = 0; Count < Repeat; ++Count )
+				xxtea.encrypt( Data.data(), static_cast<int>( length ), key );
+			auto ReferenceTime = std::chrono::duration<double>( std::chrono::steady_clock::now() - StartTime ).count();
+
+			StartTime = std::chrono::steady_clock::now();
+			for ( size_t Count = 0; Count < Repeat; ++Count )
+				xxtea.encryptLargeBuffer( Data.data(), length, key );
+			auto LargeBufferTime = std::chrono::duration<double>( std::chrono::steady_clock::now() - StartTime ).count();
+
+			const double MegaBytes = static_cast<double>( ByteSize * Repeat ) / ( 1024.0 * 1024.0 );
+			std::cout << std::dec << std::setw( 8 ) << ByteSize << " bytes: "
+				<< "encrypt " << std::fixed << std::setprecision( 2 ) << MegaBytes / ReferenceTime << " MB/s, "
+				<< "encryptLargeBuffer " << MegaBytes / LargeBufferTime << " MB/s" << std::endl;
+		}
+
+		std::cout.flags( backup_io_format_flags );
+	}
 }
\ No newline at end of file
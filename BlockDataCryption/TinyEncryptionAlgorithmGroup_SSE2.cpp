@@ -0,0 +1,99 @@
+#include "TinyEncryptionAlgorithmKernels.h"
+
+#include <immintrin.h>
+
+namespace BlockDataCryption::TinyEncryptionAlgorithmGroup::Kernels
+{
+	namespace
+	{
+		constexpr uint32_t DELTA = 0x9e3779b9;
+		constexpr size_t Lanes = 4;
+
+		// roundKeys[ 2 * round ] = sum + key[ sum & 3 ] for the left half, roundKeys[ 2 * round + 1 ] = next sum + key[ ( next sum >> 11 ) & 3 ] for the right half
+		void makeRoundKeys( __m128i roundKeys[ 64 ], const uint32_t key[ 4 ] )
+		{
+			uint32_t sum = 0;
+			for ( int round = 0; round < 32; round++ )
+			{
+				roundKeys[ 2 * round ] = _mm_set1_epi32( static_cast<int>( sum + key[ sum & 3 ] ) );
+				sum += DELTA;
+				roundKeys[ 2 * round + 1 ] = _mm_set1_epi32( static_cast<int>( sum + key[ ( sum >> 11 ) & 3 ] ) );
+			}
+		}
+
+		// ( ( x << 4 ) ^ ( x >> 5 ) ) + x
+		inline __m128i mixLanes( __m128i x )
+		{
+			return _mm_add_epi32( _mm_xor_si128( _mm_slli_epi32( x, 4 ), _mm_srli_epi32( x, 5 ) ), x );
+		}
+
+		// Splits Lanes consecutive blocks into one vector of left halves and one of right halves
+		inline void loadBlocks( const uint32_t* data, __m128i& leftBlocks, __m128i& rightBlocks )
+		{
+			const __m128 first = _mm_castsi128_ps( _mm_loadu_si128( reinterpret_cast<const __m128i*>( data ) ) );
+			const __m128 second = _mm_castsi128_ps( _mm_loadu_si128( reinterpret_cast<const __m128i*>( data + Lanes ) ) );
+			leftBlocks = _mm_castps_si128( _mm_shuffle_ps( first, second, _MM_SHUFFLE( 2, 0, 2, 0 ) ) );
+			rightBlocks = _mm_castps_si128( _mm_shuffle_ps( first, second, _MM_SHUFFLE( 3, 1, 3, 1 ) ) );
+		}
+
+		inline void storeBlocks( uint32_t* data, __m128i leftBlocks, __m128i rightBlocks )
+		{
+			_mm_storeu_si128( reinterpret_cast<__m128i*>( data ), _mm_unpacklo_epi32( leftBlocks, rightBlocks ) );
+			_mm_storeu_si128( reinterpret_cast<__m128i*>( data + Lanes ), _mm_unpackhi_epi32( leftBlocks, rightBlocks ) );
+		}
+
+		// Groups independent vectors per step, so the round dependency chains of several groups overlap
+		template <size_t Groups, bool IsEncrypt>
+		void processGroups( uint32_t* data, const __m128i roundKeys[ 64 ] )
+		{
+			__m128i leftBlocks[ Groups ], rightBlocks[ Groups ];
+			for ( size_t group = 0; group < Groups; group++ )
+				loadBlocks( data + group * Lanes * 2, leftBlocks[ group ], rightBlocks[ group ] );
+
+			for ( int round = 0; round < 32; round++ )
+			{
+				if constexpr ( IsEncrypt )
+				{
+					for ( size_t group = 0; group < Groups; group++ )
+						leftBlocks[ group ] = _mm_add_epi32( leftBlocks[ group ], _mm_xor_si128( mixLanes( rightBlocks[ group ] ), roundKeys[ 2 * round ] ) );
+					for ( size_t group = 0; group < Groups; group++ )
+						rightBlocks[ group ] = _mm_add_epi32( rightBlocks[ group ], _mm_xor_si128( mixLanes( leftBlocks[ group ] ), roundKeys[ 2 * round + 1 ] ) );
+				}
+				else
+				{
+					for ( size_t group = 0; group < Groups; group++ )
+						rightBlocks[ group ] = _mm_sub_epi32( rightBlocks[ group ], _mm_xor_si128( mixLanes( leftBlocks[ group ] ), roundKeys[ 63 - 2 * round ] ) );
+					for ( size_t group = 0; group < Groups; group++ )
+						leftBlocks[ group ] = _mm_sub_epi32( leftBlocks[ group ], _mm_xor_si128( mixLanes( rightBlocks[ group ] ), roundKeys[ 62 - 2 * round ] ) );
+				}
+			}
+
+			for ( size_t group = 0; group < Groups; group++ )
+				storeBlocks( data + group * Lanes * 2, leftBlocks[ group ], rightBlocks[ group ] );
+		}
+
+		template <bool IsEncrypt>
+		size_t processBlocks( uint32_t* data, size_t blockCount, const uint32_t key[ 4 ] )
+		{
+			__m128i roundKeys[ 64 ];
+			makeRoundKeys( roundKeys, key );
+
+			size_t blockIndex = 0;
+			for ( ; blockIndex + 2 * Lanes <= blockCount; blockIndex += 2 * Lanes )
+				processGroups<2, IsEncrypt>( data + blockIndex * 2, roundKeys );
+			for ( ; blockIndex + Lanes <= blockCount; blockIndex += Lanes )
+				processGroups<1, IsEncrypt>( data + blockIndex * 2, roundKeys );
+			return blockIndex;
+		}
+	}
+
+	size_t XTEAEncryptBlocksSSE2( uint32_t* data, size_t blockCount, const uint32_t key[ 4 ] )
+	{
+		return processBlocks<true>( data, blockCount, key );
+	}
+
+	size_t XTEADecryptBlocksSSE2( uint32_t* data, size_t blockCount, const uint32_t key[ 4 ] )
+	{
+		return processBlocks<false>( data, blockCount, key );
+	}
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+/*
+	Multi-block SIMD kernels of XTEA, one translation unit per instruction set (TinyEncryptionAlgorithmGroup_<instruction set>.cpp).
+	Those files are compiled with their own instruction set flags, so this header only declares plain functions and includes nothing with inline code.
+	Each kernel encrypts or decrypts as many whole SIMD groups of consecutive 64-bit blocks as it can and returns how many blocks it processed;
+	the caller finishes the remaining blocks (fewer than one group) with the scalar code.
+*/
+namespace BlockDataCryption::TinyEncryptionAlgorithmGroup::Kernels
+{
+	// 4 blocks per group
+	size_t XTEAEncryptBlocksSSE2( uint32_t* data, size_t blockCount, const uint32_t key[ 4 ] );
+	size_t XTEADecryptBlocksSSE2( uint32_t* data, size_t blockCount, const uint32_t key[ 4 ] );
+
+	// 8 blocks per group
+	size_t XTEAEncryptBlocksAVX2( uint32_t* data, size_t blockCount, const uint32_t key[ 4 ] );
+	size_t XTEADecryptBlocksAVX2( uint32_t* data, size_t blockCount, const uint32_t key[ 4 ] );
+
+	// 16 blocks per group
+	size_t XTEAEncryptBlocksAVX512( uint32_t* data, size_t blockCount, const uint32_t key[ 4 ] );
+	size_t XTEADecryptBlocksAVX512( uint32_t* data, size_t blockCount, const uint32_t key[ 4 ] );
+}
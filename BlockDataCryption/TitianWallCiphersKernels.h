@@ -0,0 +1,21 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+/*
+	Multi-block SIMD kernels of the TitanWall block cipher (MainProgram/Support+Library/TitianWallCiphers.hpp), one translation unit per instruction set
+	(TitianWallCiphers_<instruction set>.cpp). Those files are compiled with their own instruction set flags, so this header only declares plain functions
+	and includes nothing with inline code.
+	A block is 32 bytes read as eight little-endian words; subkeys is the 128-word KDSB of the cipher object.
+	Each kernel processes as many whole SIMD groups of consecutive blocks as it can and returns how many blocks it processed;
+	the caller finishes the remaining blocks (fewer than one group) with the one-block code. input and output may be the same buffer.
+*/
+namespace BlockDataCryption::TitanWall::Kernels
+{
+	// 8 blocks per group
+	size_t TitanWallEncryptBlocksAVX2( const uint8_t* input, uint8_t* output, size_t blockCount, const uint32_t subkeys[ 128 ] );
+	size_t TitanWallDecryptBlocksAVX2( const uint8_t* input, uint8_t* output, size_t blockCount, const uint32_t subkeys[ 128 ] );
+	// Keystream block i is the encryption of nonce[ 0 .. 5 ] || low word of ( counter + i ) || high word of ( counter + i ), XORed into input
+	size_t TitanWallCounterModeAVX2( const uint8_t* input, uint8_t* output, size_t blockCount, const uint32_t nonce[ 6 ], uint64_t counter, const uint32_t subkeys[ 128 ] );
+}
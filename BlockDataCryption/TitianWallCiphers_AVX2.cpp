@@ -0,0 +1,271 @@
+#include "TitianWallCiphersKernels.h"
+
+#include <immintrin.h>
+
+namespace BlockDataCryption::TitanWall::Kernels
+{
+	namespace
+	{
+		constexpr size_t Lanes = 8;
+		constexpr size_t BlockByteSize = 32;
+
+		inline __m256i broadcast( uint32_t value )
+		{
+			return _mm256_set1_epi32( static_cast<int>( value ) );
+		}
+
+		// AVX2 variable shifts return 0 for a count of 32, so a zero rotation needs no special case
+		inline __m256i rotateRightLanes( __m256i number, __m256i bit )
+		{
+			bit = _mm256_and_si256( bit, _mm256_set1_epi32( 31 ) );
+			return _mm256_or_si256( _mm256_srlv_epi32( number, bit ), _mm256_sllv_epi32( number, _mm256_sub_epi32( _mm256_set1_epi32( 32 ), bit ) ) );
+		}
+
+		inline __m256i rotateLeftLanes( __m256i number, __m256i bit )
+		{
+			bit = _mm256_and_si256( bit, _mm256_set1_epi32( 31 ) );
+			return _mm256_or_si256( _mm256_sllv_epi32( number, bit ), _mm256_srlv_epi32( number, _mm256_sub_epi32( _mm256_set1_epi32( 32 ), bit ) ) );
+		}
+
+		// x ^ ( ( x << Shift ) + 1 )
+		template <int Shift>
+		inline __m256i substitutionLanes( __m256i x )
+		{
+			return _mm256_xor_si256( x, _mm256_add_epi32( _mm256_slli_epi32( x, Shift ), _mm256_set1_epi32( 1 ) ) );
+		}
+
+		inline void phtLanes( __m256i& a, __m256i& b )
+		{
+			a = _mm256_add_epi32( a, b );
+			b = _mm256_add_epi32( a, b );
+		}
+
+		inline void inversePhtLanes( __m256i& a, __m256i& b )
+		{
+			b = _mm256_sub_epi32( b, a );
+			a = _mm256_sub_epi32( a, b );
+		}
+
+		// Same round as TitanWallBlockCipher::EncryptRound, including the static register renaming of the caller
+		inline void encryptRoundLanes
+		(
+			__m256i& A, __m256i& B, __m256i& C, __m256i& D, __m256i& E, __m256i& F, __m256i& G, __m256i& H,
+			const uint32_t* roundSubkeys, const uint32_t* mixSubkeys
+		)
+		{
+			const __m256i t = substitutionLanes<1>( B );
+			const __m256i u = substitutionLanes<2>( D );
+			const __m256i v = substitutionLanes<3>( F );
+			const __m256i w = substitutionLanes<4>( H );
+
+			A = _mm256_add_epi32( rotateRightLanes( _mm256_sub_epi32( A, t ), w ), broadcast( roundSubkeys[ 0 ] ) );
+			C = _mm256_add_epi32( rotateRightLanes( _mm256_xor_si256( C, u ), v ), broadcast( roundSubkeys[ 1 ] ) );
+			E = _mm256_add_epi32( rotateRightLanes( _mm256_xor_si256( E, v ), u ), broadcast( roundSubkeys[ 2 ] ) );
+			G = _mm256_add_epi32( rotateRightLanes( _mm256_add_epi32( G, w ), t ), broadcast( roundSubkeys[ 3 ] ) );
+
+			B = _mm256_add_epi32( B, broadcast( mixSubkeys[ 0 ] ) );
+			D = _mm256_xor_si256( D, broadcast( mixSubkeys[ 1 ] ) );
+			F = _mm256_xor_si256( F, broadcast( mixSubkeys[ 2 ] ) );
+			H = _mm256_sub_epi32( H, broadcast( mixSubkeys[ 3 ] ) );
+
+			phtLanes( E, C );
+			phtLanes( H, B );
+			phtLanes( G, A );
+			phtLanes( F, D );
+		}
+
+		// Same round as TitanWallBlockCipher::DecryptRound
+		inline void decryptRoundLanes
+		(
+			__m256i& A, __m256i& B, __m256i& C, __m256i& D, __m256i& E, __m256i& F, __m256i& G, __m256i& H,
+			const uint32_t* roundSubkeys, const uint32_t* mixSubkeys
+		)
+		{
+			inversePhtLanes( E, C );
+			inversePhtLanes( H, B );
+			inversePhtLanes( G, A );
+			inversePhtLanes( F, D );
+
+			H = _mm256_add_epi32( H, broadcast( mixSubkeys[ 3 ] ) );
+			F = _mm256_xor_si256( F, broadcast( mixSubkeys[ 2 ] ) );
+			D = _mm256_xor_si256( D, broadcast( mixSubkeys[ 1 ] ) );
+			B = _mm256_sub_epi32( B, broadcast( mixSubkeys[ 0 ] ) );
+
+			const __m256i t = substitutionLanes<1>( B );
+			const __m256i u = substitutionLanes<2>( D );
+			const __m256i v = substitutionLanes<3>( F );
+			const __m256i w = substitutionLanes<4>( H );
+
+			G = _mm256_sub_epi32( rotateLeftLanes( _mm256_sub_epi32( G, broadcast( roundSubkeys[ 3 ] ) ), t ), w );
+			E = _mm256_xor_si256( rotateLeftLanes( _mm256_sub_epi32( E, broadcast( roundSubkeys[ 2 ] ) ), u ), v );
+			C = _mm256_xor_si256( rotateLeftLanes( _mm256_sub_epi32( C, broadcast( roundSubkeys[ 1 ] ) ), v ), u );
+			A = _mm256_add_epi32( rotateLeftLanes( _mm256_sub_epi32( A, broadcast( roundSubkeys[ 0 ] ) ), w ), t );
+		}
+
+		// 8x8 word transpose: one block per vector <-> one word of every block per vector
+		inline void transposeLanes( __m256i words[ 8 ] )
+		{
+			const __m256i t0 = _mm256_unpacklo_epi32( words[ 0 ], words[ 1 ] );
+			const __m256i t1 = _mm256_unpackhi_epi32( words[ 0 ], words[ 1 ] );
+			const __m256i t2 = _mm256_unpacklo_epi32( words[ 2 ], words[ 3 ] );
+			const __m256i t3 = _mm256_unpackhi_epi32( words[ 2 ], words[ 3 ] );
+			const __m256i t4 = _mm256_unpacklo_epi32( words[ 4 ], words[ 5 ] );
+			const __m256i t5 = _mm256_unpackhi_epi32( words[ 4 ], words[ 5 ] );
+			const __m256i t6 = _mm256_unpacklo_epi32( words[ 6 ], words[ 7 ] );
+			const __m256i t7 = _mm256_unpackhi_epi32( words[ 6 ], words[ 7 ] );
+
+			const __m256i u0 = _mm256_unpacklo_epi64( t0, t2 );
+			const __m256i u1 = _mm256_unpackhi_epi64( t0, t2 );
+			const __m256i u2 = _mm256_unpacklo_epi64( t1, t3 );
+			const __m256i u3 = _mm256_unpackhi_epi64( t1, t3 );
+			const __m256i u4 = _mm256_unpacklo_epi64( t4, t6 );
+			const __m256i u5 = _mm256_unpackhi_epi64( t4, t6 );
+			const __m256i u6 = _mm256_unpacklo_epi64( t5, t7 );
+			const __m256i u7 = _mm256_unpackhi_epi64( t5, t7 );
+
+			words[ 0 ] = _mm256_permute2x128_si256( u0, u4, 0x20 );
+			words[ 1 ] = _mm256_permute2x128_si256( u1, u5, 0x20 );
+			words[ 2 ] = _mm256_permute2x128_si256( u2, u6, 0x20 );
+			words[ 3 ] = _mm256_permute2x128_si256( u3, u7, 0x20 );
+			words[ 4 ] = _mm256_permute2x128_si256( u0, u4, 0x31 );
+			words[ 5 ] = _mm256_permute2x128_si256( u1, u5, 0x31 );
+			words[ 6 ] = _mm256_permute2x128_si256( u2, u6, 0x31 );
+			words[ 7 ] = _mm256_permute2x128_si256( u3, u7, 0x31 );
+		}
+
+		inline void loadBlocks( const uint8_t* bytes, __m256i words[ 8 ] )
+		{
+			for ( size_t lane = 0; lane < Lanes; lane++ )
+				words[ lane ] = _mm256_loadu_si256( reinterpret_cast<const __m256i*>( bytes + lane * BlockByteSize ) );
+			transposeLanes( words );
+		}
+
+		inline void storeBlocks( __m256i words[ 8 ], uint8_t* bytes )
+		{
+			transposeLanes( words );
+			for ( size_t lane = 0; lane < Lanes; lane++ )
+				_mm256_storeu_si256( reinterpret_cast<__m256i*>( bytes + lane * BlockByteSize ), words[ lane ] );
+		}
+
+		// words[ i ] holds word i of every block; same key whitening and round order as TitanWallBlockCipher::EncryptBlock
+		void encryptLanes( __m256i words[ 8 ], const uint32_t* subkeys )
+		{
+			__m256i A = words[ 0 ];
+			__m256i B = _mm256_add_epi32( words[ 1 ], broadcast( subkeys[ 0 ] ) );
+			__m256i C = words[ 2 ];
+			__m256i D = _mm256_add_epi32( words[ 3 ], broadcast( subkeys[ 1 ] ) );
+			__m256i E = words[ 4 ];
+			__m256i F = _mm256_add_epi32( words[ 5 ], broadcast( subkeys[ 2 ] ) );
+			__m256i G = words[ 6 ];
+			__m256i H = _mm256_add_epi32( words[ 7 ], broadcast( subkeys[ 3 ] ) );
+
+			for ( size_t j = 1; j <= 57; j += 4 )
+			{
+				encryptRoundLanes( A, B, C, D, E, F, G, H, subkeys + 2 * j, subkeys + j );
+				encryptRoundLanes( E, C, H, B, G, A, F, D, subkeys + 2 * ( j + 1 ), subkeys + j + 1 );
+				encryptRoundLanes( G, H, D, C, F, E, A, B, subkeys + 2 * ( j + 2 ), subkeys + j + 2 );
+				encryptRoundLanes( F, D, B, H, A, G, E, C, subkeys + 2 * ( j + 3 ), subkeys + j + 3 );
+			}
+			encryptRoundLanes( A, B, C, D, E, F, G, H, subkeys + 2 * 61, subkeys + 61 );
+			encryptRoundLanes( E, C, H, B, G, A, F, D, subkeys + 2 * 62, subkeys + 62 );
+
+			// The logical roles ( A, B, C, D, E, F, G, H ) are now held by ( G, H, D, C, F, E, A, B )
+			words[ 0 ] = _mm256_add_epi32( G, broadcast( subkeys[ 124 ] ) );
+			words[ 1 ] = H;
+			words[ 2 ] = _mm256_add_epi32( D, broadcast( subkeys[ 125 ] ) );
+			words[ 3 ] = C;
+			words[ 4 ] = _mm256_add_epi32( F, broadcast( subkeys[ 126 ] ) );
+			words[ 5 ] = E;
+			words[ 6 ] = _mm256_add_epi32( A, broadcast( subkeys[ 127 ] ) );
+			words[ 7 ] = B;
+		}
+
+		void decryptLanes( __m256i words[ 8 ], const uint32_t* subkeys )
+		{
+			__m256i G = _mm256_sub_epi32( words[ 0 ], broadcast( subkeys[ 124 ] ) );
+			__m256i H = words[ 1 ];
+			__m256i D = _mm256_sub_epi32( words[ 2 ], broadcast( subkeys[ 125 ] ) );
+			__m256i C = words[ 3 ];
+			__m256i F = _mm256_sub_epi32( words[ 4 ], broadcast( subkeys[ 126 ] ) );
+			__m256i E = words[ 5 ];
+			__m256i A = _mm256_sub_epi32( words[ 6 ], broadcast( subkeys[ 127 ] ) );
+			__m256i B = words[ 7 ];
+
+			decryptRoundLanes( E, C, H, B, G, A, F, D, subkeys + 2 * 62, subkeys + 62 );
+			decryptRoundLanes( A, B, C, D, E, F, G, H, subkeys + 2 * 61, subkeys + 61 );
+			for ( size_t j = 60; j >= 4; j -= 4 )
+			{
+				decryptRoundLanes( F, D, B, H, A, G, E, C, subkeys + 2 * j, subkeys + j );
+				decryptRoundLanes( G, H, D, C, F, E, A, B, subkeys + 2 * ( j - 1 ), subkeys + j - 1 );
+				decryptRoundLanes( E, C, H, B, G, A, F, D, subkeys + 2 * ( j - 2 ), subkeys + j - 2 );
+				decryptRoundLanes( A, B, C, D, E, F, G, H, subkeys + 2 * ( j - 3 ), subkeys + j - 3 );
+			}
+
+			words[ 0 ] = A;
+			words[ 1 ] = _mm256_sub_epi32( B, broadcast( subkeys[ 0 ] ) );
+			words[ 2 ] = C;
+			words[ 3 ] = _mm256_sub_epi32( D, broadcast( subkeys[ 1 ] ) );
+			words[ 4 ] = E;
+			words[ 5 ] = _mm256_sub_epi32( F, broadcast( subkeys[ 2 ] ) );
+			words[ 6 ] = G;
+			words[ 7 ] = _mm256_sub_epi32( H, broadcast( subkeys[ 3 ] ) );
+		}
+	}
+
+	size_t TitanWallEncryptBlocksAVX2( const uint8_t* input, uint8_t* output, size_t blockCount, const uint32_t subkeys[ 128 ] )
+	{
+		const size_t processedCount = blockCount - blockCount % Lanes;
+		__m256i words[ 8 ];
+		for ( size_t blockIndex = 0; blockIndex < processedCount; blockIndex += Lanes )
+		{
+			loadBlocks( input + blockIndex * BlockByteSize, words );
+			encryptLanes( words, subkeys );
+			storeBlocks( words, output + blockIndex * BlockByteSize );
+		}
+		return processedCount;
+	}
+
+	size_t TitanWallDecryptBlocksAVX2( const uint8_t* input, uint8_t* output, size_t blockCount, const uint32_t subkeys[ 128 ] )
+	{
+		const size_t processedCount = blockCount - blockCount % Lanes;
+		__m256i words[ 8 ];
+		for ( size_t blockIndex = 0; blockIndex < processedCount; blockIndex += Lanes )
+		{
+			loadBlocks( input + blockIndex * BlockByteSize, words );
+			decryptLanes( words, subkeys );
+			storeBlocks( words, output + blockIndex * BlockByteSize );
+		}
+		return processedCount;
+	}
+
+	size_t TitanWallCounterModeAVX2( const uint8_t* input, uint8_t* output, size_t blockCount, const uint32_t nonce[ 6 ], uint64_t counter, const uint32_t subkeys[ 128 ] )
+	{
+		const size_t processedCount = blockCount - blockCount % Lanes;
+		__m256i words[ 8 ];
+		alignas( 32 ) uint32_t lowCounters[ Lanes ], highCounters[ Lanes ];
+		for ( size_t blockIndex = 0; blockIndex < processedCount; blockIndex += Lanes )
+		{
+			// The counter blocks are built already transposed: the nonce words are the same in every lane
+			for ( size_t lane = 0; lane < Lanes; lane++ )
+			{
+				const uint64_t blockCounter = counter + blockIndex + lane;
+				lowCounters[ lane ] = static_cast<uint32_t>( blockCounter );
+				highCounters[ lane ] = static_cast<uint32_t>( blockCounter >> 32 );
+			}
+			for ( size_t i = 0; i < 6; i++ )
+				words[ i ] = broadcast( nonce[ i ] );
+			words[ 6 ] = _mm256_load_si256( reinterpret_cast<const __m256i*>( lowCounters ) );
+			words[ 7 ] = _mm256_load_si256( reinterpret_cast<const __m256i*>( highCounters ) );
+
+			encryptLanes( words, subkeys );
+			transposeLanes( words );
+			for ( size_t lane = 0; lane < Lanes; lane++ )
+			{
+				const size_t offset = ( blockIndex + lane ) * BlockByteSize;
+				const __m256i data = _mm256_loadu_si256( reinterpret_cast<const __m256i*>( input + offset ) );
+				_mm256_storeu_si256( reinterpret_cast<__m256i*>( output + offset ), _mm256_xor_si256( data, words[ lane ] ) );
+			}
+		}
+		return processedCount;
+	}
+}
@@ -0,0 +1,396 @@
+#pragma once
+
+#include <cstdint>
+#include <cstdlib>
+#include <cctype>
+#include <string>
+#include <string_view>
+#include <array>
+#include <span>
+#include <iostream>
+#include <utility>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#include <immintrin.h>
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#include <cpuid.h>
+#endif
+
+/*
+	Visual Studio accepts every intrinsic without /arch, so its projects always build the x86 kernels;
+	the CMake build defines these macros itself for the instruction sets it compiled kernels for (cmake/InstructionSetObjects.cmake).
+	Visual Studio 不需要 /arch 就接受所有内部函数, 因此其项目总是编译 x86 内核;
+	CMake 构建则只为编译了内核的指令集自行定义这些宏 (cmake/InstructionSetObjects.cmake)。
+*/
+#if defined(_MSC_VER) && !defined(__clang__) && (defined(_M_X64) || defined(_M_IX86))
+#if !defined(APPLIED_CRYPTOGRAPHY_HAS_SSE2_KERNELS)
+#define APPLIED_CRYPTOGRAPHY_HAS_SSE2_KERNELS 1
+#endif
+#if !defined(APPLIED_CRYPTOGRAPHY_HAS_AVX2_KERNELS)
+#define APPLIED_CRYPTOGRAPHY_HAS_AVX2_KERNELS 1
+#endif
+#if !defined(APPLIED_CRYPTOGRAPHY_HAS_AVX512_KERNELS)
+#define APPLIED_CRYPTOGRAPHY_HAS_AVX512_KERNELS 1
+#endif
+#endif
+
+/*
+	Runtime CPU feature detection and kernel dispatch.
+	The processor is queried once (CPUID and XGETBV, so AVX/AVX-512 also require the operating system to save their registers),
+	then every algorithm with SIMD kernels picks one table of function pointers from its candidates, best first.
+	The environment variable APPLIED_CRYPTOGRAPHY_CPU_FEATURES restricts the features seen by the dispatch, for benchmarking and testing:
+		none            only the portable kernels
+		sse2,avx2       only these features and the ones they are built on (still limited to what the processor has)
+		-avx512f,-sha   everything the processor has except these
+	Features can only be taken away, never added, and removing one also removes the features built on it (for example -avx2 removes AVX-512).
+
+	Kernel translation units are compiled with instruction set flags of their own, so they must not include this header,
+	the Support-Library or any other header with inline functions: the linker may keep their AVX copy of an inline function for the whole program.
+
+	运行时 CPU 特性检测与内核分派。
+	处理器只查询一次 (CPUID 与 XGETBV, 所以 AVX/AVX-512 还要求操作系统保存其寄存器),
+	之后每个带有 SIMD 内核的算法从候选者中 (最优者在前) 选出一张函数指针表。
+	环境变量 APPLIED_CRYPTOGRAPHY_CPU_FEATURES 用于基准测试和测试, 限制分派所看到的特性:
+		none            只用可移植内核
+		sse2,avx2       只用这些特性及其所依赖的特性 (仍然受限于处理器实际拥有的特性)
+		-avx512f,-sha   处理器拥有的全部特性, 除去这些
+	特性只能被去掉, 不能被添加; 去掉一个特性也会去掉建立在它之上的特性 (例如 -avx2 会去掉 AVX-512)。
+
+	内核翻译单元使用各自的指令集选项编译, 因此不能包含本头文件, Support-Library 或任何带有内联函数的头文件:
+	链接器可能为整个程序保留某个内联函数的 AVX 版本。
+*/
+namespace CommonToolkit::CPU_FeatureDispatch
+{
+	enum class CPU_Feature : std::uint32_t
+	{
+		SSE2 = 1U << 0,
+		SSSE3 = 1U << 1,
+		SSE41 = 1U << 2,
+		AVX = 1U << 3,
+		AVX2 = 1U << 4,
+		BMI2 = 1U << 5,
+		ADX = 1U << 6,
+		SHA = 1U << 7,
+		PCLMUL = 1U << 8,
+		AVX512F = 1U << 9,
+		AVX512DQ = 1U << 10,
+		AVX512BW = 1U << 11,
+		AVX512VL = 1U << 12,
+	};
+
+	//Bit set of CPU_Feature values
+	//CPU_Feature 值的位集合
+	using CPU_FeatureSet = std::uint32_t;
+
+	constexpr CPU_FeatureSet operator|(CPU_Feature Left, CPU_Feature Right)
+	{
+		return static_cast<CPU_FeatureSet>(Left) | static_cast<CPU_FeatureSet>(Right);
+	}
+
+	constexpr CPU_FeatureSet operator|(CPU_FeatureSet Left, CPU_Feature Right)
+	{
+		return Left | static_cast<CPU_FeatureSet>(Right);
+	}
+
+	constexpr CPU_FeatureSet NoFeatures = 0;
+
+	inline constexpr std::array<std::pair<CPU_Feature, std::string_view>, 13> FeatureNames
+	{{
+		{ CPU_Feature::SSE2, "sse2" },
+		{ CPU_Feature::SSSE3, "ssse3" },
+		{ CPU_Feature::SSE41, "sse4.1" },
+		{ CPU_Feature::AVX, "avx" },
+		{ CPU_Feature::AVX2, "avx2" },
+		{ CPU_Feature::BMI2, "bmi2" },
+		{ CPU_Feature::ADX, "adx" },
+		{ CPU_Feature::SHA, "sha" },
+		{ CPU_Feature::PCLMUL, "pclmul" },
+		{ CPU_Feature::AVX512F, "avx512f" },
+		{ CPU_Feature::AVX512DQ, "avx512dq" },
+		{ CPU_Feature::AVX512BW, "avx512bw" },
+		{ CPU_Feature::AVX512VL, "avx512vl" },
+	}};
+
+	//Feature -> feature it is built on; removing the second removes the first
+	//特性 -> 它所依赖的特性; 去掉后者也会去掉前者
+	inline constexpr std::array<std::pair<CPU_Feature, CPU_Feature>, 8> FeaturePrerequisites
+	{{
+		{ CPU_Feature::SSSE3, CPU_Feature::SSE2 },
+		{ CPU_Feature::SSE41, CPU_Feature::SSSE3 },
+		{ CPU_Feature::AVX, CPU_Feature::SSE41 },
+		{ CPU_Feature::AVX2, CPU_Feature::AVX },
+		{ CPU_Feature::AVX512F, CPU_Feature::AVX2 },
+		{ CPU_Feature::AVX512DQ, CPU_Feature::AVX512F },
+		{ CPU_Feature::AVX512BW, CPU_Feature::AVX512F },
+		{ CPU_Feature::AVX512VL, CPU_Feature::AVX512F },
+	}};
+
+	inline constexpr const char* FeatureOverrideVariable = "APPLIED_CRYPTOGRAPHY_CPU_FEATURES";
+
+	//Features of the processor, as reported by CPUID and enabled by the operating system
+	//处理器的特性, 由 CPUID 报告并由操作系统启用
+	inline CPU_FeatureSet DetectProcessorFeatures()
+	{
+		CPU_FeatureSet Features = NoFeatures;
+
+		#if (defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))) || ((defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__)))
+
+		auto QueryCPUID = [](std::uint32_t Leaf, std::uint32_t Subleaf, std::array<std::uint32_t, 4>& Registers)
+		{
+			#if defined(_MSC_VER)
+			int Values[4] {};
+			__cpuidex(Values, static_cast<int>(Leaf), static_cast<int>(Subleaf));
+			for (std::size_t Index = 0; Index < 4; ++Index)
+				Registers[Index] = static_cast<std::uint32_t>(Values[Index]);
+			#else
+			__cpuid_count(Leaf, Subleaf, Registers[0], Registers[1], Registers[2], Registers[3]);
+			#endif
+		};
+
+		auto HasBit = [](std::uint32_t Register, unsigned Bit) { return ((Register >> Bit) & 1U) != 0; };
+
+		std::array<std::uint32_t, 4> Registers {};	//EAX, EBX, ECX, EDX
+		QueryCPUID(0, 0, Registers);
+		const std::uint32_t MaximumLeaf = Registers[0];
+		if (MaximumLeaf < 1)
+			return Features;
+
+		QueryCPUID(1, 0, Registers);
+		const std::uint32_t Leaf1_ECX = Registers[2], Leaf1_EDX = Registers[3];
+
+		if (HasBit(Leaf1_EDX, 26))
+			Features |= static_cast<CPU_FeatureSet>(CPU_Feature::SSE2);
+		if (HasBit(Leaf1_ECX, 9))
+			Features |= static_cast<CPU_FeatureSet>(CPU_Feature::SSSE3);
+		if (HasBit(Leaf1_ECX, 19))
+			Features |= static_cast<CPU_FeatureSet>(CPU_Feature::SSE41);
+		if (HasBit(Leaf1_ECX, 1))
+			Features |= static_cast<CPU_FeatureSet>(CPU_Feature::PCLMUL);
+
+		//XCR0: bit 1 and 2 are the XMM/YMM state, bits 5 to 7 the opmask and ZMM state
+		//XCR0: 第1, 2位是 XMM/YMM 状态, 第5到7位是掩码寄存器与 ZMM 状态
+		std::uint64_t EnabledStates = 0;
+		if (HasBit(Leaf1_ECX, 27))
+		{
+			#if defined(_MSC_VER)
+			EnabledStates = _xgetbv(0);
+			#else
+			std::uint32_t Low = 0, High = 0;
+			__asm__ volatile("xgetbv" : "=a"(Low), "=d"(High) : "c"(0));
+			EnabledStates = (static_cast<std::uint64_t>(High) << 32) | Low;
+			#endif
+		}
+		const bool HasOS_AVX = (EnabledStates & 0x06) == 0x06;
+		const bool HasOS_AVX512 = (EnabledStates & 0xE6) == 0xE6;
+
+		if (HasOS_AVX && HasBit(Leaf1_ECX, 28))
+			Features |= static_cast<CPU_FeatureSet>(CPU_Feature::AVX);
+
+		if (MaximumLeaf >= 7)
+		{
+			QueryCPUID(7, 0, Registers);
+			const std::uint32_t Leaf7_EBX = Registers[1];
+
+			if (HasOS_AVX && HasBit(Leaf7_EBX, 5))
+				Features |= static_cast<CPU_FeatureSet>(CPU_Feature::AVX2);
+			if (HasBit(Leaf7_EBX, 8))
+				Features |= static_cast<CPU_FeatureSet>(CPU_Feature::BMI2);
+			if (HasBit(Leaf7_EBX, 19))
+				Features |= static_cast<CPU_FeatureSet>(CPU_Feature::ADX);
+			if (HasBit(Leaf7_EBX, 29))
+				Features |= static_cast<CPU_FeatureSet>(CPU_Feature::SHA);
+			if (HasOS_AVX512)
+			{
+				if (HasBit(Leaf7_EBX, 16))
+					Features |= static_cast<CPU_FeatureSet>(CPU_Feature::AVX512F);
+				if (HasBit(Leaf7_EBX, 17))
+					Features |= static_cast<CPU_FeatureSet>(CPU_Feature::AVX512DQ);
+				if (HasBit(Leaf7_EBX, 30))
+					Features |= static_cast<CPU_FeatureSet>(CPU_Feature::AVX512BW);
+				if (HasBit(Leaf7_EBX, 31))
+					Features |= static_cast<CPU_FeatureSet>(CPU_Feature::AVX512VL);
+			}
+		}
+
+		#endif
+
+		return Features;
+	}
+
+	//Drops every feature whose prerequisite is missing, repeating until nothing changes
+	//去掉所有缺少前置特性的特性, 重复直到不再变化
+	constexpr CPU_FeatureSet RemoveOrphanedFeatures(CPU_FeatureSet Features)
+	{
+		bool IsChanged = true;
+		while (IsChanged)
+		{
+			IsChanged = false;
+			for (const auto& [Feature, Prerequisite] : FeaturePrerequisites)
+			{
+				const auto FeatureBit = static_cast<CPU_FeatureSet>(Feature);
+				if ((Features & FeatureBit) != 0 && (Features & static_cast<CPU_FeatureSet>(Prerequisite)) == 0)
+				{
+					Features &= ~FeatureBit;
+					IsChanged = true;
+				}
+			}
+		}
+		return Features;
+	}
+
+	//Adds the prerequisites of every feature, so a kept "avx2" also keeps "avx" and the SSE levels below it
+	//加入每个特性的前置特性, 使保留的 "avx2" 也保留 "avx" 及其下的 SSE 级别
+	constexpr CPU_FeatureSet AddPrerequisiteFeatures(CPU_FeatureSet Features)
+	{
+		bool IsChanged = true;
+		while (IsChanged)
+		{
+			IsChanged = false;
+			for (const auto& [Feature, Prerequisite] : FeaturePrerequisites)
+			{
+				const auto PrerequisiteBit = static_cast<CPU_FeatureSet>(Prerequisite);
+				if ((Features & static_cast<CPU_FeatureSet>(Feature)) != 0 && (Features & PrerequisiteBit) == 0)
+				{
+					Features |= PrerequisiteBit;
+					IsChanged = true;
+				}
+			}
+		}
+		return Features;
+	}
+
+	/*
+		Applies an override string (syntax in the comment at the top of this file) to the detected features.
+		Unknown names are ignored, so an override written for a newer build still works.
+		把覆盖字符串 (语法见本文件顶部的注释) 应用到检测到的特性上; 未知的名字被忽略, 因此为较新构建写的覆盖仍然有效。
+	*/
+	inline CPU_FeatureSet ApplyFeatureOverride(CPU_FeatureSet DetectedFeatures, std::string_view Override)
+	{
+		CPU_FeatureSet KeptFeatures = NoFeatures;
+		CPU_FeatureSet RemovedFeatures = NoFeatures;
+		bool HasKeepList = false;
+
+		while (!Override.empty())
+		{
+			const std::size_t Separator = Override.find_first_of(", ");
+			std::string Name(Override.substr(0, Separator));
+			Override = Separator == std::string_view::npos ? std::string_view() : Override.substr(Separator + 1);
+			if (Name.empty())
+				continue;
+
+			for (char& Character : Name)
+				Character = static_cast<char>(std::tolower(static_cast<unsigned char>(Character)));
+
+			if (Name == "none")
+			{
+				HasKeepList = true;
+				continue;
+			}
+
+			const bool IsRemoval = Name.front() == '-';
+			const std::string_view FeatureName = IsRemoval ? std::string_view(Name).substr(1) : std::string_view(Name);
+			for (const auto& [Feature, KnownName] : FeatureNames)
+			{
+				if (KnownName != FeatureName)
+					continue;
+				if (IsRemoval)
+					RemovedFeatures |= static_cast<CPU_FeatureSet>(Feature);
+				else
+				{
+					KeptFeatures |= static_cast<CPU_FeatureSet>(Feature);
+					HasKeepList = true;
+				}
+			}
+		}
+
+		CPU_FeatureSet Features = HasKeepList ? (DetectedFeatures & AddPrerequisiteFeatures(KeptFeatures)) : DetectedFeatures;
+		return RemoveOrphanedFeatures(Features & ~RemovedFeatures);
+	}
+
+	inline std::string ReadFeatureOverride()
+	{
+		#if defined(_MSC_VER)
+		char* Value = nullptr;
+		std::size_t Length = 0;
+		if (_dupenv_s(&Value, &Length, FeatureOverrideVariable) != 0 || Value == nullptr)
+			return {};
+		std::string Result(Value);
+		std::free(Value);
+		return Result;
+		#else
+		const char* Value = std::getenv(FeatureOverrideVariable);
+		return Value != nullptr ? std::string(Value) : std::string();
+		#endif
+	}
+
+	//Features the dispatch may use: detected on first call (thread-safe), restricted by the environment override
+	//分派可以使用的特性: 第一次调用时检测 (线程安全), 并受环境变量覆盖限制
+	inline CPU_FeatureSet ActiveFeatures()
+	{
+		static const CPU_FeatureSet Features = ApplyFeatureOverride(DetectProcessorFeatures(), ReadFeatureOverride());
+		return Features;
+	}
+
+	inline bool HasFeatures(CPU_FeatureSet RequiredFeatures)
+	{
+		return (ActiveFeatures() & RequiredFeatures) == RequiredFeatures;
+	}
+
+	inline std::string FeatureSetToString(CPU_FeatureSet Features)
+	{
+		std::string Result;
+		for (const auto& [Feature, Name] : FeatureNames)
+		{
+			if ((Features & static_cast<CPU_FeatureSet>(Feature)) == 0)
+				continue;
+			if (!Result.empty())
+				Result += ',';
+			Result += Name;
+		}
+		return Result.empty() ? std::string("none") : Result;
+	}
+
+	/*
+		Picks the first kernel table whose RequiredFeatures are all active.
+		A table type is a struct of function pointers plus `const char* Name` and `CPU_FeatureSet RequiredFeatures`;
+		candidates are listed best first and the last one must need no features.
+		选出第一个 RequiredFeatures 全部可用的内核表。
+		表类型是一个函数指针结构体, 另有 `const char* Name` 与 `CPU_FeatureSet RequiredFeatures` 成员;
+		候选者按最优在前排列, 最后一个候选者必须不需要任何特性。
+	*/
+	template<typename KernelTableType>
+	const KernelTableType& SelectKernelTable(std::span<const KernelTableType* const> Candidates)
+	{
+		for (const KernelTableType* Candidate : Candidates)
+		{
+			if (HasFeatures(Candidate->RequiredFeatures))
+				return *Candidate;
+		}
+		return *Candidates.back();
+	}
+
+	//Checks the override syntax on a fixed feature set, independent of the processor running the test
+	//在固定的特性集合上检查覆盖语法, 与运行测试的处理器无关
+	inline void TestCPU_FeatureOverride()
+	{
+		constexpr CPU_FeatureSet AllFeatures = (1U << FeatureNames.size()) - 1;
+		constexpr CPU_FeatureSet UpToAVX2 = CPU_Feature::SSE2 | CPU_Feature::SSSE3 | CPU_Feature::SSE41 | CPU_Feature::AVX | CPU_Feature::AVX2;
+		constexpr CPU_FeatureSet AVX512Features = CPU_Feature::AVX512F | CPU_Feature::AVX512DQ | CPU_Feature::AVX512BW | CPU_Feature::AVX512VL;
+
+		bool IsPassed = true;
+		IsPassed &= ApplyFeatureOverride(AllFeatures, "") == AllFeatures;
+		IsPassed &= ApplyFeatureOverride(AllFeatures, "none") == NoFeatures;
+		IsPassed &= ApplyFeatureOverride(AllFeatures, "NONE,") == NoFeatures;
+		IsPassed &= ApplyFeatureOverride(AllFeatures, "avx2") == UpToAVX2;
+		IsPassed &= ApplyFeatureOverride(AllFeatures, "sse2, avx2,bmi2") == (UpToAVX2 | CPU_Feature::BMI2);
+		IsPassed &= ApplyFeatureOverride(AllFeatures, "-avx2") == (AllFeatures & ~(static_cast<CPU_FeatureSet>(CPU_Feature::AVX2) | AVX512Features));
+		IsPassed &= ApplyFeatureOverride(AllFeatures, "-avx512bw,-sha,unknown") == (AllFeatures & ~static_cast<CPU_FeatureSet>(CPU_Feature::AVX512BW) & ~static_cast<CPU_FeatureSet>(CPU_Feature::SHA));
+		//Features the processor lacks are never added
+		//处理器没有的特性永远不会被加入
+		IsPassed &= ApplyFeatureOverride(static_cast<CPU_FeatureSet>(CPU_Feature::SSE2), "avx512f") == static_cast<CPU_FeatureSet>(CPU_Feature::SSE2);
+
+		std::cout << "CPU features: " << FeatureSetToString(DetectProcessorFeatures()) << ", active: " << FeatureSetToString(ActiveFeatures()) << std::endl;
+		std::cout << "CPU feature override parsing: " << (IsPassed ? "passed" : "failed") << std::endl;
+	}
+}
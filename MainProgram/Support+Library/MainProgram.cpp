@@ -22,13 +22,39 @@
 
 auto main(int argument_cout, char* argument_vector[]) -> int
 {
+	#if defined(_WIN32)
 	std::system("chcp 65001");
+	#endif
 
 	ChinaShangYongMiMa::ZUC::TestZUC();
 
 	//BlockDataCryption::TinyEncryptionAlgorithmGroup::UnitTest();
+	//BlockDataCryption::TinyEncryptionAlgorithmGroup::TestXXTEALargeBuffer();
+	//BlockDataCryption::TinyEncryptionAlgorithmGroup::BenchmarkXXTEALargeBuffer();
+	//BlockDataCryption::TinyEncryptionAlgorithmGroup::TestTinyEncryptionAlgorithmUnrolled();
+	//BlockDataCryption::TinyEncryptionAlgorithmGroup::TestXTEABlocks();
 	//TestTitanWallBlockCipher();
+	//TestTitanWallBlockCipherRoundCore();
+	//TestTitanWallBlockCipherModes();
+	//TestTitanWallBlockKernels();
+	//BenchmarkTitanWallBlockCipher();
 	//TestTitanWallStreamCipher();
+	//TestTitanWallStreamCipherStreaming();
+	//TestTitanWallNLFSR();
+	//TestTitanWallMixPass();
+	//TestTitanWallKeySchedule();
+	//PseudoRandomNumberGenerators::TestBoundedRandom();
+	//PseudoRandomNumberGenerators::TestInversiveCongruentialGenerator();
+	//PseudoRandomNumberGenerators::TestLinearCongruentialGenerator();
+	//PseudoRandomNumberGenerators::TestBlumBlumShub();
+	//PseudoRandomNumberGenerators::TestMersenneTwisterBlock();
+	//PseudoRandomNumberGenerators::TestMersenneTwisterJump();
+	//PseudoRandomNumberGenerators::TestXorshiroLanes();
+	//PseudoRandomNumberGenerators::TestXorshiroJump();
+	//PseudoRandomNumberGenerators::TestXorShiftEngines();
+	//PseudoRandomNumberGenerators::TestLaggedFibonacciBlock();
+	//PseudoRandomNumberGenerators::TestComplementaryMultiplyWithCarry4096();
+	//CommonToolkit::CPU_FeatureDispatch::TestCPU_FeatureOverride();
 	//AllTestBitset();
 
 	#if 0
@@ -333,8 +333,8 @@ public:
 		MemoryAllocationIsTracked = value;
 	}
 
-	void* track_memory_with_new_operator(size_t size, MemoryTrackMap::AllocationMapType& memory_track_map) throw(...);
-	void track_memory_with_delete_operator(void* memory_pointer, MemoryTrackMap::AllocationMapType& memory_track_map) throw(...);
+	void* track_memory_with_new_operator(size_t size, MemoryTrackMap::AllocationMapType& memory_track_map) noexcept(false);
+	void track_memory_with_delete_operator(void* memory_pointer, MemoryTrackMap::AllocationMapType& memory_track_map) noexcept(false);
 
 	~MemoryTrackUsageInfo() = default;
 
@@ -352,7 +352,7 @@ private:
 /**
  * Use the std::map for new memory allocations to keep track of the size.
  **/
-inline void* MemoryTrackUsageInfo::track_memory_with_new_operator(size_t size, MemoryTrackMap::AllocationMapType& memory_track_map) throw(...)
+inline void* MemoryTrackUsageInfo::track_memory_with_new_operator(size_t size, MemoryTrackMap::AllocationMapType& memory_track_map) noexcept(false)
 {
 	bool& _MemoryAllocationIsTracked { MemoryAllocationIsTracked };
 
@@ -405,7 +405,7 @@ inline void* MemoryTrackUsageInfo::track_memory_with_new_operator(size_t size, M
  * Deletes something from the allocated new memory space recorded with std::map.
  **/
 
-inline void MemoryTrackUsageInfo::track_memory_with_delete_operator(void* memory_pointer, MemoryTrackMap::AllocationMapType& memory_track_map) throw(...)
+inline void MemoryTrackUsageInfo::track_memory_with_delete_operator(void* memory_pointer, MemoryTrackMap::AllocationMapType& memory_track_map) noexcept(false)
 {
 	bool& _MemoryAllocationIsTracked { MemoryAllocationIsTracked };
 
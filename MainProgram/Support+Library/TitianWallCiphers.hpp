@@ -12,6 +12,34 @@
 #include <array>
 #include <vector>
 #include <tuple>
+#include <span>
+#include <bit>
+#include <cstring>
+
+#include <random>
+#include <chrono>
+#include <thread>
+#include <algorithm>
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#endif
+
+#include "CPU_FeatureDispatch.hpp"
+#include "../../BlockDataCryption/TitianWallCiphersKernels.h"
+
+// 时间戳计数器 (参考时钟周期), 不支持的平台返回0
+// Reads the time stamp counter (reference cycles); returns 0 on platforms without one
+inline std::uint64_t read_cycle_counter()
+{
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+	return __rdtsc();
+#elif defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+	return __builtin_ia32_rdtsc();
+#else
+	return 0;
+#endif
+}
 
 inline bool is_system_little_endian()
 {
@@ -155,53 +183,124 @@ protected:
 		KDSB[Counter % KDSB.size()] += KDSB[Counter % KDSB.size()] - MathMagicNumbers[RandomPosition % 4];
 	}
 
+	//Referenced: https://en.wikipedia.org/wiki/KeeLoq
+	//原始的逐位布尔形式的反馈函数 (参考实现), 只依赖第 31, 28, 23, 17, 16, 13, 4, 1, 0 位
+	static constexpr bool NLFSRFeedBack(uint32_t Register)
+	{
+		//PrimerNumbers: 2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37, 41, 43, 47, 53, 59, 61
+		bool BinaryA = ((Register >> 31) & 1);
+		bool BinaryB = ((Register >> 29 - 1) & 1);
+		bool BinaryC = ((Register >> 23) & 1);
+		bool BinaryD = ((Register >> 19 - 2) & 1);
+		bool BinaryE = ((Register >> 13) & 1);
+		bool BinaryF = ((Register >> 7 - 3) & 1);
+		bool BinaryG = ((Register >> 1) & 1);
+
+		bool BinaryH = ((Register >> 16) & 1) ^ (Register & 1);
+
+		//Feedback Function
+		bool FeedBack0 = (BinaryB != BinaryG) != (BinaryA != BinaryF);
+		bool FeedBack1 = (BinaryA && BinaryD) != (BinaryA && BinaryG);
+		bool FeedBack2 = (BinaryB && BinaryC) != (BinaryB && BinaryD) != (BinaryB && BinaryE);
+		bool FeedBack3 = (BinaryE && BinaryF) == (BinaryD && BinaryF) == (BinaryC && BinaryF);
+		bool FeedBack4 = (BinaryF && BinaryG) == (BinaryE && BinaryG) == (BinaryD && BinaryG);
+		bool FeedBack5 = (BinaryA && BinaryB && BinaryG) != (BinaryA && BinaryD && BinaryG) != (BinaryA && BinaryF && BinaryG);
+		bool FeedBack6 = (BinaryA && BinaryB && BinaryC) != (BinaryB && BinaryC && BinaryD) != (BinaryC && BinaryD && BinaryE) != (BinaryD && BinaryE && BinaryF) != (BinaryE && BinaryF && BinaryG);
+		bool FeedBack7 = (BinaryA && BinaryC && BinaryE && BinaryG) != (BinaryB && BinaryD && BinaryF);
+
+		bool FeedBack = BinaryH != FeedBack0 != FeedBack1 != FeedBack2 != FeedBack3 != FeedBack4 != FeedBack5 != FeedBack6 != FeedBack7;
+		return FeedBack;
+	}
+
 	uint32_t NLFSR(uint32_t Register)
 	{
-		//Referenced: https://en.wikipedia.org/wiki/KeeLoq
 		for ( size_t NLFSR_ROUND = 0; NLFSR_ROUND < 64; ++NLFSR_ROUND )
 		{
-			//PrimerNumbers: 2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37, 41, 43, 47, 53, 59, 61
-			bool BinaryA = ((Register >> 31) & 1);
-			bool BinaryB = ((Register >> 29 - 1) & 1);
-			bool BinaryC = ((Register >> 23) & 1);
-			bool BinaryD = ((Register >> 19 - 2) & 1);
-			bool BinaryE = ((Register >> 13) & 1);
-			bool BinaryF = ((Register >> 7 - 3) & 1);
-			bool BinaryG = ((Register >> 1) & 1);
-
-			bool BinaryH = ((Register >> 16) & 1) ^ (Register & 1);
+			bool FeedBack = NLFSRFeedBack(Register);
 
 			//Right Shift Register
 			Register >>= 1;
-		
-			//Feedback Function
-			bool FeedBack0 = (BinaryB != BinaryG) != (BinaryA != BinaryF);
-			bool FeedBack1 = (BinaryA && BinaryD) != (BinaryA && BinaryG);
-			bool FeedBack2 = (BinaryB && BinaryC) != (BinaryB && BinaryD) != (BinaryB && BinaryE);
-			bool FeedBack3 = (BinaryE && BinaryF) == (BinaryD && BinaryF) == (BinaryC && BinaryF);
-			bool FeedBack4 = (BinaryF && BinaryG) == (BinaryE && BinaryG) == (BinaryD && BinaryG);
-			bool FeedBack5 = (BinaryA && BinaryB && BinaryG) != (BinaryA && BinaryD && BinaryG) != (BinaryA && BinaryF && BinaryG);
-			bool FeedBack6 = (BinaryA && BinaryB && BinaryC) != (BinaryB && BinaryC && BinaryD) != (BinaryC && BinaryD && BinaryE) != (BinaryD && BinaryE && BinaryF) != (BinaryE && BinaryF && BinaryG);
-			bool FeedBack7 = (BinaryA && BinaryC && BinaryE && BinaryG) != (BinaryB && BinaryD && BinaryF);
-
-			bool FeedBack = BinaryH != FeedBack0 != FeedBack1 != FeedBack2 != FeedBack3 != FeedBack4 != FeedBack5 != FeedBack6 != FeedBack7;
 			Register ^= static_cast<uint64_t>( FeedBack ) << 31;
-			//std::cout << "Register: "<< Register << std::endl;
-			//std::cout << "Register (hex): " << std::hex << Register << std::endl;
 		}
 
 		return Register;
 	}
 
-	void ComplexMix(size_t Counter, uint64_t& RandomIndex)
+	/*
+		按字并行 (SWAR) 的反馈函数: 两个32位寄存器分别占64位字的高低两半 (两个通道), 用整字的 AND/XOR 同时计算.
+		Word-parallel feedback: two 32-bit registers share one 64-bit word, one per half.
+		Each tap is shifted down to bit 0 of its lane, and the feedback is evaluated in algebraic normal form
+		(!= is XOR, a chain x == y == z equals x ^ y ^ z), so only the lowest bit of each lane is meaningful.
+		With a = bit 31, b = 28, c = 23, d = 17, e = 13, f = 4, g = 1 and h = bit 16 ^ bit 0:
+			FeedBack = h ^ a ^ b ^ f ^ g ^ a(d ^ g) ^ (b ^ f)(c ^ d ^ e) ^ g(d ^ e ^ f) ^ ag(b ^ d ^ f)
+			         ^ abc ^ bcd ^ cde ^ def ^ efg ^ aceg ^ bdf
+		The lowest bit of each lane only reads bits of the same lane because every shift goes right.
+		Bit 31 is both a tap and the feedback target, so each step depends on the one before it; the steps themselves cannot be batched.
+	*/
+	static constexpr uint64_t NLFSRFeedBackLanes(uint64_t Registers)
 	{
-		uint32_t RegisterLeft = RandomIndex >> 32;
-		uint32_t RegisterRight = RandomIndex & 0x00000000FFFFFFFF;
-		
-		RegisterLeft = NLFSR(RegisterLeft);
-		RegisterRight = NLFSR(RegisterRight);
+		const uint64_t a = Registers >> 31;
+		const uint64_t b = Registers >> 28;
+		const uint64_t c = Registers >> 23;
+		const uint64_t d = Registers >> 17;
+		const uint64_t e = Registers >> 13;
+		const uint64_t f = Registers >> 4;
+		const uint64_t g = Registers >> 1;
+		const uint64_t h = (Registers >> 16) ^ Registers;
+
+		return h ^ a ^ b ^ f ^ g
+			^ (a & (d ^ g))
+			^ ((b ^ f) & (c ^ d ^ e))
+			^ (g & (d ^ e ^ f))
+			^ (a & g & (b ^ d ^ f))
+			^ (a & b & c) ^ (b & c & d) ^ (c & d & e) ^ (d & e & f) ^ (e & f & g)
+			^ (a & c & e & g) ^ (b & d & f);
+	}
+
+	// 遍历9个抽头位的全部 2^9 种取值 (两个通道取不同的值), 证明两种反馈函数相等
+	static constexpr bool VerifyNLFSRFeedBackLanes()
+	{
+		constexpr std::array<uint32_t, 9> TapPositions {31, 28, 23, 17, 16, 13, 4, 1, 0};
+
+		auto SpreadTaps = [&](uint32_t TapBits)
+		{
+			uint32_t Register = 0;
+			for (size_t Index = 0; Index < TapPositions.size(); ++Index)
+				Register |= ((TapBits >> Index) & 1) << TapPositions[Index];
+			return Register;
+		};
+
+		for (uint32_t TapBits = 0; TapBits < (1U << TapPositions.size()); ++TapBits)
+		{
+			const uint32_t HighRegister = SpreadTaps(TapBits);
+			const uint32_t LowRegister = SpreadTaps(TapBits ^ 0x155);
+			const uint64_t FeedBacks = NLFSRFeedBackLanes(uint64_t(HighRegister) << 32 | LowRegister);
+
+			if (((FeedBacks >> 32) & 1) != uint64_t(NLFSRFeedBack(HighRegister)) || (FeedBacks & 1) != uint64_t(NLFSRFeedBack(LowRegister)))
+				return false;
+		}
+		return true;
+	}
+
+	// 两个通道同时运行 NLFSR, 等价于分别对高32位和低32位调用 NLFSR
+	uint64_t NLFSRTwoLanes(uint64_t Registers)
+	{
+		static_assert(VerifyNLFSRFeedBackLanes(), "NLFSRFeedBackLanes must match NLFSRFeedBack for every tap combination");
+
+		constexpr uint64_t LaneLowBits = 0x0000000100000001;
+		constexpr uint64_t LaneShiftMask = 0x7FFFFFFF7FFFFFFF;
 
-		RandomIndex = uint64_t(RegisterRight) << 32 | uint64_t(RegisterLeft);
+		for ( size_t NLFSR_ROUND = 0; NLFSR_ROUND < 64; ++NLFSR_ROUND )
+			Registers = ((Registers >> 1) & LaneShiftMask) | ((NLFSRFeedBackLanes(Registers) & LaneLowBits) << 31);
+
+		return Registers;
+	}
+
+	void ComplexMix(size_t Counter, uint64_t& RandomIndex)
+	{
+		//RegisterLeft = NLFSR(RandomIndex >> 32), RegisterRight = NLFSR(RandomIndex & 0xFFFFFFFF)
+		//RandomIndex = RegisterRight << 32 | RegisterLeft
+		RandomIndex = std::rotl(NLFSRTwoLanes(RandomIndex), 32);
 
 		KDSB[Counter % KDSB.size()] ^= KDSB[(Counter - 2 + KDSB.size()) % KDSB.size()] ^ KDSB[(Counter - 1) % KDSB.size()];
 		
@@ -217,9 +316,174 @@ protected:
 		KDSB[(Counter + 2) % KDSB.size()] += L(KDSB[(Counter + 1) % KDSB.size()] + MathMagicNumbers[(RandomIndex - Counter) % 4]);
 	}
 
+	/*
+		一整遍混合: 对 Counter = 0 .. 127 依次执行 MixWithAddSubtract, RandomAccessMix, ComplexMix, 结果与逐个调用这三个函数完全相同.
+		One mixing pass, bit-exact with calling MixWithAddSubtract, RandomAccessMix and ComplexMix for Counter = 0 .. 127.
+		KDSB has a power-of-two size, so every % KDSB.size() and % 4 becomes a mask (unsigned wrap-around keeps (Counter - 1) % 128 == (Counter - 1) & 127).
+		The FF/GG phase test (Counter < 96) is hoisted by splitting the loop in two.
+		KDSB[Counter - 3 .. Counter + 2] roll through MixWindow; every write still goes to KDSB because RandomAccessMix may read any element.
+	*/
+	struct MixWindow
+	{
+		//KDSB[Counter - 3], KDSB[Counter - 2], KDSB[Counter - 1], KDSB[Counter], KDSB[Counter + 1], KDSB[Counter + 2]
+		uint32_t Previous3, Previous2, Previous1, Current, Next1, Next2;
+	};
+
+	template <bool IsLinearPhase>
+	void MixStep(size_t Counter, uint64_t& RandomIndex, MixWindow& Window)
+	{
+		constexpr size_t KDSBMask = std::tuple_size_v<decltype(KDSB)> - 1;
+		const size_t CounterNext1 = (Counter + 1) & KDSBMask;
+		const size_t CounterNext2 = (Counter + 2) & KDSBMask;
+		auto& [Previous3, Previous2, Previous1, Current, Next1, Next2] = Window;
+
+		//MixWithAddSubtract
+		RandomIndex ^= Current + MathMagicNumbers[Counter & 3];
+		Current += Next1 - MathMagicNumbers[(RandomIndex + Counter) & 3];
+		RandomIndex ^= Next1 + MathMagicNumbers[(RandomIndex - Counter) & 3];
+		Next1 -= Current - MathMagicNumbers[(RandomIndex + Counter) & 3];
+		KDSB[Counter] = Current;
+		KDSB[CounterNext1] = Next1;
+
+		//RandomAccessMix
+		const size_t RandomPosition = RandomIndex & KDSBMask;
+		Current ^= KDSB[RandomPosition];
+		Current += Current - MathMagicNumbers[RandomPosition & 3];
+
+		//ComplexMix
+		RandomIndex = std::rotl(NLFSRTwoLanes(RandomIndex), 32);
+
+		Current ^= Previous2 ^ Previous1;
+
+		const uint32_t CounterWord = static_cast<uint32_t>(Counter);
+		const uint32_t RandomWord = static_cast<uint32_t>(RandomIndex % std::numeric_limits<uint32_t>::max());
+		const uint32_t LinearPrevious2 = L(Previous2);
+		if constexpr (IsLinearPhase)
+		{
+			Current += CounterWord ^ Previous1 ^ RandomWord;
+			Current -= Previous3 ^ LinearPrevious2 ^ Previous1;
+		}
+		else
+		{
+			Current += (CounterWord & Previous1) | (~CounterWord & RandomWord);
+			Current -= (Previous3 & LinearPrevious2) | (Previous3 & Previous1) | (LinearPrevious2 & Previous1);
+		}
+
+		RandomIndex ^= L(Current - MathMagicNumbers[Counter & 3]);
+		Next1 -= L2(Current + MathMagicNumbers[(RandomIndex - Counter) & 3]);
+		RandomIndex ^= L2(Current - MathMagicNumbers[(RandomIndex + Counter) & 3]);
+		Next2 += L(Next1 + MathMagicNumbers[(RandomIndex - Counter) & 3]);
+		KDSB[Counter] = Current;
+		KDSB[CounterNext1] = Next1;
+		KDSB[CounterNext2] = Next2;
+
+		//Slide the window to Counter + 1
+		Previous3 = Previous2;
+		Previous2 = Previous1;
+		Previous1 = Current;
+		Current = Next1;
+		Next1 = Next2;
+		Next2 = KDSB[(Counter + 3) & KDSBMask];
+	}
+
+	void MixPass(uint64_t& RandomIndex)
+	{
+		constexpr size_t KDSBSize = std::tuple_size_v<decltype(KDSB)>;
+		static_assert(std::has_single_bit(KDSBSize), "MixPass masks indices, so KDSB must have a power-of-two size");
+
+		//FF/GG: A ^ B ^ C for Counter < (ArraySize / 4) * 3, nonlinear afterwards
+		constexpr size_t LinearPhaseEnd = (KDSBSize / 4) * 3;
+
+		MixWindow Window { KDSB[KDSBSize - 3], KDSB[KDSBSize - 2], KDSB[KDSBSize - 1], KDSB[0], KDSB[1], KDSB[2] };
+
+		size_t Counter = 0;
+		for (; Counter < LinearPhaseEnd; Counter++)
+			MixStep<true>(Counter, RandomIndex, Window);
+		for (; Counter < KDSBSize; Counter++)
+			MixStep<false>(Counter, RandomIndex, Window);
+	}
+
+	//两次替换合并成一个表: 低8位为 ByteSubstitutionBoxA[ByteSubstitutionBoxA[x]], 高8位为 ByteSubstitutionBoxB[ByteSubstitutionBoxB[x]]
+	static constexpr std::array<std::uint16_t, 256> DoubleByteSubstitutionBox = []()
+	{
+		std::array<std::uint16_t, 256> Box {};
+		for (size_t Index = 0; Index < Box.size(); ++Index)
+			Box[Index] = static_cast<std::uint16_t>(ByteSubstitutionBoxA[ByteSubstitutionBoxA[Index]] | ByteSubstitutionBoxB[ByteSubstitutionBoxB[Index]] << 8);
+		return Box;
+	}();
+
+	//清零密钥材料 (volatile 写入, 不会被当作无用存储优化掉)
+	static void ClearWords(std::span<std::uint32_t> Words)
+	{
+		volatile std::uint32_t* Pointer = Words.data();
+		for (size_t Index = 0; Index < Words.size(); ++Index)
+			Pointer[Index] = 0;
+	}
+
+	//Key bytes (A, B, C, D) at KeyBlockIndex * 4, zero padded, packed as D B C A after the double substitution (same as ReferenceKeySchedule)
+	static std::uint32_t LoadKeyBlock(std::span<const std::uint8_t> KeyBytes, size_t KeyBlockIndex)
+	{
+		std::array<std::uint8_t, 4> Bytes {};
+		const size_t ByteCount = std::min<size_t>(4, KeyBytes.size() - KeyBlockIndex * 4);
+		std::memcpy(Bytes.data(), KeyBytes.data() + KeyBlockIndex * 4, ByteCount);
+
+		std::uint32_t Word = 0;
+		std::memcpy(&Word, Bytes.data(), 4);
+
+		//Byte k of the key sits at bit 8k on a little-endian system and at bit 24 - 8k on a big-endian one
+		constexpr bool IsLittleEndian = std::endian::native == std::endian::little;
+		const std::uint16_t SubstitutedA = DoubleByteSubstitutionBox[(Word >> (IsLittleEndian ? 0 : 24)) & 0xFF];
+		const std::uint16_t SubstitutedB = DoubleByteSubstitutionBox[(Word >> (IsLittleEndian ? 8 : 16)) & 0xFF];
+		const std::uint16_t SubstitutedC = DoubleByteSubstitutionBox[(Word >> (IsLittleEndian ? 16 : 8)) & 0xFF];
+		const std::uint16_t SubstitutedD = DoubleByteSubstitutionBox[(Word >> (IsLittleEndian ? 24 : 0)) & 0xFF];
+
+		//Byte Order Change: D C B A -> D B C A; A and B use box A (low byte), C and D use box B (high byte)
+		std::uint32_t KeyBlock = uint32_t(SubstitutedD >> 8) << 24 | uint32_t(SubstitutedB & 0xFF) << 16 | uint32_t(SubstitutedC >> 8) << 8 | uint32_t(SubstitutedA & 0xFF);
+
+		if constexpr (!IsLittleEndian)
+		{
+			//Byte swap 32-bits
+			KeyBlock = ((KeyBlock & 0x000000FF) << 24) | ((KeyBlock & 0x0000FF00) << 8) | ((KeyBlock & 0x00FF0000) >> 8) | ((KeyBlock & 0xFF000000) >> 24);
+		}
+		return KeyBlock;
+	}
+
 public:
 
-	void KeySchedule(const std::vector<std::uint8_t>& KeyBytes)
+	/*
+		不分配堆内存的密钥编排, 结果与 ReferenceKeySchedule 完全相同.
+		Key schedule without heap allocation, bit-exact with ReferenceKeySchedule.
+		The key words are loaded straight from the caller's bytes into a 128-word stack scratch, which is cleared afterwards.
+		ReferenceKeySchedule always leaves its chunk loop after the first 128 key blocks (offset - index is 0 or wraps around),
+		so only the first 512 key bytes take part and the State feedback between chunks never runs; this version does exactly that.
+	*/
+	void KeySchedule(std::span<const std::uint8_t> KeyBytes)
+	{
+		if (KeyBytes.empty())
+		{
+			return;
+		}
+
+		const size_t KeyBlockCount = std::min((KeyBytes.size() + 3) / 4, KDSB.size());
+
+		std::array<std::uint32_t, 128> KeyBlocks {};
+		for (size_t Index = 0; Index < KeyBlockCount; ++Index)
+			KeyBlocks[Index] = LoadKeyBlock(KeyBytes, Index);
+
+		std::copy_n(KeyBlocks.begin(), KeyBlockCount, KDSB.begin());
+		ClearWords(KeyBlocks);
+
+		uint64_t RandomIndex = 0;
+
+		//Pseudo Random Function
+		//伪随机函数
+		for (size_t Round = 0; Round < 4; Round++)
+			MixPass(RandomIndex);
+	}
+
+	// 原始的密钥编排 (逐字节补齐, 运行时判断字节序), 保留用于回归测试
+	// Original key schedule, kept for regression tests
+	void ReferenceKeySchedule(const std::vector<std::uint8_t>& KeyBytes)
 	{
 		if (KeyBytes.empty())
 		{
@@ -300,14 +564,7 @@ public:
 			//Pseudo Random Function
 			//伪随机函数
 			for (size_t Round = 0; Round < 4; Round++)
-			{
-				for (size_t Counter = 0; Counter < KDSB.size(); Counter++)
-				{
-					MixWithAddSubtract(Counter, RandomIndex);
-					RandomAccessMix(Counter, RandomIndex);
-					ComplexMix(Counter, RandomIndex);
-				}
-			}
+				MixPass(RandomIndex);
 
 			if(index >= KDSB.size())
 			{
@@ -331,6 +588,18 @@ public:
 	}
 };
 
+// 字节接口的状态码, Status of the span based cipher interfaces
+enum class TitanWallStatus : std::uint8_t
+{
+	Success,
+	// 字节长度不是分组大小的整数倍, The byte length is not a multiple of the block size
+	UnalignedLength,
+	// 输出缓冲区与输入长度不一致, The output buffer size does not match the input size
+	BufferSizeMismatch,
+	// 流密码尚未设置密钥, The stream cipher has no key
+	KeyNotSet
+};
+
 class TitanWallStreamCipher : public CryptographicFunctions
 {
 private:
@@ -340,9 +609,39 @@ private:
 	//PRNG State Register
 	std::array<std::uint32_t, 128> State {};
 
+	//State 中下一个未读取字节的位置, 等于 StateByteSize 表示需要刷新
+	size_t StateByteOffset = 128 * sizeof(std::uint32_t);
+
+	void RefreshState()
+	{
+		uint64_t RandomIndex = 0;
+
+		for ( size_t i = 0; i < KDSB.size(); i++ )
+		{
+			KDSB[i] += State[i] & 0xFFFF0000;
+			KDSB[i] ^= State[i] & 0x0000FFFF;
+
+			//Pseudo Random Function
+			//伪随机函数
+			for (size_t Round = 0; Round < 4; Round++)
+				MixPass(RandomIndex);
+
+			State[i] ^= KDSB[i] & 0xFFFF0000;
+			State[i] += KDSB[i] & 0x0000FFFF;
+		}
+
+		StateByteOffset = 0;
+	}
+
+	// 1 32-bits unpacking into 4 8-bits
+	std::uint8_t StateByte(size_t ByteOffset) const
+	{
+		return static_cast<std::uint8_t>(State[ByteOffset / 4] >> (8 * (ByteOffset % 4)));
+	}
+
 public:
 
-	explicit TitanWallStreamCipher(const std::vector<std::uint8_t>& KeyBytes) 
+	explicit TitanWallStreamCipher(std::span<const std::uint8_t> KeyBytes) 
 	{
 		// 生成子密钥
 		KeySchedule(KeyBytes);
@@ -354,50 +653,74 @@ public:
 		ResetState();
 	}
 
-	void GeneratePseudoRandomBytes(std::vector<std::uint8_t>& Bytes)
-	{
-		if(Bytes.empty())
-			return;
+	// 每次刷新 State 后可读取的字节数
+	static constexpr size_t StateByteSize = 128 * sizeof(std::uint32_t);
 
+	/*
+		流式输出: 密钥流是每次刷新后 State 的字节 (每个字按小端序拆成4个字节) 依次拼接而成.
+		The keystream is the little-endian bytes of State after each refresh, concatenated.
+		StateByteOffset is the read cursor into the current State; the mix only runs again once all StateByteSize bytes have been read.
+		Requests of any length are filled completely and may span several refreshes.
+	*/
+	[[nodiscard]] TitanWallStatus GenerateKeyStream(std::span<std::uint8_t> Bytes)
+	{
 		if(!IsKeyUsed)
-			return;
-
-		uint64_t RandomIndex = 0;
+			return TitanWallStatus::KeyNotSet;
 
-		for ( size_t i = 0; i < KDSB.size(); i++ )
+		for (size_t Offset = 0; Offset < Bytes.size();)
 		{
-			KDSB[i] += State[i] & 0xFFFF0000;
-			KDSB[i] ^= State[i] & 0x0000FFFF;
+			if (StateByteOffset == StateByteSize)
+				RefreshState();
 
-			//Pseudo Random Function
-			//伪随机函数
-			for (size_t Round = 0; Round < 4; Round++)
-			{
-				for (size_t Counter = 0; Counter < KDSB.size(); Counter++)
-				{
-					MixWithAddSubtract(Counter, RandomIndex);
-					RandomAccessMix(Counter, RandomIndex);
-					ComplexMix(Counter, RandomIndex);
-				}
-			}
+			const size_t Count = std::min(Bytes.size() - Offset, StateByteSize - StateByteOffset);
+			for (size_t i = 0; i < Count; i++)
+				Bytes[Offset + i] = StateByte(StateByteOffset + i);
 
-			State[i] ^= KDSB[i] & 0xFFFF0000;
-			State[i] += KDSB[i] & 0x0000FFFF;
+			Offset += Count;
+			StateByteOffset += Count;
 		}
 
-		// 1 32-bits unpacking into 4 8-bits
-		for (size_t i = 0; i < State.size() && (i * 4) < Bytes.size(); i++)
+		return TitanWallStatus::Success;
+	}
+
+	// 加密/解密: Output = Input ^ 密钥流, Input 与 Output 可以是同一个缓冲区
+	[[nodiscard]] TitanWallStatus Process(std::span<const std::uint8_t> Input, std::span<std::uint8_t> Output)
+	{
+		if(Output.size() != Input.size())
+			return TitanWallStatus::BufferSizeMismatch;
+		if(!IsKeyUsed)
+			return TitanWallStatus::KeyNotSet;
+
+		for (size_t Offset = 0; Offset < Input.size();)
 		{
-			std::uint32_t value = State[i];
-			for (int j = 0; j < 4 && ((i * 4) + j) < Bytes.size(); j++)
-			{
-				Bytes[i * 4 + j] = static_cast<std::uint8_t>(value & 0xFF);
-				value >>= 8;
-			}
+			if (StateByteOffset == StateByteSize)
+				RefreshState();
+
+			const size_t Count = std::min(Input.size() - Offset, StateByteSize - StateByteOffset);
+			for (size_t i = 0; i < Count; i++)
+				Output[Offset + i] = Input[Offset + i] ^ StateByte(StateByteOffset + i);
+
+			Offset += Count;
+			StateByteOffset += Count;
 		}
+
+		return TitanWallStatus::Success;
+	}
+
+	// 每次调用都先刷新 State 再从头读取, 因此前512字节与以前的版本相同; 更长的请求会继续刷新, 不再留下未填充的字节
+	void GeneratePseudoRandomBytes(std::vector<std::uint8_t>& Bytes)
+	{
+		if(Bytes.empty())
+			return;
+
+		if(!IsKeyUsed)
+			return;
+
+		StateByteOffset = StateByteSize;
+		(void)GenerateKeyStream(Bytes);
 	}
 
-	void InitialState(const std::vector<std::uint8_t>& KeyBytes)
+	void InitialState(std::span<const std::uint8_t> KeyBytes)
 	{
 		ResetState();
 		KeySchedule(KeyBytes);
@@ -406,17 +729,40 @@ public:
 
 	void ResetState()
 	{
-		const std::vector<uint32_t> ZeroNumbers(128, 0x00);
-
-		memmove(State.data(), ZeroNumbers.data(), 128 * sizeof(uint32_t));
-		memmove(KDSB.data(), ZeroNumbers.data(), 128 * sizeof(uint32_t));
+		ClearWords(State);
+		ClearWords(KDSB);
+		StateByteOffset = StateByteSize;
 		IsKeyUsed = false;
 	}
 };
 
+// 一个多分组内核的函数指针表 (见 BlockDataCryption/TitianWallCiphersKernels.h), 运行时按 CPU 特性选择
+// Function pointer table of one multi-block TitanWall kernel (see BlockDataCryption/TitianWallCiphersKernels.h), selected at runtime by CPU features
+struct TitanWallBlockKernels
+{
+	const char* Name;
+	CommonToolkit::CPU_FeatureDispatch::CPU_FeatureSet RequiredFeatures;
+	// All three return how many leading blocks they processed
+	std::size_t (*EncryptBlocks)(const std::uint8_t* input, std::uint8_t* output, std::size_t blockCount, const std::uint32_t subkeys[128]);
+	std::size_t (*DecryptBlocks)(const std::uint8_t* input, std::uint8_t* output, std::size_t blockCount, const std::uint32_t subkeys[128]);
+	std::size_t (*CounterMode)(const std::uint8_t* input, std::uint8_t* output, std::size_t blockCount, const std::uint32_t nonce[6], std::uint64_t counter, const std::uint32_t subkeys[128]);
+};
+
 class TitanWallBlockCipher : public CryptographicFunctions
 {
 private:
+	// 可移植内核不处理任何分组, 全部交给单分组代码
+	// The portable kernel processes no blocks and leaves all of them to the one-block code
+	static std::size_t NoBlocks(const std::uint8_t*, std::uint8_t*, std::size_t, const std::uint32_t*)
+	{
+		return 0;
+	}
+
+	static std::size_t NoCounterBlocks(const std::uint8_t*, std::uint8_t*, std::size_t, const std::uint32_t*, std::uint64_t, const std::uint32_t*)
+	{
+		return 0;
+	}
+
 	// 伪哈达玛德变换
 	void PHT(std::uint32_t& a, std::uint32_t& b)
 	{
@@ -435,9 +781,179 @@ private:
 		b = (b - temp_a) & 0xFFFFFFFF;
 	}
 
+	// 字节序转换 (分组字节按小端序解释), Block bytes are interpreted as little-endian words
+	static constexpr std::uint32_t LittleEndianWord(std::uint32_t value)
+	{
+		if constexpr (std::endian::native == std::endian::big)
+			return (value >> 24) | ((value >> 8) & 0x0000FF00) | ((value << 8) & 0x00FF0000) | (value << 24);
+		else
+			return value;
+	}
+
+	static void LoadBlock(const std::uint8_t* bytes, std::array<std::uint32_t, 8>& block)
+	{
+		std::memcpy(block.data(), bytes, BlockByteSize);
+		if constexpr (std::endian::native == std::endian::big)
+			for (auto& word : block)
+				word = LittleEndianWord(word);
+	}
+
+	static void StoreBlock(std::array<std::uint32_t, 8>& block, std::uint8_t* bytes)
+	{
+		if constexpr (std::endian::native == std::endian::big)
+			for (auto& word : block)
+				word = LittleEndianWord(word);
+		std::memcpy(bytes, block.data(), BlockByteSize);
+	}
+
+	/*
+		优化的轮函数: 置换函数P的周期为4, 因此每4轮展开一次并静态地重命名寄存器, 不再移动数据.
+		The permutation P has order 4, so four unrolled rounds rename the registers statically instead of moving data:
+		the logical roles (A, B, C, D, E, F, G, H) of consecutive rounds are bound to the variables
+		(A, B, C, D, E, F, G, H) -> (E, C, H, B, G, A, F, D) -> (G, H, D, C, F, E, A, B) -> (F, D, B, H, A, G, E, C) -> (A, B, C, D, E, F, G, H).
+		Round j reads KDSB[2j .. 2j+3] and KDSB[j .. j+3]; with j <= 62 none of them wrap, so the subkey pointers are plain offsets.
+	*/
+	static_assert(2 * 62 + 3 < 128 && 62 + 3 < 128, "TitanWall round subkey indices must not wrap around KDSB");
+
+	// 参数按本轮输入的逻辑角色传入; 输出的角色为 (E, C, H, B, G, A, F, D)
+	void EncryptRound
+	(
+		std::uint32_t& A, std::uint32_t& B, std::uint32_t& C, std::uint32_t& D, std::uint32_t& E, std::uint32_t& F, std::uint32_t& G, std::uint32_t& H,
+		const std::uint32_t* RoundSubkeys, const std::uint32_t* MixSubkeys
+	)
+	{
+		// 替换函数S
+		const std::uint32_t t = B ^ ((B << 1) + 1);
+		const std::uint32_t u = D ^ ((D << 2) + 1);
+		const std::uint32_t v = F ^ ((F << 3) + 1);
+		const std::uint32_t w = H ^ ((H << 4) + 1);
+
+		A = std::rotr(A - t, static_cast<int>(w & 31)) + RoundSubkeys[0];
+		C = std::rotr(C ^ u, static_cast<int>(v & 31)) + RoundSubkeys[1];
+		E = std::rotr(E ^ v, static_cast<int>(u & 31)) + RoundSubkeys[2];
+		G = std::rotr(G + w, static_cast<int>(t & 31)) + RoundSubkeys[3];
+
+		B += MixSubkeys[0];
+		D ^= MixSubkeys[1];
+		F ^= MixSubkeys[2];
+		H -= MixSubkeys[3];
+
+		// 置换函数P (重命名) + 伪哈达玛德变换
+		PHT(E, C);
+		PHT(H, B);
+		PHT(G, A);
+		PHT(F, D);
+	}
+
+	// 参数与 EncryptRound 相同, 按本轮输入 (明文一侧) 的逻辑角色传入
+	void DecryptRound
+	(
+		std::uint32_t& A, std::uint32_t& B, std::uint32_t& C, std::uint32_t& D, std::uint32_t& E, std::uint32_t& F, std::uint32_t& G, std::uint32_t& H,
+		const std::uint32_t* RoundSubkeys, const std::uint32_t* MixSubkeys
+	)
+	{
+		// 伪哈达玛德变换的逆变换 + 置换函数P的逆操作 (重命名)
+		InversePHT(E, C);
+		InversePHT(H, B);
+		InversePHT(G, A);
+		InversePHT(F, D);
+
+		// 替换函数S的逆操作
+		H += MixSubkeys[3];
+		F ^= MixSubkeys[2];
+		D ^= MixSubkeys[1];
+		B -= MixSubkeys[0];
+
+		const std::uint32_t t = B ^ ((B << 1) + 1);
+		const std::uint32_t u = D ^ ((D << 2) + 1);
+		const std::uint32_t v = F ^ ((F << 3) + 1);
+		const std::uint32_t w = H ^ ((H << 4) + 1);
+
+		G = std::rotl(G - RoundSubkeys[3], static_cast<int>(t & 31)) - w;
+		E = std::rotl(E - RoundSubkeys[2], static_cast<int>(u & 31)) ^ v;
+		C = std::rotl(C - RoundSubkeys[1], static_cast<int>(v & 31)) ^ u;
+		A = std::rotl(A - RoundSubkeys[0], static_cast<int>(w & 31)) + t;
+	}
+
+	// 计数器模式的输入分组: nonce (6个字) || 计数器低32位 || 计数器高32位
+	static std::array<std::uint32_t, 8> CounterBlock(const std::array<std::uint32_t, 6>& nonce, std::uint64_t counter)
+	{
+		return { nonce[0], nonce[1], nonce[2], nonce[3], nonce[4], nonce[5], static_cast<std::uint32_t>(counter), static_cast<std::uint32_t>(counter >> 32) };
+	}
+
+	// 把 [0, blockCount) 按分组边界分给多个线程; 每个线程至少处理 MinimumBlocksPerThread 个分组, 调用线程也参与计算
+	template <typename BlockRangeFunction>
+	static void RunOnThreads(size_t blockCount, unsigned threadCount, BlockRangeFunction&& function)
+	{
+		// 64 KiB
+		constexpr size_t MinimumBlocksPerThread = 2048;
+
+		if (threadCount == 0)
+			threadCount = std::max(1u, std::thread::hardware_concurrency());
+		threadCount = static_cast<unsigned>(std::min<size_t>(threadCount, std::max<size_t>(1, blockCount / MinimumBlocksPerThread)));
+
+		if (threadCount <= 1)
+		{
+			function(0, blockCount);
+			return;
+		}
+
+		// std::jthread 在析构时 join: 若创建后面的线程时抛出 std::system_error, 已启动的线程也会先结束, 不会调用 std::terminate
+		// std::jthread joins on destruction, so if starting a later worker throws std::system_error the started ones are joined instead of terminating
+		std::vector<std::jthread> workers;
+		workers.reserve(threadCount - 1);
+		const size_t blocksPerThread = blockCount / threadCount;
+		const size_t remainderBlocks = blockCount % threadCount;
+
+		size_t firstBlock = 0;
+		for (unsigned threadIndex = 0; threadIndex < threadCount; ++threadIndex)
+		{
+			const size_t lastBlock = firstBlock + blocksPerThread + (threadIndex < remainderBlocks ? 1 : 0);
+			if (threadIndex + 1 == threadCount)
+				function(firstBlock, lastBlock);
+			else
+				workers.emplace_back(function, firstBlock, lastBlock);
+			firstBlock = lastBlock;
+		}
+	}
+
 public:
 
-	explicit TitanWallBlockCipher(const std::vector<std::uint8_t>& KeyBytes) 
+	// 分组大小: 8个32位字 = 32字节
+	static constexpr std::size_t BlockByteSize = 8 * sizeof(std::uint32_t);
+
+	// 所有编译进来的多分组内核, 最优在前; 最后一个是可移植的
+	// Every compiled multi-block kernel, best first; the last one is portable
+	static std::span<const TitanWallBlockKernels* const> KernelCandidates()
+	{
+		using CommonToolkit::CPU_FeatureDispatch::CPU_Feature;
+		using CommonToolkit::CPU_FeatureDispatch::NoFeatures;
+		namespace TitanWallKernels = BlockDataCryption::TitanWall::Kernels;
+
+		#if defined(APPLIED_CRYPTOGRAPHY_HAS_AVX2_KERNELS)
+		static constexpr TitanWallBlockKernels KernelsAVX2 { "avx2", static_cast<std::uint32_t>(CPU_Feature::AVX2), &TitanWallKernels::TitanWallEncryptBlocksAVX2, &TitanWallKernels::TitanWallDecryptBlocksAVX2, &TitanWallKernels::TitanWallCounterModeAVX2 };
+		#endif
+		static constexpr TitanWallBlockKernels KernelsPortable { "portable", NoFeatures, &NoBlocks, &NoBlocks, &NoCounterBlocks };
+
+		static constexpr const TitanWallBlockKernels* Candidates[] =
+		{
+			#if defined(APPLIED_CRYPTOGRAPHY_HAS_AVX2_KERNELS)
+			&KernelsAVX2,
+			#endif
+			&KernelsPortable,
+		};
+		return Candidates;
+	}
+
+	// 字节接口使用的内核, 从候选者中选择一次
+	// The kernel the byte interfaces use, chosen once from the candidates
+	static const TitanWallBlockKernels& Kernels()
+	{
+		static const TitanWallBlockKernels& Selected = CommonToolkit::CPU_FeatureDispatch::SelectKernelTable(KernelCandidates());
+		return Selected;
+	}
+
+	explicit TitanWallBlockCipher(std::span<const std::uint8_t> KeyBytes) 
 	{
 		// 生成子密钥
 		KeySchedule(KeyBytes);
@@ -445,8 +961,198 @@ public:
 
 	~TitanWallBlockCipher()
 	{
-		const std::vector<uint32_t> ZeroNumbers(128, 0x00);
-		memmove(KDSB.data(), ZeroNumbers.data(), 128 * sizeof(uint32_t));
+		ClearWords(KDSB);
+	}
+
+	// 加密一个分组 (8个32位字)
+	void EncryptBlock(std::array<std::uint32_t, 8>& block)
+	{
+		const std::uint32_t* Subkeys = KDSB.data();
+
+		uint32_t A = block[0];
+		uint32_t B = block[1];
+		uint32_t C = block[2];
+		uint32_t D = block[3];
+		uint32_t E = block[4];
+		uint32_t F = block[5];
+		uint32_t G = block[6];
+		uint32_t H = block[7];
+
+		B += Subkeys[0];
+		D += Subkeys[1];
+		F += Subkeys[2];
+		H += Subkeys[3];
+
+		//62 = 15 * 4 + 2
+		for (size_t j = 1; j <= 57; j += 4)
+		{
+			EncryptRound(A, B, C, D, E, F, G, H, Subkeys + 2 * j, Subkeys + j);
+			EncryptRound(E, C, H, B, G, A, F, D, Subkeys + 2 * (j + 1), Subkeys + j + 1);
+			EncryptRound(G, H, D, C, F, E, A, B, Subkeys + 2 * (j + 2), Subkeys + j + 2);
+			EncryptRound(F, D, B, H, A, G, E, C, Subkeys + 2 * (j + 3), Subkeys + j + 3);
+		}
+		EncryptRound(A, B, C, D, E, F, G, H, Subkeys + 2 * 61, Subkeys + 61);
+		EncryptRound(E, C, H, B, G, A, F, D, Subkeys + 2 * 62, Subkeys + 62);
+
+		// 此时逻辑角色 (A, B, C, D, E, F, G, H) 对应变量 (G, H, D, C, F, E, A, B)
+		G += Subkeys[124];
+		D += Subkeys[125];
+		F += Subkeys[126];
+		A += Subkeys[127];
+
+		block = { G, H, D, C, F, E, A, B };
+	}
+
+	// 解密一个分组 (8个32位字)
+	void DecryptBlock(std::array<std::uint32_t, 8>& block)
+	{
+		const std::uint32_t* Subkeys = KDSB.data();
+
+		// 按加密输出的命名读取, 使每一轮的角色绑定与加密相同
+		uint32_t G = block[0];
+		uint32_t H = block[1];
+		uint32_t D = block[2];
+		uint32_t C = block[3];
+		uint32_t F = block[4];
+		uint32_t E = block[5];
+		uint32_t A = block[6];
+		uint32_t B = block[7];
+
+		A -= Subkeys[127];
+		F -= Subkeys[126];
+		D -= Subkeys[125];
+		G -= Subkeys[124];
+
+		DecryptRound(E, C, H, B, G, A, F, D, Subkeys + 2 * 62, Subkeys + 62);
+		DecryptRound(A, B, C, D, E, F, G, H, Subkeys + 2 * 61, Subkeys + 61);
+		for (size_t j = 60; j >= 4; j -= 4)
+		{
+			DecryptRound(F, D, B, H, A, G, E, C, Subkeys + 2 * j, Subkeys + j);
+			DecryptRound(G, H, D, C, F, E, A, B, Subkeys + 2 * (j - 1), Subkeys + j - 1);
+			DecryptRound(E, C, H, B, G, A, F, D, Subkeys + 2 * (j - 2), Subkeys + j - 2);
+			DecryptRound(A, B, C, D, E, F, G, H, Subkeys + 2 * (j - 3), Subkeys + j - 3);
+		}
+
+		H -= Subkeys[3];
+		F -= Subkeys[2];
+		D -= Subkeys[1];
+		B -= Subkeys[0];
+
+		block = { A, B, C, D, E, F, G, H };
+	}
+
+	// 原始轮函数 (元组置换与取模索引), 保留用于回归测试和基准测试
+	// Original round formulation (tuple permutation, modulo indexing), kept for regression tests and benchmarks
+	void ReferenceEncryptBlock(std::array<std::uint32_t, 8>& block)
+	{
+		const size_t SubkeysSize = KDSB.size();
+
+		uint32_t A = block[0];
+		uint32_t B = block[1];
+		uint32_t C = block[2];
+		uint32_t D = block[3];
+		uint32_t E = block[4];
+		uint32_t F = block[5];
+		uint32_t G = block[6];
+		uint32_t H = block[7];
+
+		B += KDSB[0];
+		D += KDSB[1];
+		F += KDSB[2];
+		H += KDSB[3];
+
+		//128 - 1 = 127
+		//(127 - 3) / 2 = 62
+		for (size_t j = 1; j <= 62; j++)
+		{
+			// 替换函数S
+			std::uint32_t t = B ^ ((B << 1) + 1);
+			std::uint32_t u = D ^ ((D << 2) + 1);
+			std::uint32_t v = F ^ ((F << 3) + 1);
+			std::uint32_t w = H ^ ((H << 4) + 1);
+
+			A = Bits32RotateRight(A - t, w % 32) + KDSB[2 * j];
+			C = Bits32RotateRight(C ^ u, v % 32) + KDSB[2 * j + 1];
+			E = Bits32RotateRight(E ^ v, u % 32) + KDSB[2 * j + 2];
+			G = Bits32RotateRight(G + w, t % 32) + KDSB[2 * j + 3];
+
+			B += KDSB[j % KDSB.size()];
+			D ^= KDSB[(j + 1) % KDSB.size()];
+			F ^= KDSB[(j + 2) % KDSB.size()];
+			H -= KDSB[(j + 3) % KDSB.size()];
+
+			// 置换函数P
+			std::tie(F, D, B, H, A, G, E, C) = std::make_tuple(A, B, C, D, E, F, G, H);
+
+			// 伪哈达玛德变换
+			PHT(A, B);
+			PHT(C, D);
+			PHT(E, F);
+			PHT(G, H);
+		}
+
+		A += KDSB[SubkeysSize - 4];
+		C += KDSB[SubkeysSize - 3];
+		E += KDSB[SubkeysSize - 2];
+		G += KDSB[SubkeysSize - 1];
+
+		block = { A, B, C, D, E, F, G, H };
+	}
+
+	void ReferenceDecryptBlock(std::array<std::uint32_t, 8>& block)
+	{
+		const size_t SubkeysSize = KDSB.size();
+
+		uint32_t A = block[0];
+		uint32_t B = block[1];
+		uint32_t C = block[2];
+		uint32_t D = block[3];
+		uint32_t E = block[4];
+		uint32_t F = block[5];
+		uint32_t G = block[6];
+		uint32_t H = block[7];
+
+		G -= KDSB[SubkeysSize - 1];
+		E -= KDSB[SubkeysSize - 2];
+		C -= KDSB[SubkeysSize - 3];
+		A -= KDSB[SubkeysSize - 4];
+
+		//128 - 1 = 127
+		//(127 - 3) / 2 = 62
+		for (size_t j = 62; j >= 1; j--)
+		{
+			// 伪哈达玛德变换的逆变换
+			InversePHT(A, B);
+			InversePHT(C, D);
+			InversePHT(E, F);
+			InversePHT(G, H);
+
+			// 置换函数P的逆操作
+			std::tie(A, B, C, D, E, F, G, H) = std::make_tuple(F, D, B, H, A, G, E, C);
+
+			// 替换函数S的逆操作
+			H += KDSB[(j + 3) % KDSB.size()];
+			F ^= KDSB[(j + 2) % KDSB.size()];
+			D ^= KDSB[(j + 1) % KDSB.size()];
+			B -= KDSB[j % KDSB.size()];
+
+			std::uint32_t t = B ^ ((B << 1) + 1);
+			std::uint32_t u = D ^ ((D << 2) + 1);
+			std::uint32_t v = F ^ ((F << 3) + 1);
+			std::uint32_t w = H ^ ((H << 4) + 1);
+
+			G = Bits32RotateLeft(G - KDSB[2 * j + 3], t % 32) - w;
+			E = Bits32RotateLeft(E - KDSB[2 * j + 2], u % 32) ^ v;
+			C = Bits32RotateLeft(C - KDSB[2 * j + 1], v % 32) ^ u;
+			A = Bits32RotateLeft(A - KDSB[2 * j], w % 32) + t;
+		}
+
+		H -= KDSB[3];
+		F -= KDSB[2];
+		D -= KDSB[1];
+		B -= KDSB[0];
+
+		block = { A, B, C, D, E, F, G, H };
 	}
 
 	// 加密函数
@@ -459,68 +1165,13 @@ public:
 		}
 
 		std::vector<std::uint32_t> ciphertext(plaintext.size(), 0);
-
-		const size_t SubkeysSize = KDSB.size();
+		std::array<std::uint32_t, 8> block {};
 
 		for (size_t i = 0; i < plaintext.size(); i += 8)
 		{
-			uint32_t A = plaintext[i];
-			uint32_t B = plaintext[i + 1];
-			uint32_t C = plaintext[i + 2];
-			uint32_t D = plaintext[i + 3];
-			uint32_t E = plaintext[i + 4];
-			uint32_t F = plaintext[i + 5];
-			uint32_t G = plaintext[i + 6];
-			uint32_t H = plaintext[i + 7];
-
-			B += KDSB[0];
-			D += KDSB[1];
-			F += KDSB[2];
-			H += KDSB[3];
-
-			//128 - 1 = 127
-			//(127 - 3) / 2 = 62
-			for (size_t j = 1; j <= 62; j++)
-			{
-				// 替换函数S
-				std::uint32_t t = B ^ ((B << 1) + 1);
-				std::uint32_t u = D ^ ((D << 2) + 1);
-				std::uint32_t v = F ^ ((F << 3) + 1);
-				std::uint32_t w = H ^ ((H << 4) + 1);
-
-				A = Bits32RotateRight(A - t, w % 32) + KDSB[2 * j];
-				C = Bits32RotateRight(C ^ u, v % 32) + KDSB[2 * j + 1];
-				E = Bits32RotateRight(E ^ v, u % 32) + KDSB[2 * j + 2];
-				G = Bits32RotateRight(G + w, t % 32) + KDSB[2 * j + 3];
-
-				B += KDSB[j % KDSB.size()];
-				D ^= KDSB[(j + 1) % KDSB.size()];
-				F ^= KDSB[(j + 2) % KDSB.size()];
-				H -= KDSB[(j + 3) % KDSB.size()];
-
-				// 置换函数P
-				std::tie(F, D, B, H, A, G, E, C) = std::make_tuple(A, B, C, D, E, F, G, H);
-
-				// 伪哈达玛德变换
-				PHT(A, B);
-				PHT(C, D);
-				PHT(E, F);
-				PHT(G, H);
-			}
-
-			A += KDSB[SubkeysSize - 4];
-			C += KDSB[SubkeysSize - 3];
-			E += KDSB[SubkeysSize - 2];
-			G += KDSB[SubkeysSize - 1];
-
-			ciphertext[i] = A;
-			ciphertext[i + 1] = B;
-			ciphertext[i + 2] = C;
-			ciphertext[i + 3] = D;
-			ciphertext[i + 4] = E;
-			ciphertext[i + 5] = F;
-			ciphertext[i + 6] = G;
-			ciphertext[i + 7] = H;
+			std::copy_n(plaintext.begin() + i, 8, block.begin());
+			EncryptBlock(block);
+			std::copy_n(block.begin(), 8, ciphertext.begin() + i);
 		}
 
 		return ciphertext;
@@ -536,71 +1187,184 @@ public:
 		}
 
 		std::vector<std::uint32_t> plaintext(ciphertext.size());
-
-		const size_t SubkeysSize = KDSB.size();
+		std::array<std::uint32_t, 8> block {};
 
 		for (size_t i = 0; i < ciphertext.size(); i += 8)
 		{
-			uint32_t A = ciphertext[i];
-			uint32_t B = ciphertext[i + 1];
-			uint32_t C = ciphertext[i + 2];
-			uint32_t D = ciphertext[i + 3];
-			uint32_t E = ciphertext[i + 4];
-			uint32_t F = ciphertext[i + 5];
-			uint32_t G = ciphertext[i + 6];
-			uint32_t H = ciphertext[i + 7];
-
-			G -= KDSB[SubkeysSize - 1];
-			E -= KDSB[SubkeysSize - 2];
-			C -= KDSB[SubkeysSize - 3];
-			A -= KDSB[SubkeysSize - 4];
-
-			//128 - 1 = 127
-			//(127 - 3) / 2 = 62
-			for (size_t j = 62; j >= 1; j--)
-			{
-				// 伪哈达玛德变换的逆变换
-				InversePHT(A, B);
-				InversePHT(C, D);
-				InversePHT(E, F);
-				InversePHT(G, H);
-
-				// 置换函数P的逆操作
-				std::tie(A, B, C, D, E, F, G, H) = std::make_tuple(F, D, B, H, A, G, E, C);
-
-				// 替换函数S的逆操作
-				H += KDSB[(j + 3) % KDSB.size()];
-				F ^= KDSB[(j + 2) % KDSB.size()];
-				D ^= KDSB[(j + 1) % KDSB.size()];
-				B -= KDSB[j % KDSB.size()];
-
-				std::uint32_t t = B ^ ((B << 1) + 1);
-				std::uint32_t u = D ^ ((D << 2) + 1);
-				std::uint32_t v = F ^ ((F << 3) + 1);
-				std::uint32_t w = H ^ ((H << 4) + 1);
-
-				G = Bits32RotateLeft(G - KDSB[2 * j + 3], t % 32) - w;
-				E = Bits32RotateLeft(E - KDSB[2 * j + 2], u % 32) ^ v;
-				C = Bits32RotateLeft(C - KDSB[2 * j + 1], v % 32) ^ u;
-				A = Bits32RotateLeft(A - KDSB[2 * j], w % 32) + t;
-			}
+			std::copy_n(ciphertext.begin() + i, 8, block.begin());
+			DecryptBlock(block);
+			std::copy_n(block.begin(), 8, plaintext.begin() + i);
+		}
 
-			H -= KDSB[3];
-			F -= KDSB[2];
-			D -= KDSB[1];
-			B -= KDSB[0];
+		return plaintext;
+	}
+
+	/*
+		字节接口: 不分配内存, 不输出到流, 错误以状态码返回
+		Byte interface: no allocation and no stream output, errors are returned as status values.
+		Every 32 bytes form one block of eight little-endian words, so the bytes agree with Encrypt/Decrypt on a little-endian system.
+		The out-of-place form requires output.size() == input.size(); input and output may be the same buffer but must not partially overlap.
+	*/
+
+	[[nodiscard]] TitanWallStatus Encrypt(std::span<const std::uint8_t> plaintext, std::span<std::uint8_t> ciphertext)
+	{
+		return Encrypt(plaintext, ciphertext, Kernels());
+	}
+
+	[[nodiscard]] TitanWallStatus Decrypt(std::span<const std::uint8_t> ciphertext, std::span<std::uint8_t> plaintext)
+	{
+		return Decrypt(ciphertext, plaintext, Kernels());
+	}
+
+	// 指定内核的形式, 用于交叉验证 (kernels 必须被处理器支持)
+	// Forms with an explicit kernel, for cross-checks; the processor must support kernels.RequiredFeatures
+	[[nodiscard]] TitanWallStatus Encrypt(std::span<const std::uint8_t> plaintext, std::span<std::uint8_t> ciphertext, const TitanWallBlockKernels& kernels)
+	{
+		if (plaintext.size() % BlockByteSize != 0)
+			return TitanWallStatus::UnalignedLength;
+		if (ciphertext.size() != plaintext.size())
+			return TitanWallStatus::BufferSizeMismatch;
+
+		const size_t processedCount = kernels.EncryptBlocks(plaintext.data(), ciphertext.data(), plaintext.size() / BlockByteSize, KDSB.data());
 
-			plaintext[i] = A;
-			plaintext[i + 1] = B;
-			plaintext[i + 2] = C;
-			plaintext[i + 3] = D;
-			plaintext[i + 4] = E;
-			plaintext[i + 5] = F;
-			plaintext[i + 6] = G;
-			plaintext[i + 7] = H;
+		std::array<std::uint32_t, 8> block {};
+		for (size_t offset = processedCount * BlockByteSize; offset < plaintext.size(); offset += BlockByteSize)
+		{
+			LoadBlock(plaintext.data() + offset, block);
+			EncryptBlock(block);
+			StoreBlock(block, ciphertext.data() + offset);
 		}
 
-		return plaintext;
+		return TitanWallStatus::Success;
+	}
+
+	[[nodiscard]] TitanWallStatus Decrypt(std::span<const std::uint8_t> ciphertext, std::span<std::uint8_t> plaintext, const TitanWallBlockKernels& kernels)
+	{
+		if (ciphertext.size() % BlockByteSize != 0)
+			return TitanWallStatus::UnalignedLength;
+		if (plaintext.size() != ciphertext.size())
+			return TitanWallStatus::BufferSizeMismatch;
+
+		const size_t processedCount = kernels.DecryptBlocks(ciphertext.data(), plaintext.data(), ciphertext.size() / BlockByteSize, KDSB.data());
+
+		std::array<std::uint32_t, 8> block {};
+		for (size_t offset = processedCount * BlockByteSize; offset < ciphertext.size(); offset += BlockByteSize)
+		{
+			LoadBlock(ciphertext.data() + offset, block);
+			DecryptBlock(block);
+			StoreBlock(block, plaintext.data() + offset);
+		}
+
+		return TitanWallStatus::Success;
+	}
+
+	// 原地加密
+	[[nodiscard]] TitanWallStatus EncryptInPlace(std::span<std::uint8_t> data)
+	{
+		return Encrypt(std::span<const std::uint8_t>(data.data(), data.size()), data);
+	}
+
+	// 原地解密
+	[[nodiscard]] TitanWallStatus DecryptInPlace(std::span<std::uint8_t> data)
+	{
+		return Decrypt(std::span<const std::uint8_t>(data.data(), data.size()), data);
+	}
+
+	/*
+		计数器模式 (CTR): 第 i 个密钥流分组 = EncryptBlock(nonce || counter + i), 加密与解密是同一个操作.
+		Counter mode: keystream block i is EncryptBlock(nonce[0..5] || (counter + i) as two little-endian words), XORed into the data.
+		Any length is accepted; a final partial block uses the leading bytes of its keystream block.
+		A (key, nonce, counter) range must never be reused for different data.
+	*/
+	[[nodiscard]] TitanWallStatus CounterMode(std::span<const std::uint8_t> input, std::span<std::uint8_t> output, const std::array<std::uint32_t, 6>& nonce, std::uint64_t counter = 0)
+	{
+		return CounterMode(input, output, nonce, counter, Kernels());
+	}
+
+	[[nodiscard]] TitanWallStatus CounterMode(std::span<const std::uint8_t> input, std::span<std::uint8_t> output, const std::array<std::uint32_t, 6>& nonce, std::uint64_t counter, const TitanWallBlockKernels& kernels)
+	{
+		if (output.size() != input.size())
+			return TitanWallStatus::BufferSizeMismatch;
+
+		// 内核只处理完整的分组, 最后一个不完整的分组由下面的循环处理
+		const size_t processedCount = kernels.CounterMode(input.data(), output.data(), input.size() / BlockByteSize, nonce.data(), counter, KDSB.data());
+		counter += processedCount;
+
+		std::array<std::uint8_t, BlockByteSize> keystream {};
+		for (size_t offset = processedCount * BlockByteSize; offset < input.size(); offset += BlockByteSize, ++counter)
+		{
+			std::array<std::uint32_t, 8> block = CounterBlock(nonce, counter);
+			EncryptBlock(block);
+			StoreBlock(block, keystream.data());
+
+			const size_t byteCount = std::min(BlockByteSize, input.size() - offset);
+			for (size_t i = 0; i < byteCount; ++i)
+				output[offset + i] = input[offset + i] ^ keystream[i];
+		}
+
+		return TitanWallStatus::Success;
+	}
+
+	/*
+		多线程驱动: 输入按分组边界切分到多个线程, 结果与单线程的 Encrypt/Decrypt/CounterMode 完全相同.
+		Multi-threaded drivers: the input is split on block boundaries across threadCount threads (0 = hardware concurrency).
+		Inputs below 64 KiB per thread run on the calling thread only. The round functions only read KDSB, so concurrent calls on one cipher object are safe.
+	*/
+	[[nodiscard]] TitanWallStatus ParallelEncrypt(std::span<const std::uint8_t> plaintext, std::span<std::uint8_t> ciphertext, unsigned threadCount = 0)
+	{
+		if (plaintext.size() % BlockByteSize != 0)
+			return TitanWallStatus::UnalignedLength;
+		if (ciphertext.size() != plaintext.size())
+			return TitanWallStatus::BufferSizeMismatch;
+
+		RunOnThreads
+		(
+			plaintext.size() / BlockByteSize, threadCount,
+			[this, plaintext, ciphertext](size_t firstBlock, size_t lastBlock)
+			{
+				const size_t offset = firstBlock * BlockByteSize, size = (lastBlock - firstBlock) * BlockByteSize;
+				(void)Encrypt(plaintext.subspan(offset, size), ciphertext.subspan(offset, size));
+			}
+		);
+		return TitanWallStatus::Success;
+	}
+
+	[[nodiscard]] TitanWallStatus ParallelDecrypt(std::span<const std::uint8_t> ciphertext, std::span<std::uint8_t> plaintext, unsigned threadCount = 0)
+	{
+		if (ciphertext.size() % BlockByteSize != 0)
+			return TitanWallStatus::UnalignedLength;
+		if (plaintext.size() != ciphertext.size())
+			return TitanWallStatus::BufferSizeMismatch;
+
+		RunOnThreads
+		(
+			ciphertext.size() / BlockByteSize, threadCount,
+			[this, ciphertext, plaintext](size_t firstBlock, size_t lastBlock)
+			{
+				const size_t offset = firstBlock * BlockByteSize, size = (lastBlock - firstBlock) * BlockByteSize;
+				(void)Decrypt(ciphertext.subspan(offset, size), plaintext.subspan(offset, size));
+			}
+		);
+		return TitanWallStatus::Success;
+	}
+
+	[[nodiscard]] TitanWallStatus ParallelCounterMode(std::span<const std::uint8_t> input, std::span<std::uint8_t> output, const std::array<std::uint32_t, 6>& nonce, std::uint64_t counter = 0, unsigned threadCount = 0)
+	{
+		if (output.size() != input.size())
+			return TitanWallStatus::BufferSizeMismatch;
+
+		// 最后一个不完整的分组归入最后一个线程
+		const size_t blockCount = (input.size() + BlockByteSize - 1) / BlockByteSize;
+		RunOnThreads
+		(
+			blockCount, threadCount,
+			[this, input, output, &nonce, counter](size_t firstBlock, size_t lastBlock)
+			{
+				const size_t offset = firstBlock * BlockByteSize, size = std::min(lastBlock * BlockByteSize, input.size()) - offset;
+				(void)CounterMode(input.subspan(offset, size), output.subspan(offset, size), nonce, counter + firstBlock);
+			}
+		);
+		return TitanWallStatus::Success;
 	}
 };
 
@@ -641,6 +1405,30 @@ void TestTitanWallBlockCipher()
 		std::cout << std::hex << val << " ";
 	std::cout << std::endl;
 
+	// 字节接口: 与32位字接口一致, 原地与非原地结果相同
+	std::vector<std::uint8_t> plainBytes(plaintext.size() * sizeof(std::uint32_t));
+	for (size_t i = 0; i < plaintext.size(); ++i)
+		for (size_t byteIndex = 0; byteIndex < 4; ++byteIndex)
+			plainBytes[i * 4 + byteIndex] = static_cast<std::uint8_t>(plaintext[i] >> (8 * byteIndex));
+
+	std::vector<std::uint8_t> cipherBytes(plainBytes.size());
+	std::vector<std::uint8_t> inPlaceBytes(plainBytes);
+	bool isBytesPassed = cipher.Encrypt(plainBytes, cipherBytes) == TitanWallStatus::Success && cipher.EncryptInPlace(inPlaceBytes) == TitanWallStatus::Success && cipherBytes == inPlaceBytes;
+	for (size_t i = 0; i < ciphertext.size(); ++i)
+		for (size_t byteIndex = 0; byteIndex < 4; ++byteIndex)
+			isBytesPassed &= cipherBytes[i * 4 + byteIndex] == static_cast<std::uint8_t>(ciphertext[i] >> (8 * byteIndex));
+	isBytesPassed &= cipher.DecryptInPlace(inPlaceBytes) == TitanWallStatus::Success && inPlaceBytes == plainBytes;
+
+	std::array<std::uint8_t, 31> unalignedBytes {};
+	isBytesPassed &= cipher.EncryptInPlace(unalignedBytes) == TitanWallStatus::UnalignedLength;
+	isBytesPassed &= cipher.Decrypt(plainBytes, std::span<std::uint8_t>(cipherBytes).first(32)) == TitanWallStatus::BufferSizeMismatch;
+
+	if(!isBytesPassed)
+	{
+		std::cout << "字节接口测试失败！" << std::endl;
+		assert(false);
+	}
+
 	std::cout << "测试成功！" << std::endl;
 
 	// 输出KDSB的内容
@@ -649,6 +1437,256 @@ void TestTitanWallBlockCipher()
 	}*/
 }
 
+void TestTitanWallBlockCipherRoundCore()
+{
+	std::mt19937 PRNG(1);
+	bool isPassed = true;
+
+	for (size_t keyCount = 0; keyCount < 16; ++keyCount)
+	{
+		std::vector<std::uint8_t> key(8 + keyCount * 4);
+		for (auto& byte : key)
+			byte = static_cast<std::uint8_t>(PRNG());
+
+		TitanWallBlockCipher cipher(key);
+
+		for (size_t blockCount = 0; blockCount < 256; ++blockCount)
+		{
+			std::array<std::uint32_t, 8> plainBlock {};
+			for (auto& word : plainBlock)
+				word = PRNG();
+			//让部分字的低5位为0, 覆盖旋转量为0的情况
+			if (blockCount % 4 == 0)
+				for (auto& word : plainBlock)
+					word &= ~std::uint32_t(31);
+
+			std::array<std::uint32_t, 8> block = plainBlock;
+			std::array<std::uint32_t, 8> referenceBlock = plainBlock;
+			cipher.EncryptBlock(block);
+			cipher.ReferenceEncryptBlock(referenceBlock);
+			isPassed &= block == referenceBlock;
+
+			cipher.DecryptBlock(block);
+			cipher.ReferenceDecryptBlock(referenceBlock);
+			isPassed &= block == plainBlock && referenceBlock == plainBlock;
+		}
+	}
+
+	std::cout << "TitanWall block cipher round core cross-check: " << (isPassed ? "passed" : "failed") << std::endl;
+	assert(isPassed);
+}
+
+// 每字节周期数 (时间戳计数器的参考周期) 与吞吐量
+void BenchmarkTitanWallBlockCipher()
+{
+	std::vector<std::uint8_t> key = {0x01, 0x23, 0x45, 0x67, 0x89, 0xAB, 0xCD, 0xEF};
+	TitanWallBlockCipher cipher(key);
+
+	constexpr size_t BlockCount = 1 << 15;
+	std::array<std::uint32_t, 8> block {0x01234567, 0x89ABCDEF, 0xFEDCBA98, 0x76543210, 0xAAAAAAAA, 0x55555555, 0x80000000, 0x11111111};
+
+	auto measure = [&](const char* name, auto&& function)
+	{
+		//预热
+		for (size_t i = 0; i < BlockCount / 16; ++i)
+			function(block);
+
+		const auto startTime = std::chrono::steady_clock::now();
+		const std::uint64_t startCycles = read_cycle_counter();
+		for (size_t i = 0; i < BlockCount; ++i)
+			function(block);
+		const std::uint64_t endCycles = read_cycle_counter();
+		const auto endTime = std::chrono::steady_clock::now();
+
+		const double bytes = static_cast<double>(BlockCount * TitanWallBlockCipher::BlockByteSize);
+		const double seconds = std::chrono::duration<double>(endTime - startTime).count();
+		std::cout << name << ": " << std::fixed << std::setprecision(2);
+		if (endCycles != startCycles)
+			std::cout << static_cast<double>(endCycles - startCycles) / bytes << " cycles/byte, ";
+		std::cout << bytes / seconds / (1024.0 * 1024.0) << " MB/s" << std::defaultfloat << std::endl;
+	};
+
+	measure("TitanWall reference encrypt", [&](std::array<std::uint32_t, 8>& data) { cipher.ReferenceEncryptBlock(data); });
+	measure("TitanWall encrypt          ", [&](std::array<std::uint32_t, 8>& data) { cipher.EncryptBlock(data); });
+	measure("TitanWall reference decrypt", [&](std::array<std::uint32_t, 8>& data) { cipher.ReferenceDecryptBlock(data); });
+	measure("TitanWall decrypt          ", [&](std::array<std::uint32_t, 8>& data) { cipher.DecryptBlock(data); });
+
+	//防止结果被优化掉
+	std::cout << "(checksum " << std::hex << (block[0] ^ block[7]) << std::dec << ")" << std::endl;
+
+	// 字节接口吞吐量: 多分组并行 (ECB/CTR) 与多线程驱动
+	std::vector<std::uint8_t> input(16 << 20, 0x5A), output(input.size());
+	const std::array<std::uint32_t, 6> nonce {0x00112233, 0x44556677, 0x8899AABB, 0xCCDDEEFF, 0x01020304, 0x05060708};
+
+	auto measureBytes = [&](const char* name, auto&& function)
+	{
+		function();
+
+		const auto startTime = std::chrono::steady_clock::now();
+		const std::uint64_t startCycles = read_cycle_counter();
+		function();
+		const std::uint64_t endCycles = read_cycle_counter();
+		const auto endTime = std::chrono::steady_clock::now();
+
+		const double bytes = static_cast<double>(input.size());
+		const double seconds = std::chrono::duration<double>(endTime - startTime).count();
+		std::cout << name << ": " << std::fixed << std::setprecision(2);
+		if (endCycles != startCycles)
+			std::cout << static_cast<double>(endCycles - startCycles) / bytes << " cycles/byte (wall clock), ";
+		std::cout << bytes / seconds / (1024.0 * 1024.0) << " MB/s" << std::defaultfloat << std::endl;
+	};
+
+	measureBytes("TitanWall ECB                ", [&] { (void)cipher.Encrypt(input, output); });
+	measureBytes("TitanWall ECB all threads    ", [&] { (void)cipher.ParallelEncrypt(input, output); });
+	measureBytes("TitanWall CTR                ", [&] { (void)cipher.CounterMode(input, output, nonce); });
+	measureBytes("TitanWall CTR all threads    ", [&] { (void)cipher.ParallelCounterMode(input, output, nonce); });
+}
+
+void TestTitanWallBlockCipherModes()
+{
+	std::mt19937 PRNG(2);
+	std::vector<std::uint8_t> key(16);
+	for (auto& byte : key)
+		byte = static_cast<std::uint8_t>(PRNG());
+
+	TitanWallBlockCipher cipher(key);
+	bool isPassed = true;
+
+	// 多分组内核与单分组结果一致 (包括不足一组的尾部分组)
+	std::vector<std::uint8_t> plainBytes((1 << 20) + 13 * TitanWallBlockCipher::BlockByteSize);
+	for (auto& byte : plainBytes)
+		byte = static_cast<std::uint8_t>(PRNG());
+
+	std::vector<std::uint8_t> cipherBytes(plainBytes.size()), parallelBytes(plainBytes.size());
+	isPassed &= cipher.Encrypt(plainBytes, cipherBytes) == TitanWallStatus::Success;
+	for (size_t offset = 0; offset < plainBytes.size(); offset += TitanWallBlockCipher::BlockByteSize)
+	{
+		std::array<std::uint32_t, 8> block {};
+		for (size_t i = 0; i < 8; ++i)
+			for (size_t byteIndex = 0; byteIndex < 4; ++byteIndex)
+				block[i] |= std::uint32_t(plainBytes[offset + i * 4 + byteIndex]) << (8 * byteIndex);
+		cipher.ReferenceEncryptBlock(block);
+		for (size_t i = 0; i < 8; ++i)
+			for (size_t byteIndex = 0; byteIndex < 4; ++byteIndex)
+				isPassed &= cipherBytes[offset + i * 4 + byteIndex] == static_cast<std::uint8_t>(block[i] >> (8 * byteIndex));
+	}
+
+	isPassed &= cipher.ParallelEncrypt(plainBytes, parallelBytes, 4) == TitanWallStatus::Success && parallelBytes == cipherBytes;
+	isPassed &= cipher.ParallelDecrypt(cipherBytes, parallelBytes, 3) == TitanWallStatus::Success && parallelBytes == plainBytes;
+	isPassed &= cipher.ParallelEncrypt(plainBytes, std::span<std::uint8_t>(parallelBytes).first(32)) == TitanWallStatus::BufferSizeMismatch;
+
+	// 计数器模式: 与逐分组的定义一致, 多线程结果相同, 两次处理还原明文
+	const std::array<std::uint32_t, 6> nonce {0x00112233, 0x44556677, 0x8899AABB, 0xCCDDEEFF, 0x01020304, 0x05060708};
+	const std::uint64_t counter = 0xFFFFFFFFull - 5;
+	for (size_t size : {size_t(0), size_t(1), size_t(31), size_t(32), size_t(33), size_t(255), size_t(256), size_t(257), size_t(1000), plainBytes.size() - 7})
+	{
+		std::span<const std::uint8_t> input(plainBytes.data(), size);
+		std::vector<std::uint8_t> output(size), parallelOutput(size), recovered(size);
+
+		isPassed &= cipher.CounterMode(input, output, nonce, counter) == TitanWallStatus::Success;
+		for (size_t offset = 0; offset < size; offset += TitanWallBlockCipher::BlockByteSize)
+		{
+			const std::uint64_t blockCounter = counter + offset / TitanWallBlockCipher::BlockByteSize;
+			std::array<std::uint32_t, 8> block {nonce[0], nonce[1], nonce[2], nonce[3], nonce[4], nonce[5], static_cast<std::uint32_t>(blockCounter), static_cast<std::uint32_t>(blockCounter >> 32)};
+			cipher.ReferenceEncryptBlock(block);
+			for (size_t i = 0; i < TitanWallBlockCipher::BlockByteSize && offset + i < size; ++i)
+				isPassed &= output[offset + i] == (input[offset + i] ^ static_cast<std::uint8_t>(block[i / 4] >> (8 * (i % 4))));
+		}
+
+		isPassed &= cipher.ParallelCounterMode(input, parallelOutput, nonce, counter, 4) == TitanWallStatus::Success && parallelOutput == output;
+		isPassed &= cipher.CounterMode(output, recovered, nonce, counter) == TitanWallStatus::Success && std::equal(recovered.begin(), recovered.end(), input.begin());
+	}
+
+	std::cout << "TitanWall block cipher ECB/CTR modes: " << (isPassed ? "passed" : "failed") << std::endl;
+	assert(isPassed);
+}
+
+void TestTitanWallBlockKernels()
+{
+	std::mt19937 PRNG(3);
+	std::vector<std::uint8_t> key(32);
+	for (auto& byte : key)
+		byte = static_cast<std::uint8_t>(PRNG());
+
+	TitanWallBlockCipher cipher(key);
+	const std::array<std::uint32_t, 6> nonce {0x00112233, 0x44556677, 0x8899AABB, 0xCCDDEEFF, 0x01020304, 0x05060708};
+	// 计数器跨过32位边界
+	const std::uint64_t counter = 0xFFFFFFFFull - 11;
+
+	// 单分组结果: EncryptBlock/DecryptBlock (EncryptRound/DecryptRound) 和 ReferenceEncryptBlock
+	auto loadBlock = [](const std::uint8_t* bytes)
+	{
+		std::array<std::uint32_t, 8> block {};
+		for (size_t i = 0; i < 8; ++i)
+			for (size_t byteIndex = 0; byteIndex < 4; ++byteIndex)
+				block[i] |= std::uint32_t(bytes[i * 4 + byteIndex]) << (8 * byteIndex);
+		return block;
+	};
+	auto storeBlock = [](const std::array<std::uint32_t, 8>& block, std::uint8_t* bytes)
+	{
+		for (size_t i = 0; i < 8; ++i)
+			for (size_t byteIndex = 0; byteIndex < 4; ++byteIndex)
+				bytes[i * 4 + byteIndex] = static_cast<std::uint8_t>(block[i] >> (8 * byteIndex));
+	};
+
+	bool isAllPassed = true;
+	for (const TitanWallBlockKernels* kernels : TitanWallBlockCipher::KernelCandidates())
+	{
+		if (!CommonToolkit::CPU_FeatureDispatch::HasFeatures(kernels->RequiredFeatures))
+		{
+			std::cout << "TitanWall " << kernels->Name << " kernel: skipped (not supported by this processor)" << std::endl;
+			continue;
+		}
+
+		bool isPassed = true;
+		for (size_t blockCount : {0, 1, 7, 8, 9, 15, 16, 17, 24, 31, 64, 100})
+		{
+			std::vector<std::uint8_t> plainBytes(blockCount * TitanWallBlockCipher::BlockByteSize + 13);
+			for (auto& byte : plainBytes)
+				byte = static_cast<std::uint8_t>(PRNG());
+			const std::span<const std::uint8_t> plainBlocks(plainBytes.data(), blockCount * TitanWallBlockCipher::BlockByteSize);
+
+			std::vector<std::uint8_t> scalarBytes(plainBlocks.size()), referenceBytes(plainBlocks.size()), keystreamBytes(plainBytes.size());
+			for (size_t offset = 0; offset < plainBlocks.size(); offset += TitanWallBlockCipher::BlockByteSize)
+			{
+				std::array<std::uint32_t, 8> block = loadBlock(plainBlocks.data() + offset);
+				cipher.EncryptBlock(block);
+				storeBlock(block, scalarBytes.data() + offset);
+
+				block = loadBlock(plainBlocks.data() + offset);
+				cipher.ReferenceEncryptBlock(block);
+				storeBlock(block, referenceBytes.data() + offset);
+			}
+			// 计数器模式的密钥流, 包括最后一个不完整的分组
+			for (size_t offset = 0; offset < plainBytes.size(); offset += TitanWallBlockCipher::BlockByteSize)
+			{
+				const std::uint64_t blockCounter = counter + offset / TitanWallBlockCipher::BlockByteSize;
+				std::array<std::uint32_t, 8> block {nonce[0], nonce[1], nonce[2], nonce[3], nonce[4], nonce[5], static_cast<std::uint32_t>(blockCounter), static_cast<std::uint32_t>(blockCounter >> 32)};
+				std::array<std::uint8_t, TitanWallBlockCipher::BlockByteSize> keystream {};
+				cipher.EncryptBlock(block);
+				storeBlock(block, keystream.data());
+				for (size_t i = 0; i < TitanWallBlockCipher::BlockByteSize && offset + i < plainBytes.size(); ++i)
+					keystreamBytes[offset + i] = plainBytes[offset + i] ^ keystream[i];
+			}
+			isPassed &= scalarBytes == referenceBytes;
+
+			// 内核与单分组代码一起处理, 以及原地处理
+			std::vector<std::uint8_t> cipherBytes(plainBlocks.size()), recoveredBytes(plainBlocks.size()), counterBytes(plainBytes.size());
+			isPassed &= cipher.Encrypt(plainBlocks, cipherBytes, *kernels) == TitanWallStatus::Success && cipherBytes == scalarBytes;
+			isPassed &= cipher.Decrypt(cipherBytes, recoveredBytes, *kernels) == TitanWallStatus::Success && std::equal(recoveredBytes.begin(), recoveredBytes.end(), plainBlocks.begin());
+			isPassed &= cipher.Decrypt(cipherBytes, cipherBytes, *kernels) == TitanWallStatus::Success && cipherBytes == recoveredBytes;
+			isPassed &= cipher.CounterMode(plainBytes, counterBytes, nonce, counter, *kernels) == TitanWallStatus::Success && counterBytes == keystreamBytes;
+			isPassed &= cipher.CounterMode(counterBytes, counterBytes, nonce, counter, *kernels) == TitanWallStatus::Success && counterBytes == plainBytes;
+		}
+
+		std::cout << "TitanWall " << kernels->Name << " kernel cross-check: " << (isPassed ? "passed" : "failed") << std::endl;
+		isAllPassed &= isPassed;
+	}
+
+	std::cout << "TitanWall multi-block (dispatched to " << TitanWallBlockCipher::Kernels().Name << "): " << (isAllPassed ? "passed" : "failed") << std::endl;
+	assert(isAllPassed);
+}
+
 void TestTitanWallStreamCipher()
 {
 	// 1. Test Key Initialization
@@ -743,3 +1781,145 @@ void TestTitanWallStreamCipher()
 	// Ensure that the decrypted data matches the original plaintext
 	assert(decryptedText == originalText);
 }
+
+void TestTitanWallStreamCipherStreaming()
+{
+	std::vector<std::uint8_t> key = {0x12, 0x34, 0x56, 0x78, 0x9A, 0xBC, 0xDE, 0xF0};
+	TitanWallStreamCipher cipher(key);
+	bool isPassed = true;
+
+	// 一次生成与分段生成的密钥流相同
+	std::vector<std::uint8_t> keystream(3000);
+	isPassed &= cipher.GenerateKeyStream(keystream) == TitanWallStatus::Success;
+
+	cipher.InitialState(key);
+	std::vector<std::uint8_t> pieces(keystream.size());
+	size_t offset = 0;
+	for (size_t size : {size_t(1), size_t(7), size_t(504), size_t(0), size_t(4), size_t(1000), size_t(1484)})
+	{
+		isPassed &= cipher.GenerateKeyStream(std::span<std::uint8_t>(pieces).subspan(offset, size)) == TitanWallStatus::Success;
+		offset += size;
+	}
+	isPassed &= offset == pieces.size() && pieces == keystream;
+
+	// GeneratePseudoRandomBytes 现在填满整个缓冲区, 并与流式输出一致
+	cipher.InitialState(key);
+	std::vector<std::uint8_t> bytes(keystream.size(), 0);
+	cipher.GeneratePseudoRandomBytes(bytes);
+	isPassed &= bytes == keystream;
+
+	// Process: 加密后解密还原, 支持原地处理
+	std::vector<std::uint8_t> plaintext(8192 + 3);
+	for (size_t i = 0; i < plaintext.size(); ++i)
+		plaintext[i] = static_cast<std::uint8_t>(i * 131 + 7);
+
+	std::vector<std::uint8_t> ciphertext(plaintext.size());
+	cipher.InitialState(key);
+	isPassed &= cipher.Process(plaintext, ciphertext) == TitanWallStatus::Success;
+	isPassed &= std::equal(keystream.begin(), keystream.end(), ciphertext.begin(), [&, i = size_t(0)](std::uint8_t key_byte, std::uint8_t cipher_byte) mutable { return (key_byte ^ plaintext[i++]) == cipher_byte; });
+
+	cipher.InitialState(key);
+	isPassed &= cipher.Process(ciphertext, ciphertext) == TitanWallStatus::Success && ciphertext == plaintext;
+	isPassed &= cipher.Process(plaintext, std::span<std::uint8_t>(ciphertext).first(1)) == TitanWallStatus::BufferSizeMismatch;
+
+	cipher.ResetState();
+	isPassed &= cipher.GenerateKeyStream(bytes) == TitanWallStatus::KeyNotSet;
+
+	std::cout << "TitanWall stream cipher streaming output: " << (isPassed ? "passed" : "failed") << std::endl;
+	assert(isPassed);
+}
+
+void TestTitanWallNLFSR()
+{
+	struct NLFSRProbe : CryptographicFunctions
+	{
+		using CryptographicFunctions::NLFSR;
+		using CryptographicFunctions::NLFSRTwoLanes;
+	} probe;
+
+	std::mt19937_64 PRNG(3);
+	bool isPassed = true;
+
+	for (size_t Count = 0; Count < (1 << 16); ++Count)
+	{
+		const uint64_t Registers = Count < 4 ? std::array<uint64_t, 4>{0, ~uint64_t(0), 0xFFFFFFFF, 0xFFFFFFFF00000000}[Count] : PRNG();
+		const uint64_t Expected = uint64_t(probe.NLFSR(static_cast<uint32_t>(Registers >> 32))) << 32 | probe.NLFSR(static_cast<uint32_t>(Registers));
+		isPassed &= probe.NLFSRTwoLanes(Registers) == Expected;
+	}
+
+	std::cout << "TitanWall NLFSR two-lane cross-check: " << (isPassed ? "passed" : "failed") << std::endl;
+	assert(isPassed);
+}
+
+void TestTitanWallMixPass()
+{
+	struct MixProbe : CryptographicFunctions
+	{
+		using CryptographicFunctions::KDSB;
+		using CryptographicFunctions::MixPass;
+
+		void ReferencePass(uint64_t& RandomIndex)
+		{
+			for (size_t Counter = 0; Counter < KDSB.size(); Counter++)
+			{
+				MixWithAddSubtract(Counter, RandomIndex);
+				RandomAccessMix(Counter, RandomIndex);
+				ComplexMix(Counter, RandomIndex);
+			}
+		}
+	} probe, referenceProbe;
+
+	std::mt19937_64 PRNG(4);
+	bool isPassed = true;
+
+	for (size_t Count = 0; Count < 256; ++Count)
+	{
+		for (auto& word : probe.KDSB)
+			word = static_cast<uint32_t>(PRNG());
+		referenceProbe.KDSB = probe.KDSB;
+
+		uint64_t RandomIndex = Count == 0 ? 0 : PRNG();
+		uint64_t ReferenceRandomIndex = RandomIndex;
+		for (size_t Round = 0; Round < 4; Round++)
+		{
+			probe.MixPass(RandomIndex);
+			referenceProbe.ReferencePass(ReferenceRandomIndex);
+			isPassed &= RandomIndex == ReferenceRandomIndex && probe.KDSB == referenceProbe.KDSB;
+		}
+	}
+
+	std::cout << "TitanWall mix pass cross-check: " << (isPassed ? "passed" : "failed") << std::endl;
+	assert(isPassed);
+}
+
+void TestTitanWallKeySchedule()
+{
+	struct KeyScheduleProbe : CryptographicFunctions
+	{
+		using CryptographicFunctions::KDSB;
+	} probe, referenceProbe;
+
+	std::mt19937 PRNG(5);
+	bool isPassed = true;
+
+	for (size_t KeySize : {1, 2, 3, 4, 5, 7, 8, 16, 31, 32, 33, 64, 255, 508, 509, 512, 513, 600, 1024, 1031})
+	{
+		std::vector<std::uint8_t> key(KeySize);
+		for (auto& byte : key)
+			byte = static_cast<std::uint8_t>(PRNG());
+
+		probe.KDSB.fill(0);
+		referenceProbe.KDSB.fill(0);
+		probe.KeySchedule(key);
+		referenceProbe.ReferenceKeySchedule(key);
+		isPassed &= probe.KDSB == referenceProbe.KDSB;
+
+		// 再次编排时 KDSB 不清零, 两种实现都从上一次的状态继续
+		probe.KeySchedule(std::span<const std::uint8_t>(key).first(KeySize / 2 + 1));
+		referenceProbe.ReferenceKeySchedule(std::vector<std::uint8_t>(key.begin(), key.begin() + KeySize / 2 + 1));
+		isPassed &= probe.KDSB == referenceProbe.KDSB;
+	}
+
+	std::cout << "TitanWall key schedule cross-check: " << (isPassed ? "passed" : "failed") << std::endl;
+	assert(isPassed);
+}
@@ -2,75 +2,163 @@
 
 namespace PseudoRandomNumberGenerators
 {
+	namespace
+	{
+		//(A + B) mod Modulus for A, B < Modulus, without overflowing 64 bits
+		//(A + B) mod Modulus, 要求 A, B < Modulus, 不会溢出64位
+		std::uint64_t AddModulo(std::uint64_t A, std::uint64_t B, std::uint64_t Modulus)
+		{
+			return A >= Modulus - B ? A - (Modulus - B) : A + B;
+		}
+
+		//Modulus may be even here (it is lcm(P - 1, Q - 1)), so this is double-and-add instead of Montgomery; it only runs when jumping
+		//这里的模数可以是偶数 (它是 lcm(P - 1, Q - 1)), 所以用倍加法而不是蒙哥马利乘法; 只在跳跃时运行
+		std::uint64_t MultiplyModulo(std::uint64_t A, std::uint64_t B, std::uint64_t Modulus)
+		{
+			std::uint64_t Result = 0;
+			A %= Modulus;
+			for (; B != 0; B >>= 1)
+			{
+				if (B & 1)
+					Result = AddModulo(Result, A, Modulus);
+				A = AddModulo(A, A, Modulus);
+			}
+			return Result;
+		}
+
+		std::uint64_t PowerModulo(std::uint64_t Base, std::uint64_t Exponent, std::uint64_t Modulus)
+		{
+			std::uint64_t Result = 1 % Modulus;
+			for (Base %= Modulus; Exponent != 0; Exponent >>= 1)
+			{
+				if (Exponent & 1)
+					Result = MultiplyModulo(Result, Base, Modulus);
+				Base = MultiplyModulo(Base, Base, Modulus);
+			}
+			return Result;
+		}
+	}
+
 	bool BlumBlumShub::IsPrimeNumber(std::uint64_t Number)
 	{
-		if (Number <= 1)
-			return false;
-		if (Number <= 3)
-			return true;
-		if (Number % 2 == 0 || Number % 3 == 0)
+		constexpr std::array<std::uint64_t, 12> SmallPrimes { 2, 3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37 };
+		if (Number < 2)
 			return false;
-		for (std::uint64_t Index = 5; Index * Index <= Number; Index += 6)
-			if (Number % Index == 0 || Number % (Index + 2) == 0)
+		for (const std::uint64_t SmallPrime : SmallPrimes)
+		{
+			if (Number == SmallPrime)
+				return true;
+			if (Number % SmallPrime == 0)
+				return false;
+		}
+
+		//Number - 1 = Odd * 2^Shift
+		const std::uint32_t Shift = std::countr_zero(Number - 1);
+		const std::uint64_t Odd = (Number - 1) >> Shift;
+
+		const MontgomeryArithmetic64 NumberArithmetic(Number);
+		const std::uint64_t MinusOne = NumberArithmetic.Subtract(0, NumberArithmetic.One);
+
+		//These 7 bases leave no strong pseudoprime below 2^64 (Jim Sinclair)
+		//这7个基在 2^64 以下没有强伪素数 (Jim Sinclair)
+		constexpr std::array<std::uint64_t, 7> Bases { 2, 325, 9375, 28178, 450775, 9780504, 1795265022 };
+		for (const std::uint64_t Base : Bases)
+		{
+			if (Base % Number == 0)
+				continue;
+
+			std::uint64_t Value = NumberArithmetic.Power(NumberArithmetic.ToMontgomery(Base), Odd);
+			if (Value == NumberArithmetic.One || Value == MinusOne)
+				continue;
+
+			bool IsWitnessPassed = false;
+			for (std::uint32_t Round = 1; Round < Shift && !IsWitnessPassed; ++Round)
+			{
+				Value = NumberArithmetic.Square(Value);
+				IsWitnessPassed = Value == MinusOne;
+			}
+			if (!IsWitnessPassed)
 				return false;
+		}
 		return true;
 	}
 
-	std::uint64_t BlumBlumShub::FastPowerAlgorithmWithModulus(std::uint64_t BaseNumber, std::uint64_t ExponentNumber, std::uint64_t ModulusNumber)
+	std::uint32_t BlumBlumShub::GenerateBlumPrime()
 	{
-		BaseNumber %= ModulusNumber;
-		std::uint64_t Result = 1;
-		while (ExponentNumber > 0)
+		std::uint32_t Candidate = 0;
+		do
 		{
-			if (ExponentNumber & 1)
-				Result = (Result * BaseNumber) % ModulusNumber;
-			BaseNumber = (BaseNumber * BaseNumber) % ModulusNumber;
-			ExponentNumber >>= 1;
-		}
-		return Result;
+			Candidate = static_cast<std::uint32_t>(LCG()) | 0x80000003U;
+		} while (!IsPrimeNumber(Candidate));
+		return Candidate;
+	}
+
+	void BlumBlumShub::JumpSteps(std::uint64_t Steps)
+	{
+		this->X_Montgomery = this->Arithmetic.Power(this->X_Montgomery, PowerModulo(2, Steps, this->Lambda));
 	}
 
 	void BlumBlumShub::ResetState(std::uint64_t Seed)
 	{
+		if (Seed == 0)
+			Seed = 1;
+
 		// Initialize the PRNG with the seed value.
 		LCG.seed(Seed);
 
-		// Choose two large prime numbers p and q that are congruent to 3 mod 4.
+		// Choose two distinct primes p and q of 32 bits that are congruent to 3 mod 4, so that n = p * q has 63 or 64 bits.
+		P = this->GenerateBlumPrime();
 		do
 		{
-			P = static_cast<std::uint32_t>(LCG());
-		} while (!this->IsPrimeNumber(P) || P % 4 != 3);
+			Q = this->GenerateBlumPrime();
+		} while (Q == P);
 
-		do
-		{
-			Q = static_cast<std::uint32_t>(LCG());
-		} while (!this->IsPrimeNumber(Q) || Q % 4 != 3);
-
-		// Compute n = p * q.
 		N = static_cast<std::uint64_t>(P) * static_cast<std::uint64_t>(Q);
+		Lambda = std::lcm(static_cast<std::uint64_t>(P - 1), static_cast<std::uint64_t>(Q - 1));
+		Arithmetic = MontgomeryArithmetic64(N);
+		BitsPerStep = static_cast<std::uint32_t>(std::bit_width(static_cast<std::uint64_t>(std::bit_width(N) - 1)) - 1);
 
-		// Choose a random seed value X that is co-prime to N and not 1 or 0.
+		// Choose a random value S that is co-prime to N and not 1 or 0, the start X is its square, a quadratic residue.
+		std::uint64_t S = 0;
 		do
 		{
-			X = ( static_cast<std::uint64_t>(LCG()) << 32 ) | static_cast<std::uint64_t>(LCG());
-		} while (std::gcd(X, N) != 1 || X == 1 || X == 0);
+			S = ((static_cast<std::uint64_t>(LCG()) << 32) | static_cast<std::uint64_t>(LCG())) % N;
+		} while (std::gcd(S, N) != 1 || S <= 1);
+		X_Montgomery = Arithmetic.Square(Arithmetic.ToMontgomery(S));
+
+		BitBuffer = 0;
+		BufferedBits = 0;
 	}
 
 	std::uint64_t BlumBlumShub::NumberGeneration(std::uint64_t Iterations)
 	{
-		/* Generate a sequence of random numbers using the BBS algorithm. */
+		if (Iterations == 0)
+			Iterations = 1;
 
-		// StateNumber is X mod N
-		std::uint64_t RandomNumber = X % N;
-
-		for (std::uint64_t Count = 0; Count < Iterations; ++Count)
+		if (Iterations < 64)
 		{
-			// Compute RandomNumber' = pow(RandomNumber, 2) mod N
-			RandomNumber = this->FastPowerAlgorithmWithModulus(RandomNumber, 2, N);
+			for (std::uint64_t Count = 0; Count < Iterations; ++Count)
+				X_Montgomery = Arithmetic.Square(X_Montgomery);
+		}
+		else
+			this->JumpSteps(Iterations);
 
-			std::cout << "Now Random Value of the 64 bit is:" << RandomNumber << std::endl;
+		return Arithmetic.FromMontgomery(X_Montgomery);
+	}
+
+	void BlumBlumShub::discard(unsigned long long Count)
+	{
+		//BitsPerStep outputs take exactly 64 steps, so whole groups of them are one jump, and the buffered bits are then refilled from the same positions of the new X
+		//BitsPerStep 个输出恰好消耗64步, 所以整组输出是一次跳跃, 然后从新 X 的相同位置重新填充缓冲的位
+		const std::uint64_t Groups = Count / BitsPerStep;
+		if (Groups != 0)
+		{
+			this->X_Montgomery = Arithmetic.Power(this->X_Montgomery, PowerModulo(PowerModulo(2, 64, Lambda), Groups, Lambda));
+			if (BufferedBits != 0)
+				BitBuffer = (Arithmetic.FromMontgomery(X_Montgomery) & ((std::uint64_t(1) << BitsPerStep) - 1)) >> (BitsPerStep - BufferedBits);
 		}
 
-		return RandomNumber;
+		for (std::uint64_t Rest = Count % BitsPerStep; Rest > 0; --Rest)
+			(*this)();
 	}
-}
\ No newline at end of file
+}
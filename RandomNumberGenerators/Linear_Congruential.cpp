@@ -8,16 +8,15 @@ namespace PseudoRandomNumberGenerators
 			Seed = 1;
 
 		//https://en.wikipedia.org/wiki/Linear_congruential_generator
-		constexpr std::uint64_t A = 6364136223846793005, B = 1442695040888963407;
-		std::uint64_t RandomNumber = Seed;
+		if (Iterations == 0)
+			return Seed;
 
-		for (std::uint64_t count = 0; count < Iterations; ++count)
-		{
-			RandomNumber = (A * RandomNumber + B) % std::numeric_limits<std::uint64_t>::max();
-			//std::cout << "This is random number: " << RandomNumber << std::endl;
-		}
-		//std::cout << std::endl;
-
-		return RandomNumber;
+		//A * X + B wraps around at 2^64 before `% max()`, so the sequence is the 2^64 one; the final `% max()` is kept for the same outputs
+		//(the old loop also applied it to every intermediate value, which only differs when a state is exactly 2^64 - 1, once per period of 2^64)
+		//A * X + B 在 `% max()` 之前已在 2^64 处回绕, 所以序列就是模 2^64 的序列; 保留最后的 `% max()` 以得到相同的输出
+		//(旧循环对每个中间值也做了这一步, 只有状态恰好为 2^64 - 1 时才不同, 每 2^64 的周期出现一次)
+		LinearCongruentialGenerator<LinearCongruentialModulus::TwoPower64> Generator(Seed);
+		Generator.discard(Iterations - 1);
+		return Generator() % std::numeric_limits<std::uint64_t>::max();
 	}
-}
\ No newline at end of file
+}
@@ -1,4 +1,5 @@
 #include "./PseudoRandomNumberGenerators.hpp"
+#include "./MersenneTwisterJumpPolynomials.h"
 
 namespace PseudoRandomNumberGenerators
 {
@@ -42,7 +43,7 @@ namespace PseudoRandomNumberGenerators
 
 	void MersenneTwister64Bit::ResetState(std::uint64_t Seed)
 	{
-		this->StateIndex = 0;
+		this->StateIndex = STATE_SIZE;
 		memory_set_no_optimize_function<0x00>(StateArray.data(), sizeof(std::uint64_t) * StateArray.size());
 
 		this->StateArray[0] = Seed;
@@ -116,7 +117,7 @@ namespace PseudoRandomNumberGenerators
 
 	void MersenneTwister32Bit::ResetState(std::uint32_t Seed)
 	{
-		this->StateIndex = 0;
+		this->StateIndex = STATE_SIZE;
 		memory_set_no_optimize_function<0x00>(StateArray.data(), sizeof(std::uint32_t) * StateArray.size());
 
 		this->StateArray[0] = Seed;
@@ -149,4 +150,393 @@ namespace PseudoRandomNumberGenerators
 
 		return RandomNumber;
 	}
-}
\ No newline at end of file
+
+	/* This is the block version */
+
+	namespace
+	{
+		using CommonToolkit::CPU_FeatureDispatch::CPU_Feature;
+		using CommonToolkit::CPU_FeatureDispatch::NoFeatures;
+
+		//The three modulo-free ranges of the SIMD kernels (MersenneTwister_SSE2.cpp), one word at a time
+		//与 SIMD 内核 (MersenneTwister_SSE2.cpp) 相同的三段无取模旋转, 每次一个字
+		template<typename Parameters>
+		void TwistStatePortable(typename Parameters::WordType* State)
+		{
+			using WordType = typename Parameters::WordType;
+			constexpr std::size_t N = Parameters::STATE_SIZE, M = Parameters::MIDDLE_WORD_OFFSET;
+
+			auto TwistWord = [State](std::size_t Index, std::size_t NextIndex, std::size_t FarIndex)
+			{
+				const WordType Spliced = (State[Index] & Parameters::UPPER_MASK) | (State[NextIndex] & Parameters::LOWER_MASK);
+				State[Index] = State[FarIndex] ^ (Spliced >> 1) ^ ((WordType(0) - (Spliced & 1)) & Parameters::TWIST_MATRIX_MAGIC_NUMBER);
+			};
+
+			std::size_t Index = 0;
+			for (; Index < N - M; ++Index)
+				TwistWord(Index, Index + 1, Index + M);
+			for (; Index < N - 1; ++Index)
+				TwistWord(Index, Index + 1, Index - (N - M));
+			TwistWord(N - 1, 0, M - 1);
+		}
+
+		template<typename Parameters>
+		void TemperStatePortable(const typename Parameters::WordType* State, typename Parameters::WordType* Values, std::size_t Count)
+		{
+			for (std::size_t Index = 0; Index < Count; ++Index)
+			{
+				typename Parameters::WordType Value = State[Index];
+				Value ^= (Value >> Parameters::TEMPERING_SHIFT_U) & Parameters::TEMPERING_MASK_D;
+				Value ^= (Value << Parameters::TEMPERING_SHIFT_S) & Parameters::TEMPERING_MASK_B;
+				Value ^= (Value << Parameters::TEMPERING_SHIFT_T) & Parameters::TEMPERING_MASK_C;
+				Value ^= Value >> Parameters::TEMPERING_SHIFT_L;
+				Values[Index] = Value;
+			}
+		}
+
+		using Parameters32Bit = MersenneTwisterKernels::Parameters32Bit;
+		using Parameters64Bit = MersenneTwisterKernels::Parameters64Bit;
+
+		#if defined(APPLIED_CRYPTOGRAPHY_HAS_AVX2_KERNELS)
+		constexpr MersenneTwisterBlockKernels<Parameters32Bit> MersenneTwister32BitKernelsAVX2 { "avx2", static_cast<std::uint32_t>(CPU_Feature::AVX2), &MersenneTwisterKernels::TwistState32BitAVX2, &MersenneTwisterKernels::TemperState32BitAVX2 };
+		constexpr MersenneTwisterBlockKernels<Parameters64Bit> MersenneTwister64BitKernelsAVX2 { "avx2", static_cast<std::uint32_t>(CPU_Feature::AVX2), &MersenneTwisterKernels::TwistState64BitAVX2, &MersenneTwisterKernels::TemperState64BitAVX2 };
+		#endif
+		#if defined(APPLIED_CRYPTOGRAPHY_HAS_SSE2_KERNELS)
+		constexpr MersenneTwisterBlockKernels<Parameters32Bit> MersenneTwister32BitKernelsSSE2 { "sse2", static_cast<std::uint32_t>(CPU_Feature::SSE2), &MersenneTwisterKernels::TwistState32BitSSE2, &MersenneTwisterKernels::TemperState32BitSSE2 };
+		constexpr MersenneTwisterBlockKernels<Parameters64Bit> MersenneTwister64BitKernelsSSE2 { "sse2", static_cast<std::uint32_t>(CPU_Feature::SSE2), &MersenneTwisterKernels::TwistState64BitSSE2, &MersenneTwisterKernels::TemperState64BitSSE2 };
+		#endif
+		constexpr MersenneTwisterBlockKernels<Parameters32Bit> MersenneTwister32BitKernelsPortable { "portable", NoFeatures, &TwistStatePortable<Parameters32Bit>, &TemperStatePortable<Parameters32Bit> };
+		constexpr MersenneTwisterBlockKernels<Parameters64Bit> MersenneTwister64BitKernelsPortable { "portable", NoFeatures, &TwistStatePortable<Parameters64Bit>, &TemperStatePortable<Parameters64Bit> };
+
+		constexpr const MersenneTwisterBlockKernels<Parameters32Bit>* MersenneTwister32BitKernelCandidates[] =
+		{
+			#if defined(APPLIED_CRYPTOGRAPHY_HAS_AVX2_KERNELS)
+			&MersenneTwister32BitKernelsAVX2,
+			#endif
+			#if defined(APPLIED_CRYPTOGRAPHY_HAS_SSE2_KERNELS)
+			&MersenneTwister32BitKernelsSSE2,
+			#endif
+			&MersenneTwister32BitKernelsPortable,
+		};
+
+		constexpr const MersenneTwisterBlockKernels<Parameters64Bit>* MersenneTwister64BitKernelCandidates[] =
+		{
+			#if defined(APPLIED_CRYPTOGRAPHY_HAS_AVX2_KERNELS)
+			&MersenneTwister64BitKernelsAVX2,
+			#endif
+			#if defined(APPLIED_CRYPTOGRAPHY_HAS_SSE2_KERNELS)
+			&MersenneTwister64BitKernelsSSE2,
+			#endif
+			&MersenneTwister64BitKernelsPortable,
+		};
+	}
+
+	template<>
+	std::span<const MersenneTwisterBlockKernels<MersenneTwisterKernels::Parameters32Bit>* const> MersenneTwister32BitBlock::KernelCandidates()
+	{
+		return MersenneTwister32BitKernelCandidates;
+	}
+
+	template<>
+	std::span<const MersenneTwisterBlockKernels<MersenneTwisterKernels::Parameters64Bit>* const> MersenneTwister64BitBlock::KernelCandidates()
+	{
+		return MersenneTwister64BitKernelCandidates;
+	}
+
+	/* This is the jump-ahead */
+
+	namespace MersenneTwisterJump
+	{
+		namespace
+		{
+			//Degree of both characteristic polynomials, the number of state bits the recurrence actually uses
+			//两个特征多项式的次数, 即递推实际使用的状态位数
+			constexpr std::size_t DEGREE = 19937;
+			constexpr std::size_t WORDS = std::tuple_size_v<Polynomial>;
+
+			//Coefficients consumed by one Horner step, and the size of the table of partial sums
+			//一次 Horner 步消耗的系数个数, 以及部分和表的大小
+			constexpr unsigned WINDOW_BITS = 6;
+			constexpr std::size_t WINDOW_SIZE = std::size_t(1) << WINDOW_BITS;
+
+			template<typename Parameters>
+			const Polynomial& CharacteristicPolynomial()
+			{
+				if constexpr (std::is_same_v<Parameters, Parameters32Bit>)
+					return CharacteristicPolynomial32Bit;
+				else
+					return CharacteristicPolynomial64Bit;
+			}
+
+			//2^PowerOfTwo mod Modulus
+			std::size_t PowerOfTwoModulo(std::uint32_t PowerOfTwo, std::size_t Modulus)
+			{
+				std::size_t Remainder = 1 % Modulus;
+				for (; PowerOfTwo > 0; --PowerOfTwo)
+					Remainder = (Remainder * 2) % Modulus;
+				return Remainder;
+			}
+
+			//Moves the low 32 bits of Value to the even bit positions; squaring over GF(2) is just a(t)^2 = a(t^2)
+			//把 Value 的低 32 位移到偶数位上; GF(2) 上的平方就是 a(t)^2 = a(t^2)
+			std::uint64_t SpreadBits(std::uint64_t Value)
+			{
+				Value &= 0xFFFFFFFFULL;
+				Value = (Value | (Value << 16)) & 0x0000FFFF0000FFFFULL;
+				Value = (Value | (Value << 8)) & 0x00FF00FF00FF00FFULL;
+				Value = (Value | (Value << 4)) & 0x0F0F0F0F0F0F0F0FULL;
+				Value = (Value | (Value << 2)) & 0x3333333333333333ULL;
+				Value = (Value | (Value << 1)) & 0x5555555555555555ULL;
+				return Value;
+			}
+
+			//Value = Value^2 mod Modulus
+			void SquareModulo(Polynomial& Value, const Polynomial& Modulus)
+			{
+				std::array<std::uint64_t, 2 * WORDS> Product;
+				for (std::size_t Index = 0; Index < WORDS; ++Index)
+				{
+					Product[2 * Index] = SpreadBits(Value[Index]);
+					Product[2 * Index + 1] = SpreadBits(Value[Index] >> 32);
+				}
+
+				//From the top down, each set coefficient at or above DEGREE is cleared by adding Modulus * t^(Bit - DEGREE)
+				//自高向低, 每个不低于 DEGREE 的非零系数都通过加上 Modulus * t^(Bit - DEGREE) 消去
+				for (std::size_t Bit = 2 * (DEGREE - 1); Bit >= DEGREE; --Bit)
+				{
+					if (((Product[Bit / 64] >> (Bit % 64)) & 1) == 0)
+						continue;
+
+					const std::size_t WordShift = (Bit - DEGREE) / 64, BitShift = (Bit - DEGREE) % 64;
+					for (std::size_t Index = 0; Index < WORDS; ++Index)
+					{
+						Product[Index + WordShift] ^= Modulus[Index] << BitShift;
+						if (BitShift != 0)
+							Product[Index + WordShift + 1] ^= Modulus[Index] >> (64 - BitShift);
+					}
+				}
+
+				std::copy_n(Product.begin(), WORDS, Value.begin());
+			}
+
+			//Value = Value / t mod Modulus; t is invertible because the constant coefficient of Modulus is 1
+			//Value = Value / t mod Modulus; 因为 Modulus 的常数项为 1, 所以 t 可逆
+			void DivideByT(Polynomial& Value, const Polynomial& Modulus)
+			{
+				if ((Value[0] & 1) != 0)
+					for (std::size_t Index = 0; Index < WORDS; ++Index)
+						Value[Index] ^= Modulus[Index];
+
+				for (std::size_t Index = 0; Index + 1 < WORDS; ++Index)
+					Value[Index] = (Value[Index] >> 1) | (Value[Index + 1] << 63);
+				Value[WORDS - 1] >>= 1;
+			}
+
+			//The state as a ring of words whose oldest word is at Head, so one step of the recurrence rewrites a single word
+			//把状态看作一个环, 最旧的字在 Head 处, 这样递推的一步只改写一个字
+			template<typename Parameters>
+			struct StateRing
+			{
+				using WordType = typename Parameters::WordType;
+				static constexpr std::size_t N = Parameters::STATE_SIZE, M = Parameters::MIDDLE_WORD_OFFSET;
+
+				std::array<WordType, N> Words {};
+				std::size_t Head = 0;
+
+				void Step()
+				{
+					const std::size_t Next = Head + 1 == N ? 0 : Head + 1;
+					const std::size_t Far = Head + M < N ? Head + M : Head + M - N;
+					const WordType Spliced = (Words[Head] & Parameters::UPPER_MASK) | (Words[Next] & Parameters::LOWER_MASK);
+					Words[Head] = Words[Far] ^ (Spliced >> 1) ^ ((WordType(0) - (Spliced & 1)) & Parameters::TWIST_MATRIX_MAGIC_NUMBER);
+					Head = Next;
+				}
+
+				//Adds a state stored oldest word first
+				//加上一个按最旧的字在前存放的状态
+				void Add(const WordType* Other)
+				{
+					const std::size_t Wrapped = N - Head;
+					for (std::size_t Index = 0; Index < Wrapped; ++Index)
+						Words[Head + Index] ^= Other[Index];
+					for (std::size_t Index = 0; Index < Head; ++Index)
+						Words[Index] ^= Other[Wrapped + Index];
+				}
+
+				void CopyTo(WordType* Other) const
+				{
+					std::copy(Words.begin() + Head, Words.end(), Other);
+					std::copy(Words.begin(), Words.begin() + Head, Other + (N - Head));
+				}
+			};
+
+			/*
+				State = F^D(State), where F is one step of the word recurrence and Jump = t^(D - 1) mod the characteristic polynomial.
+				Jump(F) is evaluated with Horner's rule WINDOW_BITS coefficients at a time: Sum = F^WINDOW_BITS(Sum) + h(F) State,
+				where h(F) State comes from a table built once for all 2^WINDOW_BITS polynomials h, so there is one state addition per window instead of one per set coefficient.
+				State = F^D(State), 其中 F 是字递推的一步, Jump = t^(D - 1) 模特征多项式。
+				Jump(F) 用 Horner 法则每次处理 WINDOW_BITS 个系数: Sum = F^WINDOW_BITS(Sum) + h(F) State,
+				其中 h(F) State 取自一次建好的、覆盖全部 2^WINDOW_BITS 个多项式 h 的表, 因此每个窗口只做一次状态加法, 而不是每个非零系数一次。
+			*/
+			template<typename Parameters>
+			void JumpState(typename Parameters::WordType* State, const Polynomial& Jump)
+			{
+				using WordType = typename Parameters::WordType;
+				constexpr std::size_t N = Parameters::STATE_SIZE;
+
+				//Table[h] = h(F) State, oldest word first
+				std::vector<WordType> Table(WINDOW_SIZE * N);
+				StateRing<Parameters> Power;
+				std::copy_n(State, N, Power.Words.begin());
+				for (unsigned Bit = 0; Bit < WINDOW_BITS; ++Bit)
+				{
+					Power.CopyTo(&Table[(std::size_t(1) << Bit) * N]);
+					Power.Step();
+				}
+				for (std::size_t Entry = 3; Entry < WINDOW_SIZE; ++Entry)
+				{
+					if (std::has_single_bit(Entry))
+						continue;
+
+					const std::size_t LowestBit = Entry & (0 - Entry);
+					for (std::size_t Index = 0; Index < N; ++Index)
+						Table[Entry * N + Index] = Table[(Entry ^ LowestBit) * N + Index] ^ Table[LowestBit * N + Index];
+				}
+
+				StateRing<Parameters> Sum;
+				bool IsZero = true;
+				for (std::size_t Window = (DEGREE + WINDOW_BITS - 1) / WINDOW_BITS; Window-- > 0;)
+				{
+					if (!IsZero)
+						for (unsigned Count = 0; Count < WINDOW_BITS; ++Count)
+							Sum.Step();
+
+					const std::size_t Bit = Window * WINDOW_BITS;
+					std::uint64_t Coefficients = Jump[Bit / 64] >> (Bit % 64);
+					if (Bit % 64 + WINDOW_BITS > 64 && Bit / 64 + 1 < WORDS)
+						Coefficients |= Jump[Bit / 64 + 1] << (64 - Bit % 64);
+					Coefficients &= WINDOW_SIZE - 1;
+
+					if (Coefficients != 0)
+					{
+						Sum.Add(&Table[Coefficients * N]);
+						IsZero = false;
+					}
+				}
+
+				//The recurrence reads only the top bit of the oldest word, so the sum gets that word's lower bits wrong; one more step shifts it out
+				//递推只读取最旧字的最高位, 因此求和所得该字的低位不对; 再走一步把它移出
+				Sum.Step();
+				Sum.CopyTo(State);
+			}
+		}
+
+		template<typename Parameters>
+		Polynomial ComputeJumpPolynomial(std::uint32_t PowerOfTwo)
+		{
+			const Polynomial& Modulus = CharacteristicPolynomial<Parameters>();
+
+			//t^(2^PowerOfTwo) by squaring t, then divided by t^(Remainder + 1), where D = 2^PowerOfTwo - Remainder
+			//对 t 反复平方得到 t^(2^PowerOfTwo), 再除以 t^(Remainder + 1), 其中 D = 2^PowerOfTwo - Remainder
+			Polynomial Value {};
+			Value[0] = 2;
+			for (std::uint32_t Count = 0; Count < PowerOfTwo; ++Count)
+				SquareModulo(Value, Modulus);
+			for (std::size_t Count = PowerOfTwoModulo(PowerOfTwo, Parameters::STATE_SIZE) + 1; Count > 0; --Count)
+				DivideByT(Value, Modulus);
+			return Value;
+		}
+
+		template<typename Parameters>
+		const Polynomial& JumpPolynomial(std::uint32_t PowerOfTwo)
+		{
+			if constexpr (std::is_same_v<Parameters, Parameters32Bit>)
+			{
+				if (PowerOfTwo == 64)
+					return JumpPolynomial32Bit_2Power64;
+				if (PowerOfTwo == 128)
+					return JumpPolynomial32Bit_2Power128;
+			}
+			else
+			{
+				if (PowerOfTwo == 64)
+					return JumpPolynomial64Bit_2Power64;
+				if (PowerOfTwo == 128)
+					return JumpPolynomial64Bit_2Power128;
+			}
+
+			//Map nodes never move, so the returned reference stays valid after the lock is released
+			//map 的节点不会移动, 所以解锁后返回的引用仍然有效
+			static std::mutex Mutex;
+			static std::map<std::uint32_t, Polynomial> Computed;
+			std::scoped_lock Lock(Mutex);
+			auto [Iterator, IsInserted] = Computed.try_emplace(PowerOfTwo);
+			if (IsInserted)
+				Iterator->second = ComputeJumpPolynomial<Parameters>(PowerOfTwo);
+			return Iterator->second;
+		}
+
+		template<typename Parameters>
+		void JumpAhead(typename Parameters::WordType* State, std::size_t& Index, std::uint32_t PowerOfTwo)
+		{
+			constexpr std::size_t N = Parameters::STATE_SIZE;
+
+			//2^PowerOfTwo = D + Remainder: the block jumps D words (a multiple of N), the index moves Remainder outputs
+			//2^PowerOfTwo = D + Remainder: 整块跳过 D 个字 (N 的倍数), 下标前移 Remainder 个输出
+			if (PowerOfTwo >= std::bit_width(N))
+				JumpState<Parameters>(State, JumpPolynomial<Parameters>(PowerOfTwo));
+
+			Index += PowerOfTwoModulo(PowerOfTwo, N);
+			if (Index > N)
+			{
+				TwistStatePortable<Parameters>(State);
+				Index -= N;
+			}
+		}
+
+		template Polynomial ComputeJumpPolynomial<MersenneTwisterKernels::Parameters32Bit>(std::uint32_t PowerOfTwo);
+		template Polynomial ComputeJumpPolynomial<MersenneTwisterKernels::Parameters64Bit>(std::uint32_t PowerOfTwo);
+		template const Polynomial& JumpPolynomial<MersenneTwisterKernels::Parameters32Bit>(std::uint32_t PowerOfTwo);
+		template const Polynomial& JumpPolynomial<MersenneTwisterKernels::Parameters64Bit>(std::uint32_t PowerOfTwo);
+		template void JumpAhead<MersenneTwisterKernels::Parameters32Bit>(std::uint32_t* State, std::size_t& Index, std::uint32_t PowerOfTwo);
+		template void JumpAhead<MersenneTwisterKernels::Parameters64Bit>(std::uint64_t* State, std::size_t& Index, std::uint32_t PowerOfTwo);
+	}
+
+	void MersenneTwister64Bit::JumpAhead(std::uint32_t PowerOfTwo)
+	{
+		std::size_t Index = this->StateIndex;
+		MersenneTwisterJump::JumpAhead<MersenneTwisterKernels::Parameters64Bit>(this->StateArray.data(), Index, PowerOfTwo);
+		this->StateIndex = static_cast<std::uint32_t>(Index);
+	}
+
+	std::vector<MersenneTwister64Bit> MersenneTwister64Bit::Split(std::size_t Count)
+	{
+		std::vector<MersenneTwister64Bit> Substreams;
+		Substreams.reserve(Count);
+		for (std::size_t Index = 0; Index < Count; ++Index)
+		{
+			Substreams.push_back(*this);
+			this->JumpAhead(SUBSTREAM_POWER_OF_TWO);
+		}
+		return Substreams;
+	}
+
+	void MersenneTwister32Bit::JumpAhead(std::uint32_t PowerOfTwo)
+	{
+		std::size_t Index = this->StateIndex;
+		MersenneTwisterJump::JumpAhead<MersenneTwisterKernels::Parameters32Bit>(this->StateArray.data(), Index, PowerOfTwo);
+		this->StateIndex = static_cast<std::uint32_t>(Index);
+	}
+
+	std::vector<MersenneTwister32Bit> MersenneTwister32Bit::Split(std::size_t Count)
+	{
+		std::vector<MersenneTwister32Bit> Substreams;
+		Substreams.reserve(Count);
+		for (std::size_t Index = 0; Index < Count; ++Index)
+		{
+			Substreams.push_back(*this);
+			this->JumpAhead(SUBSTREAM_POWER_OF_TWO);
+		}
+		return Substreams;
+	}
+}
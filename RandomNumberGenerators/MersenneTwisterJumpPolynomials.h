@@ -0,0 +1,521 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+/*
+	Precomputed GF(2) polynomials for the Mersenne Twister jump-ahead in MersenneTwister.cpp, 312 words of 64 bits each, least significant coefficient first.
+	The characteristic polynomials were found with Berlekamp-Massey on the top bit of the state word sequence.
+	Each jump polynomial is t^(D - 1) mod the characteristic polynomial, where D is the largest multiple of STATE_SIZE that is at most 2^k, so the jumped state stays a whole twisted block.
+	MersenneTwister.cpp 中梅森旋转跳跃所用的预计算 GF(2) 多项式, 每个 312 个 64 位字, 低次系数在前。
+	特征多项式由 Berlekamp-Massey 算法对状态字序列的最高位求得。
+	每个跳跃多项式是 t^(D - 1) 模特征多项式, 其中 D 是不超过 2^k 的 STATE_SIZE 的最大倍数, 使跳跃后的状态仍是一个完整的旋转块。
+*/
+namespace PseudoRandomNumberGenerators::MersenneTwisterJump
+{
+	using Polynomial = std::array<std::uint64_t, 312>;
+
+	//Characteristic polynomial of the MT19937 word recurrence (degree 19937, bit i is the coefficient of t^i)
+	//MT19937 字递推的特征多项式 (次数 19937, 第 i 位是 t^i 的系数)
+	inline constexpr Polynomial CharacteristicPolynomial32Bit
+	{
+		0x0000000000000001ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000002000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000100ULL, 0x0000000000000000ULL,
+		0x0002000000000000ULL, 0x0000080000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000004000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x2000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000200000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0100000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000008000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x4000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000200000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000010ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000008000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000400ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000020000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000020000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000002ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000020000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000002000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0020000000000000ULL, 0x0000002000000000ULL, 0x0000000080000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000100ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000080000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000004000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000200000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000200000000000ULL, 0x0002000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000010000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000020ULL,
+		0x0000000000000200ULL, 0x0000000000000000ULL, 0x0000010000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000020000ULL, 0x0000000000200800ULL, 0x0000000000008000ULL,
+		0x0200000000000000ULL, 0x0100400000000000ULL, 0x0000000000000000ULL, 0x0000000020000000ULL,
+		0x0000000000000000ULL, 0x0000000008000000ULL, 0x0000000000000000ULL, 0x0000000000000021ULL,
+		0x4000000000000000ULL, 0x0000020000000000ULL, 0x0000010000000000ULL, 0x0000000020000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0020000000000000ULL,
+		0x0000800000000000ULL, 0x0000020000000000ULL, 0x0000000000000000ULL, 0x0000000021000000ULL,
+		0x0000000000000000ULL, 0x0000000000001000ULL, 0x0800000000000002ULL, 0x0020000000000001ULL,
+		0x0000000000000000ULL, 0x0000020000000000ULL, 0x0000000840000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000020000ULL, 0x0800000000000042ULL, 0x0020000000000000ULL,
+		0x0000000000000000ULL, 0x0000001000000000ULL, 0x0000000000000000ULL, 0x0000000021000000ULL,
+		0x0000000000000000ULL, 0x0000000000000080ULL, 0x0000000000000002ULL, 0x0020000000000001ULL,
+		0x0000040000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000002000ULL, 0x0000000000000080ULL, 0x0000000000000002ULL, 0x0021000000000000ULL,
+		0x0000000000000000ULL, 0x0000001000000000ULL, 0x0000000000000000ULL, 0x0000000001080000ULL,
+		0x0000000000002000ULL, 0x0000000000000000ULL, 0x0840000000000002ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000020000000000ULL, 0x0000000042000000ULL, 0x0000000000080000ULL,
+		0x0000000000002000ULL, 0x1000000000000000ULL, 0x0000000000000000ULL, 0x0021000000000000ULL,
+		0x0000000000000000ULL, 0x0000000080000000ULL, 0x0000000002000000ULL, 0x0000000001000000ULL,
+		0x0000000000002000ULL, 0x0000000000000004ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000002000000000ULL, 0x0000000080000000ULL, 0x0000000002000000ULL, 0x0000000000000000ULL,
+		0x0000000000002100ULL, 0x1000000000000000ULL, 0x0000000000000000ULL, 0x0001080000000000ULL,
+		0x0000002000000000ULL, 0x0000000000000000ULL, 0x0000000002000000ULL, 0x0000000000084000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0042000000000000ULL, 0x0000080000000000ULL,
+		0x0000002000000000ULL, 0x0000000000000000ULL, 0x0000000000100000ULL, 0x0000000000000000ULL,
+		0x0000000000000100ULL, 0x0080000000000000ULL, 0x0002000000000000ULL, 0x0000000000000000ULL,
+		0x0000002000000000ULL, 0x0000000004000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x2000000000000000ULL, 0x0080000000000000ULL, 0x0002000000000000ULL, 0x0000000000000000ULL,
+		0x0000000100000000ULL, 0x0000000000000000ULL, 0x0000000000100000ULL, 0x0000000000000000ULL,
+		0x2000000000000008ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000004000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000200ULL,
+		0x0000000000000008ULL, 0x0000000000000000ULL, 0x0000100000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000008000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0004000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000200000000ULL,
+	};
+
+	//t^(D - 1) mod the characteristic polynomial, D = 624 * floor(2^64 / 624)
+	//t^(D - 1) 模特征多项式, D = 624 * floor(2^64 / 624)
+	inline constexpr Polynomial JumpPolynomial32Bit_2Power64
+	{
+		0xAD56F1245266A648ULL, 0x91790162F0B13AAAULL, 0x94CDE63DEEA5BBA9ULL, 0x1FDFFFC23BB1D838ULL,
+		0xC61A16E59DFDAA5AULL, 0xF0337105A677AFE5ULL, 0x0840A9D6EDBBF17CULL, 0x732C4599C6AF1FE8ULL,
+		0xEBD5EC8F299D7F21ULL, 0x40DA33FC334A33CAULL, 0xD7DCD94DAA1A3DD1ULL, 0x5598CCA484E2B34DULL,
+		0x0838C9AC22263118ULL, 0x96E961D3C2C78A1AULL, 0xF5AF168F044633ADULL, 0xB57720DE5F6EC324ULL,
+		0x3E9F23EF3287C808ULL, 0xC3440473A32845ADULL, 0x3F627824584D8EB6ULL, 0xE81850FF60001FFDULL,
+		0x1FD1C1EB1A9C181DULL, 0xC97783BFED77AC1FULL, 0xFC2E10FC02C185DDULL, 0x7A93439D2EA1E226ULL,
+		0x140AFBA3DF49A60CULL, 0xDD036C931BD3BDF8ULL, 0x73DFA7A9658158EEULL, 0xCB38118AB5FDD743ULL,
+		0x8E8EF6ADB59C0AEDULL, 0x4B22B304604EF313ULL, 0xD70143EA581CD879ULL, 0x32B459B850D4BBBAULL,
+		0x4BC6E353232623CCULL, 0x98ACF1596C0AF982ULL, 0xCD8C6C4D552D8AE5ULL, 0xA01F1BCB49A40BA1ULL,
+		0x00D4713EDD4DF3E6ULL, 0x0802A4A81401D6F0ULL, 0x64B381805EB9BE8BULL, 0xD260BF745CB13B52ULL,
+		0x09B93BFF7C3F1323ULL, 0x5AA407CE491F3DF1ULL, 0x8E7ACDB0C7F45370ULL, 0x8A5851427A411B44ULL,
+		0x4D11DB3DCF930387ULL, 0xC40449DF673619C0ULL, 0xAAC38371347C187AULL, 0x96844A3146F012DEULL,
+		0x175AA756490CE72DULL, 0xC2D65EE13D97EAA4ULL, 0xC04BD34B54C797E6ULL, 0x68E94E7DE14685D0ULL,
+		0x7C0216F3E26AF16CULL, 0xCFC998E94DEEC937ULL, 0xBB7BE2A1315CF400ULL, 0x329208019DFC5E47ULL,
+		0xC24CB63165DD5ACBULL, 0x688EF8E4C4CCE32CULL, 0xB4088114AEC9EE29ULL, 0xADD6D03751B4C91DULL,
+		0x6377A86D66CA998EULL, 0x34A08793C3E48C37ULL, 0x266492E5391D750FULL, 0x7BB48D9C62CC823BULL,
+		0xA1FF8747CDF2077DULL, 0xD46B9603EF1633D5ULL, 0xC0EF352731022023ULL, 0xA61B4F2871CDA587ULL,
+		0xD7EAE71B3CA7DED5ULL, 0xD0BB1D46C6BDF426ULL, 0xEDFC985E081662E5ULL, 0x40A036E613826749ULL,
+		0x4CF45201CD6D34BEULL, 0x115F1F6FDD374AB9ULL, 0x567F229374383668ULL, 0xA16DADE38C881506ULL,
+		0x0A6958D996415A90ULL, 0x9B98C0B7CEC61C0CULL, 0x96FD4FACE61F7EB5ULL, 0x808435F3BE6DF5FEULL,
+		0xE0CCD10D87DBE943ULL, 0x7AF1C40AAE130283ULL, 0x4153F04C86E33E86ULL, 0x0D174C21013DA0AAULL,
+		0x70CDC764031DFB79ULL, 0xF8AC0651E3AA5289ULL, 0xB6727305C52D879BULL, 0xFA5E1E8EDF21E21FULL,
+		0x4DAE429D64ACC9D8ULL, 0x4EEEDE35C9A4FAC2ULL, 0x21E877709E955C93ULL, 0x4CC0F60DBDC8EA53ULL,
+		0x82AED59BC7E4B8D1ULL, 0xF18492B5EBABC445ULL, 0x2C00C2743464B7EFULL, 0x4C61D708C6C5AFCDULL,
+		0xA9379CE19E20E072ULL, 0xA7BECE45346F8B22ULL, 0x7E86C9FAD614FD68ULL, 0xDDA3D31717E9B2A3ULL,
+		0x26B4C4F3C4CC6B98ULL, 0x3239521DFFD7C86AULL, 0x530986C5BC583911ULL, 0xCC42A2AA20F397DEULL,
+		0xD6A26AB5576A8161ULL, 0xBE77A545EF6754FFULL, 0x9238D4700A975171ULL, 0xC07ED2AD5F351BA9ULL,
+		0x1EF656C4DFB2ED12ULL, 0x933B3F61B058E615ULL, 0x95CF1E257431E0FAULL, 0x0E0373E23F5F6747ULL,
+		0x70FD34D9AEF0C008ULL, 0x5D156DB169FB87DCULL, 0x569358A83BB123AEULL, 0x5649F484A2C0CD98ULL,
+		0x5E4340C7C9B27F53ULL, 0x3F8F4A318CAFF436ULL, 0xC8D120701605E0C8ULL, 0xA24CC9E6442505EDULL,
+		0x4A3B4F3365D11CCEULL, 0x96B7FD794CA28DCFULL, 0x491ABD2CCD178263ULL, 0x7F59278219670E12ULL,
+		0x46002E9D676C149DULL, 0x1090BB3B9127BF8FULL, 0x1196B59147D1918EULL, 0xF42F550CB5026253ULL,
+		0x9C27A9CB49B7F0A7ULL, 0x1AE8BC6EF7D7EDC6ULL, 0x0965ABA17E23A4D1ULL, 0xE8BDA0AF98447A19ULL,
+		0xDB8D0ADE1868DB9DULL, 0x0E9662EE5C5DAFE4ULL, 0x68F00A307B4002D7ULL, 0x35B4ED162340EB4BULL,
+		0x4C5BA896BAB2B67CULL, 0xF91C0B3687C1BBAFULL, 0x78BC969F6F95872AULL, 0xC697F41CF8FA7935ULL,
+		0xB4D736094ABB0D42ULL, 0x05D2794862CDA0EEULL, 0x960FA825CE38CDDEULL, 0xC7BF2FF733EA43A4ULL,
+		0x9D31A79EB5744803ULL, 0xB55EAD1E7295A30FULL, 0x529FB2F8D11DF873ULL, 0xB6595D8A0A0C1466ULL,
+		0x003C2F15D05F856EULL, 0x09F8DB47E48F26E6ULL, 0xEEEBD6326527E500ULL, 0x03A9F3E88218B48FULL,
+		0x0C04F43512FBEC96ULL, 0x0DEFF7999069AD23ULL, 0xBBEE27CD4145B2DAULL, 0xE816AA63EC3E2CECULL,
+		0x16C8F94F016AFD4FULL, 0x0EEFDA27DE210ED8ULL, 0xC6234D359F8E4491ULL, 0xAB4C9A809449D367ULL,
+		0xFDEA69F73B7EC5C2ULL, 0x746A8B52CC2E1E5DULL, 0x88858C423A0BB505ULL, 0x6946FAB41167DFE0ULL,
+		0xE69A887C92BA36B8ULL, 0x0A285044DBCAF8C6ULL, 0x853EC28B3CAD3AEEULL, 0x7CA7C531AB812424ULL,
+		0x9903A7651F78B7ABULL, 0x0C879C5956525260ULL, 0x54B74E66D8F4AF22ULL, 0xCFBB71875E40BBC3ULL,
+		0xB8BFDADB2CD7A24AULL, 0x0E5FB807B60FB64CULL, 0xB39A3AD1DB687BAFULL, 0xAF1B14AD644532B7ULL,
+		0x0E5D2F4B1EE59042ULL, 0x4D7DE7E56775E4D9ULL, 0x058CB54680B7C621ULL, 0x2715B20EFC1A597BULL,
+		0xAE0CF2182E8FF89BULL, 0xD0B2FF72D8D5F376ULL, 0x4D031FAA5ABE277BULL, 0xC2A879B334D3A367ULL,
+		0xFFBB67B5B8A8343CULL, 0xE10791BFCD5DE91BULL, 0xAAB11EB657DF4D48ULL, 0xF211C27E0B19DB45ULL,
+		0x29C11189ABD48C89ULL, 0x40FE75576CA437EEULL, 0x4A3EAB0BF320A584ULL, 0x08FEFD5C311B7729ULL,
+		0x7CEA3C350385C65EULL, 0xE50D23ABEE63285BULL, 0x3F618A9396C3DDBCULL, 0x65365F84A6A369E5ULL,
+		0x11155CCFF5B0C9F9ULL, 0x700973228A08D9A0ULL, 0xBA934974EEDC7384ULL, 0xCEAEAA0DE27E7D73ULL,
+		0x18193AB132729C41ULL, 0x6FD353A37B3FDEE2ULL, 0xBFA1F3755E79E385ULL, 0x669D66D4458C62D1ULL,
+		0x2FFB44929804F26AULL, 0x400EFE87DD05D89BULL, 0xE21FB6B68E24A49BULL, 0xA79CA3D5155E89B3ULL,
+		0x1E9E9BCA4E7610A3ULL, 0xCAC75BE6A9ACFB19ULL, 0xAADCC6EC5C06EF00ULL, 0xE893D598B87B01E1ULL,
+		0xFC140A879E0AFCF2ULL, 0x0FAACD06DDB7D39EULL, 0x480CA59820014A84ULL, 0xFA85A561B29D43BAULL,
+		0x6B610A370F84E0EDULL, 0xDFA2FEBA1ACCD6FCULL, 0x273B4A715D3A06A8ULL, 0xE76470AE2BD1CC31ULL,
+		0xE547EEFD195CB064ULL, 0xE239234D67333AD8ULL, 0x742DA859DADB00D5ULL, 0x9584AC0C3D708058ULL,
+		0x40D5B0279522EB5AULL, 0xD3387A0625EA8308ULL, 0x5834794E33132A75ULL, 0xCE1B3A795E2D11FEULL,
+		0x447083BF1AD30FEEULL, 0x83E0B864970BE491ULL, 0xA59E3709D29C8783ULL, 0xC4AF08B5227E1A9AULL,
+		0x4E30EC621355FDC4ULL, 0x2D96350B4C5177E5ULL, 0xB110C9AC1C9BA648ULL, 0x66EA4BBE098C51FEULL,
+		0x4D8F29A4D008F87AULL, 0xF344AE7E676EC5B6ULL, 0xEE4F58AFEDCC55E3ULL, 0x9213232BD40B2F79ULL,
+		0x1342AFDC6FFB0891ULL, 0x4CB3CDA4F15B62B3ULL, 0x00E205CAAD430580ULL, 0xE99C364F09D48A47ULL,
+		0x69B3BCBA50CF1845ULL, 0xE4E9D45FE69AB35EULL, 0x11A4746F74C4A7C4ULL, 0x2479530D9703FC40ULL,
+		0xA9B2996A5E514B4DULL, 0x47B74778567AAE3AULL, 0xDF9727E02CEA4B72ULL, 0x2B6675F41BE2E7A7ULL,
+		0x0539C599E2B5B3A5ULL, 0x8EBA50613027EBC7ULL, 0x85D26F0927FFB8EDULL, 0x6EB5549A3B073C79ULL,
+		0x78A90AE42A5756B9ULL, 0x53C957A15687A338ULL, 0xA001BE1F6526107CULL, 0xE2CC13F91CB60FEEULL,
+		0x5528DAA88D02F9B4ULL, 0x5F859F2061AEF3C9ULL, 0xECE061D75D03A7EFULL, 0xE370AE07700B8AEBULL,
+		0xC298FBB404D8B658ULL, 0x6DAFD135A686E906ULL, 0x945EC82996002F96ULL, 0x10103875166A2000ULL,
+		0x76BF7B7CB174CE4AULL, 0x0314CC76BCFCC6C0ULL, 0xB2B99B52A2CFD5C7ULL, 0x29171A07FBA56F08ULL,
+		0xE902C348615ECF5CULL, 0x567217177D8099EEULL, 0xD7D8EC2BCE5F9E70ULL, 0x19744C437B01AE58ULL,
+		0xC5C82AAA428191F6ULL, 0xCEFF1B2E8670C5B9ULL, 0xF15BB77A862CB34EULL, 0x49F175BE29CFC931ULL,
+		0x0BBD1ADE069E8A4CULL, 0x7F503969D724AA3DULL, 0x6E46BE67832839FAULL, 0x96127C7084F93887ULL,
+		0x5AD40BD31D1EE082ULL, 0xE2BDBC7BEAE04063ULL, 0xFD04A18D2B827BA0ULL, 0xE230177CCAF8AD1FULL,
+		0x98D6EA56871F6CA2ULL, 0xCC191842D2C43CA6ULL, 0x0816C81E74B05E7DULL, 0x45671FED29DE0F3CULL,
+		0x08FC9C1E4F5BADEEULL, 0x6EA64AC0E75E208DULL, 0x903F27EC512E4523ULL, 0x9A7D09310AFC2BFDULL,
+		0x1DCE6C6CC60BFAF7ULL, 0xCD47C5EEDCFD32BDULL, 0x416B531FD0131035ULL, 0x909DB139D948BD93ULL,
+		0x10AEFBEF6A112459ULL, 0x4E7A86B04875135DULL, 0x1360865EEB6192BDULL, 0x5D6B252A175E14F5ULL,
+		0x45BCD8EA82FE17B8ULL, 0x9B413F1E15ED3BFAULL, 0xBE93334F8A902D8EULL, 0x7DFDB8FEC103855BULL,
+		0xAE990D550DEB4ECFULL, 0x5865AF4E7B0DC41FULL, 0xD3BA072119C201F8ULL, 0x000000000F630853ULL,
+	};
+
+	//t^(D - 1) mod the characteristic polynomial, D = 624 * floor(2^128 / 624)
+	//t^(D - 1) 模特征多项式, D = 624 * floor(2^128 / 624)
+	inline constexpr Polynomial JumpPolynomial32Bit_2Power128
+	{
+		0xDF94096AA45AF3ABULL, 0x85A424D5725856DCULL, 0xF4B69CE71F4945C1ULL, 0x04F5797457B098E9ULL,
+		0xE0C0A63D99AA422BULL, 0xFF5E83DE449D3E41ULL, 0x28A3EE5F80DEC133ULL, 0xCD7F7ABA71533EF3ULL,
+		0x7869EF655C19A684ULL, 0xEC42381DAAB0FEACULL, 0xD9CDC7A177AE401DULL, 0xEB0E7F69906FDBB0ULL,
+		0xA3A0B0BBE7AF9F2DULL, 0x4754E7D5C7422174ULL, 0x1D8D6DF6AC2E8760ULL, 0xFA02506C41442ED3ULL,
+		0x889C94245B6213A6ULL, 0x3C5CDDE48116D6BEULL, 0xDF66461910841691ULL, 0x281AA032A879C690ULL,
+		0x4CEFE6254741528AULL, 0x95DAD8836FD11756ULL, 0xAEF5BEEEF082FBE9ULL, 0x9527B5D5488FC0A9ULL,
+		0x854295CEA4DDA26AULL, 0x75792ED89DEF95DCULL, 0x40DDF06ECAAC30C2ULL, 0xE8DDCB17E3AE53A6ULL,
+		0xEBAAA63B5C3DE220ULL, 0xCC0CAABFDA792739ULL, 0x01F39E941002B875ULL, 0xBC508A6493256602ULL,
+		0x2177744BCAF87DBDULL, 0xB3F3A8F455E64061ULL, 0x3A0743F789986642ULL, 0x82AB20C30FB02EDDULL,
+		0x1752B549C7F390B9ULL, 0x5FF4A61B044BEE21ULL, 0xCB70B866B3D096ACULL, 0xBE01165FC47C61F6ULL,
+		0x80DCFA5370CE373AULL, 0x4EFD2DF701CAC31EULL, 0x52B718FDE1B7C452ULL, 0x6B7A0C18202242DEULL,
+		0xF3B3EDA51C55E4FBULL, 0x58994439C345555CULL, 0x34A2F182EAB61A93ULL, 0x6CBD7398090700BAULL,
+		0xB6912E77017DAB28ULL, 0x46FC626EBEF34B68ULL, 0x0188D493EB42D9EDULL, 0xD7C006D7C80D27ACULL,
+		0x36B322EC6A6B8C96ULL, 0x9649CB74255DA70AULL, 0xEDC9C8CFA8C889AFULL, 0x79CC279316783856ULL,
+		0x779DD35E05CE03ECULL, 0x74202A29ED6B8958ULL, 0x0CBD1BADE5D71B54ULL, 0x130CDAB8B39390A9ULL,
+		0xD2B09627C6785150ULL, 0x3BE9BAC0BA45F052ULL, 0xF6553FC63E4B6EB9ULL, 0x8793FE8C3E923A50ULL,
+		0xA5F4DFB9F5474C43ULL, 0xD3EB012968E46993ULL, 0x977A5299008F6628ULL, 0xFA785B503AD16A4BULL,
+		0x4A8B8BCB64E51CEDULL, 0xDBE9B3BACFA08B25ULL, 0x30FFC163DEF3679DULL, 0x5B0A6368618D98F0ULL,
+		0xC9DD34E7D2DF1F29ULL, 0x41CB2CE994E1AC96ULL, 0x7E7D8671631377ABULL, 0x258019C0079220E7ULL,
+		0x287D3C05B90B0880ULL, 0xDB8E545B8FB9588DULL, 0xAA3ADD677FD5A17EULL, 0x9AB777BC48E1459CULL,
+		0xEE4004368A20E4E1ULL, 0xDAE18764CB623A48ULL, 0x54990D6ED12A7216ULL, 0xE185F72DCB1D1B09ULL,
+		0x28A7EA0781AE3AE3ULL, 0x1C11087CF74F4E40ULL, 0xD6D62989A2597547ULL, 0x539FEB0B4E2F1D0AULL,
+		0x5F5DC053DE1C25F5ULL, 0x6C8EAE99AE61426AULL, 0x88848720C635D3A4ULL, 0x23167FDE19DDCC94ULL,
+		0x77E34302E2152847ULL, 0x1187366CB0151D0AULL, 0xA4DC759893637CFAULL, 0x0B546D165A00A3A4ULL,
+		0x24ABA5792BFD52D3ULL, 0xD29970D538AE8B74ULL, 0x39AD26CB2E5EB5F0ULL, 0xD1F95307BA0D8E35ULL,
+		0xDDD0BD96DD75C405ULL, 0xC37705523196F934ULL, 0xB8B60DFBADE2DD7BULL, 0x827C76C309E7FD97ULL,
+		0x8D9975CBEBBBF81CULL, 0x449ED27743E0D4AFULL, 0x4B288C6A611AF8B6ULL, 0x38BACFC8173CCA5DULL,
+		0xA10113C96B73523CULL, 0xFFADC40EAA4F80A2ULL, 0x92D3BBBC10923462ULL, 0xDC31A35A9BB34538ULL,
+		0xAF63009BAAF188DDULL, 0x356046306650C3CDULL, 0x2D50F11448F71E5BULL, 0x186693F14D3B4595ULL,
+		0x373F6BAD953F9C13ULL, 0x45B295148B467498ULL, 0xC472F4D6F1E6191EULL, 0xD491F1076E589762ULL,
+		0x2DB24744B5DDAFA1ULL, 0xBB210AF4F64A4633ULL, 0x4AE543CAD7B8ED11ULL, 0x365FD13BAD2104ECULL,
+		0x8ECE98669C72B17FULL, 0x23A6FA3729CC2AE2ULL, 0xB109B8C73E0DCB11ULL, 0x1073B5ADB704C2A2ULL,
+		0xDEE467D167D7BC75ULL, 0xA94FF74E84C42132ULL, 0x4B36384F526BFC27ULL, 0xE8A132EA26405E21ULL,
+		0xD91E1576FAF5F3F9ULL, 0xDBEA3E21402291F8ULL, 0xB99B82B453E58554ULL, 0xB30AC50F036C8562ULL,
+		0x6251C4C64C02E3D6ULL, 0x3FE29B483C4856EFULL, 0x62A13F0442E1CD90ULL, 0x17DD02F6E064327CULL,
+		0x1085695FE1B280BDULL, 0x304E5001C7FDCAF5ULL, 0x427331E2473627B9ULL, 0xBA9E0E541E0882B1ULL,
+		0x56EC2C1D43805B91ULL, 0xEF5F12A9BF26D452ULL, 0xDEE2E205DEE1B37BULL, 0x9FF8A9B8026A40BDULL,
+		0x3F3BF06DE4B4B349ULL, 0x0038E5CBC5F2BA86ULL, 0xF7F42C37AB0413FFULL, 0x9F6DF63C5E4C63D5ULL,
+		0x0F4B2C9A75C2FF32ULL, 0x72AABC9EA59AC7F0ULL, 0x3664F5777E2804B9ULL, 0xCC823C1E9BB4A8E6ULL,
+		0x99F65D471D3DC716ULL, 0x45D105ABAFF38441ULL, 0xCDE39291FC3334C4ULL, 0x40B7A99E29620B33ULL,
+		0x506DFFCF23D191AFULL, 0x754E52D1863153ABULL, 0x628933F4EF03B0D3ULL, 0xAE4C28743295034BULL,
+		0x8C1A011BE8EFB064ULL, 0xBC293E75822A8488ULL, 0x64388396C800D9D4ULL, 0x9C5B35124EC26138ULL,
+		0x0E40353A84C5A29FULL, 0xC2A3CDBD45BA44BFULL, 0x553072F516329880ULL, 0x3E0F06C4A5464226ULL,
+		0x3F9B766F3505D8BDULL, 0x191AEBCACF31B39CULL, 0x2E372CFFBBFBE6C6ULL, 0xA2A5D563BDC1593EULL,
+		0x459034614E17FC2FULL, 0xF0686B66D9D00180ULL, 0xF2BC32DA3857ADDDULL, 0x1B4829A2070D1666ULL,
+		0x2B76F58406768ADAULL, 0xE92AD95480672421ULL, 0x71F10BCCB1972025ULL, 0x6FB87CCB3D992AEEULL,
+		0x0F4EB08CC6615556ULL, 0x80CF415B592A3850ULL, 0x96B9BE5BAE2B0D39ULL, 0xB400ABF90FC2E1A8ULL,
+		0x5A7F87B34F0F36C6ULL, 0x350460EE4945219EULL, 0x25EE2A72F3C354F3ULL, 0xC2A6FFFF7FDA2605ULL,
+		0xE2FE048818B40BC2ULL, 0xBCFD4521094FC355ULL, 0x4425135CE648F50AULL, 0x9083BC5FE76C80D4ULL,
+		0x78FEB5B74C6369A4ULL, 0x2785B0848F91EC98ULL, 0x842471237DA508F8ULL, 0x0CE65659BEC95940ULL,
+		0xB4FC933C4863CF81ULL, 0x844B2F17174D3FB7ULL, 0xB2B47343C0FEBF92ULL, 0x889376B138121548ULL,
+		0x8E1184524A0E1E62ULL, 0xE508467952C41859ULL, 0xA955D605536D5C09ULL, 0x5566D6208A83E833ULL,
+		0xAA066115159AAF31ULL, 0x4C0300D7EFCB57C1ULL, 0x6686BDDB83DD8593ULL, 0x53C01666FB57BE55ULL,
+		0x891D78D95BA74953ULL, 0x13B8423ED35E0743ULL, 0x5B9BBBA93EDBD015ULL, 0xE936159F55D99198ULL,
+		0x82362C2D39AF359CULL, 0x76426BF90F51EDEBULL, 0xCD0B2CEBC54FFA3AULL, 0x3B1C2D664B0869F1ULL,
+		0xB7A57A6296A6111CULL, 0x2C3248C148D74945ULL, 0xE1DFFFD8CEE191C3ULL, 0xFD308E51F3532A67ULL,
+		0xC4CFC5F5E5C48E86ULL, 0x7CE06C67F60BC17EULL, 0x697F8994F5258380ULL, 0x8E7C8CA0B481C693ULL,
+		0xF8666A19A38D9299ULL, 0xE08AC92689B1FFCFULL, 0xCCA11B4308D68C44ULL, 0x0AC739E3EBCB20BEULL,
+		0xB2A9C95052057CE6ULL, 0x3ADC990F1A01D6DBULL, 0x68F9F7B04050AE1DULL, 0x2482D22130DAC1D7ULL,
+		0x29B4A03075384501ULL, 0xC2BA82A9237330ECULL, 0x9A6C48D072B1124EULL, 0x0B1B999A5467EBD1ULL,
+		0x40EA609E3D68A8CDULL, 0x37514691B6EC7791ULL, 0xC6D6A67BA49E6DB4ULL, 0x37461240E377875DULL,
+		0x3825BECD2C2BB712ULL, 0xA04276018CC28BFEULL, 0x17035D56AA0F54F5ULL, 0x901AD2C72D40BD0FULL,
+		0xE6C8BD0C5D62A9C8ULL, 0xE83B6F616324F363ULL, 0x0006071BE2E66FB5ULL, 0xF4832359B8DB8FC7ULL,
+		0x4E60E46FC49EC034ULL, 0xF7994A3FF65AA665ULL, 0x5A3B2E4ACFA8F57EULL, 0xF482622E9E985215ULL,
+		0x1FA5D9E460B04D33ULL, 0xB360FB7122C1EB4BULL, 0x7420335DDF121C8DULL, 0x07268E540FDE14FCULL,
+		0x4B3C9E93404F323CULL, 0xEF116928AFEED3A4ULL, 0xAF5F1C3CC40E029BULL, 0xB781D4783901684FULL,
+		0x8D49AC726CA90029ULL, 0xC5D6F3FD8992A863ULL, 0xECABDC2A7D6B3F15ULL, 0x1667307B47397724ULL,
+		0x6EE37CC136906F75ULL, 0x8766E9DC5F04492FULL, 0x172023730E9B7F81ULL, 0x4AA74B8379228CA5ULL,
+		0x9194CE77132F914EULL, 0x0FEACDB92FDA2127ULL, 0x1F0EAD80AB601111ULL, 0x958AB10BFF7704A1ULL,
+		0x456D9068B56DD0A4ULL, 0x47128F0B620B8010ULL, 0xA5F9BD2E7DA3F7B3ULL, 0xABE4FE731BDCC750ULL,
+		0xA235B0AEC6B99D7DULL, 0x2B79BCEC4BDD28B4ULL, 0xB39C6C555F82BE63ULL, 0xD4F26E805124FA34ULL,
+		0x32054634FAF31AC6ULL, 0xADE4D803DDD178CDULL, 0x75EC99E4E6D7B8DBULL, 0x29772F5437ED4141ULL,
+		0xFF329C4545A56618ULL, 0xFC44352C7E596C63ULL, 0xC5778B18EFBCC388ULL, 0x56BC17E6BFEFAE33ULL,
+		0xFAD2ED946C080DEEULL, 0x3474768FEDC33E0EULL, 0xBFAC7E6F33B2271CULL, 0x7512A8E8BAF8BBDFULL,
+		0x02119CD6DCB33191ULL, 0x089756FE81140208ULL, 0x9834DA977BE3B35AULL, 0x704383E14005487EULL,
+		0xCD8418557BD2DF24ULL, 0x0438001BFCC9E914ULL, 0x41E8A2DE58649699ULL, 0xB9ED30721D9103F4ULL,
+		0xCB1409DCD09E8494ULL, 0x75B2B96B39C7A105ULL, 0xC05250778A8D2965ULL, 0x72DE396311F7722BULL,
+		0x88279BB6B5709EC4ULL, 0x26D83E59A823F8E5ULL, 0xE7FDBB15041F2259ULL, 0x000000008B521777ULL,
+	};
+
+	//Characteristic polynomial of the MT19937-64 word recurrence (degree 19937, bit i is the coefficient of t^i)
+	//MT19937-64 字递推的特征多项式 (次数 19937, 第 i 位是 t^i 的系数)
+	inline constexpr Polynomial CharacteristicPolynomial64Bit
+	{
+		0x0000000000000001ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0100000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000100000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000010ULL, 0x0000000000000000ULL, 0x0000000100000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0010000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000010000ULL, 0x0000000000000000ULL, 0x0000100000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000001ULL,
+		0x0000000000000000ULL, 0x0000000010000000ULL, 0x0000000000000000ULL, 0x0100000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0001000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000001000ULL,
+		0x0000000000000000ULL, 0x0000010000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000010ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x1000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000001000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000010000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000100ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000001ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0080000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000100000ULL, 0x0000000000000000ULL, 0x0001A00000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x4000000000000000ULL, 0x0000000000000010ULL,
+		0x0000000000000000ULL, 0x0000000124000000ULL, 0x0000000000000000ULL, 0x1050000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000001058000ULL, 0x0000000000000000ULL,
+		0x0000400000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000010480ULL,
+		0x0000000000000000ULL, 0x0000004100000000ULL, 0x0000000000000000ULL, 0x1800000000000000ULL,
+		0x0000000000000104ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0008000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000010110000ULL,
+		0x0000000000000000ULL, 0x0001980000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000100004ULL, 0x0000000000000000ULL, 0x0001008860000000ULL, 0x0000000000000000ULL,
+		0x0400000000000000ULL, 0x0000000000001001ULL, 0x0000000000000000ULL, 0x0000000018400000ULL,
+		0x0000000000000000ULL, 0x0000400000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000082600ULL, 0x0000000000000000ULL, 0x0001005000000000ULL, 0x0000000000000000ULL,
+		0x8000000000000000ULL, 0x0000000001001805ULL, 0x0000000000000000ULL, 0x0000000040000000ULL,
+		0x0000000000000000ULL, 0x04A0000000000000ULL, 0x0000000000010008ULL, 0x0000000000000000ULL,
+		0x0000000000400000ULL, 0x0000000000000000ULL, 0x0004000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000040ULL, 0x0000000000000000ULL, 0x0000022600000000ULL,
+		0x0000000000000001ULL, 0x4000000000000000ULL, 0x0000000000000010ULL, 0x0000000000000000ULL,
+		0x0080000184000000ULL, 0x0000000000000000ULL, 0x0040000000000000ULL, 0x0000000000000004ULL,
+		0x0000000000000000ULL, 0x0000A00060A40000ULL, 0x0000000000000000ULL, 0x0400400000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000400400ULL, 0x0000000000000000ULL,
+		0x4000404000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000024002624ULL,
+		0x0000000000000000ULL, 0x0050005040000000ULL, 0x0000000000000000ULL, 0x8400000000000000ULL,
+		0x0000000000058005ULL, 0x0000000000000000ULL, 0x0000400040400000ULL, 0x0000000000000000ULL,
+		0x04A4000000000000ULL, 0x0000000000000480ULL, 0x0000000000000000ULL, 0x0000004100404000ULL,
+		0x0000000000000000ULL, 0x1804040000000000ULL, 0x0000000000000004ULL, 0x0000000000000000ULL,
+		0x0000000000000040ULL, 0x0000000000000000ULL, 0x0008022400000000ULL, 0x0000000000000000ULL,
+		0x4000000000000000ULL, 0x0000000000110010ULL, 0x0000000000000000ULL, 0x0001980184000000ULL,
+		0x0000000000000000ULL, 0x0040000000000000ULL, 0x0000000000000004ULL, 0x0000000000000000ULL,
+		0x0000008860A40000ULL, 0x0000000000000000ULL, 0x0400400000000000ULL, 0x0000000000000001ULL,
+		0x0000000000000000ULL, 0x0000000018400400ULL, 0x0000000000000000ULL, 0x0000404000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000082624ULL, 0x0000000000000000ULL,
+		0x0001005040000000ULL, 0x0000000000000000ULL, 0x8400000000000000ULL, 0x0000000000001805ULL,
+		0x0000000000000000ULL, 0x0000000040400000ULL, 0x0000000000000000ULL, 0x04A4000000000000ULL,
+		0x0000000000000008ULL, 0x0000000000000000ULL, 0x0000000000404000ULL, 0x0000000000000000ULL,
+		0x0004040000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000040ULL,
+		0x0000000000000000ULL, 0x0000022400000000ULL, 0x0000000000000000ULL, 0x4000000000000000ULL,
+		0x0000000000000010ULL, 0x0000000000000000ULL, 0x0000000184000000ULL, 0x0000000000000000ULL,
+		0x0040000000000000ULL, 0x0000000000000004ULL, 0x0000000000000000ULL, 0x0000000060A40000ULL,
+		0x0000000000000000ULL, 0x0400400000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000400400ULL, 0x0000000000000000ULL, 0x0000404000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000002624ULL, 0x0000000000000000ULL, 0x0000005040000000ULL,
+		0x0000000000000000ULL, 0x8400000000000000ULL, 0x0000000000000005ULL, 0x0000000000000000ULL,
+		0x0000000040400000ULL, 0x0000000000000000ULL, 0x04A4000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000404000ULL, 0x0000000000000000ULL, 0x0004040000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000040ULL, 0x0000000000000000ULL,
+		0x0000022400000000ULL, 0x0000000000000000ULL, 0x4000000000000000ULL, 0x0000000000000010ULL,
+		0x0000000000000000ULL, 0x0000000184000000ULL, 0x0000000000000000ULL, 0x0040000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000A40000ULL, 0x0000000000000000ULL,
+		0x0000400000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000400ULL,
+		0x0000000000000000ULL, 0x0000004000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000024ULL, 0x0000000000000000ULL, 0x0000000040000000ULL, 0x0000000000000000ULL,
+		0x0400000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000400000ULL,
+		0x0000000000000000ULL, 0x0004000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL,
+		0x0000000000004000ULL, 0x0000000000000000ULL, 0x0000040000000000ULL, 0x0000000000000000ULL,
+		0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000200000000ULL,
+	};
+
+	//t^(D - 1) mod the characteristic polynomial, D = 312 * floor(2^64 / 312)
+	//t^(D - 1) 模特征多项式, D = 312 * floor(2^64 / 312)
+	inline constexpr Polynomial JumpPolynomial64Bit_2Power64
+	{
+		0x4D3D663CD269C53DULL, 0xCB0704731ED5EB81ULL, 0xA3E97CC1C3516707ULL, 0x219BC54FF682534FULL,
+		0xD28FE3FAF20587BFULL, 0xA54814953B0A7C90ULL, 0x3C33F6675CAA3AA6ULL, 0xB17ED6480810BBEDULL,
+		0xFE17964A85EBBB48ULL, 0x82BDF7975CAF6579ULL, 0x0AD3A20AAF8B34BFULL, 0xE5093091D6929769ULL,
+		0x9E32D0435F3EB00AULL, 0xB15B6F09C034646BULL, 0x5173A03C38BF4FCDULL, 0xA1C9ADEC33A19A28ULL,
+		0x88CAA2E0F348E6A0ULL, 0xE674A0273D3D2E9EULL, 0xF0A810AF9440E4DDULL, 0xF28C1F522944D3DEULL,
+		0x376730F59A6B4170ULL, 0x5059BAA778D3D9F1ULL, 0xB7E145A59FC2F524ULL, 0x5DF6A69AF000001DULL,
+		0x86F0A096E8959D2BULL, 0xEE4C2724426E81ACULL, 0xCABD5033B02747C7ULL, 0xFF829BBEDD8EF858ULL,
+		0xD614FC191DBFA2B9ULL, 0x78C380A453DC109BULL, 0xF4D355CAA0AC446FULL, 0xB336E75314B14366ULL,
+		0x33FED9A37BA4C46EULL, 0x6E933901E5FAC3CEULL, 0x122387C1D73FE121ULL, 0x0ED604C3D3E7AAD7ULL,
+		0xF7F922919FBE59E5ULL, 0xC247172978B7F4B8ULL, 0xFD1EE8E1707D11E9ULL, 0x6A2BE24360FEB10AULL,
+		0xB1F621C40DE64EC9ULL, 0xC9C032D0043E89B0ULL, 0xE3026C3FF60407BEULL, 0xA3737A729CD9945DULL,
+		0xB820356CF8DF1286ULL, 0x64F3416D5C5B6727ULL, 0x9FA010580A8B1E34ULL, 0x533A9B368D141449ULL,
+		0xEC502A83FFCD4A93ULL, 0xC705480DF8EDB116ULL, 0x34B5D9F76D1A3703ULL, 0x9DDC4C39DEE042D0ULL,
+		0xCA63271845BB6B4FULL, 0xC25024F5D93EF331ULL, 0x611CDE93A534BD51ULL, 0x9A42AA1F2B60BB62ULL,
+		0x3C8BAA3ED4E02C0DULL, 0x65B2FEF393638CA9ULL, 0x11EDE0F921120E9AULL, 0xC930D9DD67D7D3B2ULL,
+		0x96CBEAF985B19AA5ULL, 0x375093C8F5428A86ULL, 0xA90DE89C2C8DF015ULL, 0x36772D78AF3D56DBULL,
+		0x9AE83A12E519CF35ULL, 0xB0ACA90392F0BB74ULL, 0x56FC4C5FAAC464E6ULL, 0xE46ED2E14C5EFAA3ULL,
+		0x73387DAD34009784ULL, 0xE4107E7077EEFDFEULL, 0xE7735EB52C19CFA5ULL, 0x32E29F246EC53A8AULL,
+		0x3CF1C082D566488BULL, 0x9110E9EDDF323EBAULL, 0x897B3BA0FE324D69ULL, 0xB1347694359D0F20ULL,
+		0xDAA1D82808F1BAA4ULL, 0x4A01F30FA5492661ULL, 0x09A1D0E1961B385AULL, 0xA522E2D81764DBB8ULL,
+		0x8BE8E692A8A26F94ULL, 0xAFA03FE3D3AF1F1DULL, 0x36282FC4FB5BE045ULL, 0xCF73E62962927E6AULL,
+		0x8F5BC331BC30F839ULL, 0xFB1260C29A146D2FULL, 0x88515ACB8ABC886BULL, 0x0F7A3B38B316EA82ULL,
+		0x50ED4E4C46B030EAULL, 0x84769BD2EDAE83ABULL, 0x1FBE1E95EC4AF1A0ULL, 0xFD7EC13A44A85FD5ULL,
+		0x64866D1DA2DABD34ULL, 0x27EF53F5892FA5E9ULL, 0x68C0E78AFAD7FC32ULL, 0x62D4216C995EE75CULL,
+		0xC81D263A271652B0ULL, 0xBFDBB20866B93F69ULL, 0x656A21F5DF4A83EFULL, 0xAC1E553517B23360ULL,
+		0x0B988FA73A3B4F2DULL, 0xABBD8104495E6AC9ULL, 0x7F89A283E4810473ULL, 0xFC949A88DA3464BDULL,
+		0x7E028BE7A32C0D01ULL, 0x90DCDDA41ED8840BULL, 0x856CF7F1929D6375ULL, 0x193BB069E05B2E97ULL,
+		0x157EB81105A4757BULL, 0x18228B81FD30CFA3ULL, 0x191BB754EDBC0E6AULL, 0xE5EDD7C6AAE1A67EULL,
+		0x4A57B1C1BC39B2E2ULL, 0x14C06954952C79A2ULL, 0xACF676C115F8870FULL, 0x5402D0A32D19D848ULL,
+		0x0CE13194E4C7E650ULL, 0x632A63B71A8140C0ULL, 0xDF6BCC2A791CACB5ULL, 0x5C1DA0B7988F5443ULL,
+		0xF3199B3533B0B03BULL, 0x42CF0F4770352BF4ULL, 0x7C1DD7CFBF093E33ULL, 0x035739A20016955CULL,
+		0x33C0E23AFB453AA6ULL, 0xA4C5E5DD880C4D53ULL, 0xE245B3BFCE2FF384ULL, 0xAD78EE0310B9179CULL,
+		0x8F894A27B5772393ULL, 0x251C97878181BFF3ULL, 0xE3B3302278AAAE97ULL, 0xFD8218241FC10ABAULL,
+		0xBC02414203EF792BULL, 0xAB8F4B8302B3B0D4ULL, 0x523245CC3AE4724BULL, 0x69DDD58A050DF5E8ULL,
+		0xDF2852D20C716560ULL, 0x1EC2417884207C46ULL, 0x1AF64088CC64D5A8ULL, 0x5D2BC9FB45730747ULL,
+		0x2B831AFED52C36C5ULL, 0x94D9E074BE3896E2ULL, 0x66638A8B903A1F1DULL, 0x8BEE802530AE2ADDULL,
+		0x0F88A4AC2E4CFFDFULL, 0xF24C68BAFFEE95C2ULL, 0x4B1E8C9FD2209371ULL, 0xBAF8E21BE1A9C835ULL,
+		0x78B13B9C6372E318ULL, 0x39F26E4AA7554C13ULL, 0x87C7E8E2BFBB9EC4ULL, 0x3BA636B072B5F299ULL,
+		0x599AC4A26F1019A3ULL, 0x2503CA1971552575ULL, 0xC083F8EA5C5A8078ULL, 0x58B267062D8D970FULL,
+		0x9508115158BCEE13ULL, 0x88DB13F37BB7180EULL, 0xA9B30F3B6D0DE2CFULL, 0xD539B8D6E43867BAULL,
+		0x23CD608CB5D12963ULL, 0xFF1949E3C93BCE5AULL, 0xA7C80BCD3AE8225CULL, 0xDE599F4DDFB65BEFULL,
+		0x25A961C50653779EULL, 0xF0F57A2B55673B3FULL, 0x2E61453A6E3109ECULL, 0x9BB660A3D72694A7ULL,
+		0x6DCA6D5EA8B6618DULL, 0x62506A4C9A5404A3ULL, 0xBF956F572E1A9F41ULL, 0xC4F1106E2175ABA5ULL,
+		0x3600992AD88C9AD2ULL, 0x71BA9738422A9F37ULL, 0x3A3C8AEA843A48F5ULL, 0x33736F3EA4C9426EULL,
+		0xE251D9B0F7904A2DULL, 0x1C6396F9076A32FDULL, 0x1ECD96CB1336E6D3ULL, 0x40E4ED19243F3253ULL,
+		0x5AAFA760486F8B93ULL, 0x4E5E9F3271DC15B7ULL, 0x9C4F85B039FA17FDULL, 0x46517CE9502003A2ULL,
+		0xD2E805C732A22512ULL, 0x4FC10EB8672FA4E7ULL, 0x334ED0A89729F268ULL, 0x94D71258FCCDFBA0ULL,
+		0x459EA630F3D787D5ULL, 0x0EC066921C020117ULL, 0x2D5FFD1EE167EBC0ULL, 0x794A021BCAB28919ULL,
+		0xFBECED5534DF465EULL, 0x98368E17CE93BB19ULL, 0x7AFE4139F9EAE11DULL, 0xC53D433D4C7386D9ULL,
+		0x683CD3C4891B4645ULL, 0x390B403EAA9564E9ULL, 0xB0D543449817B224ULL, 0x03F4277AA0D9DA5DULL,
+		0x6F2DD4215C6AF8DFULL, 0x58D8D1C9A0D7C23EULL, 0xD855E4CD39B27B44ULL, 0xD4EE79892E3366C0ULL,
+		0x1171378EDBE8D908ULL, 0xE854936D8FB68DDAULL, 0xEAC4BE8851F7A443ULL, 0x33F0B5C3B6CE3876ULL,
+		0xD18585D591F1317EULL, 0xC69541E9AD6D910CULL, 0xFE80D370BDF3B2B2ULL, 0xC319105C7CFA4601ULL,
+		0xCD4340539780EB7DULL, 0x123DF6B3A93D2D79ULL, 0x9FA195709B057A6EULL, 0x02EC6DEC123B1004ULL,
+		0x411ABB7109784CD5ULL, 0xF7E6FC0E24CDA468ULL, 0x969EB69097E376EDULL, 0x13BC3E76674A795EULL,
+		0xBD165CDD2385D2FCULL, 0xBE20E1507C968358ULL, 0xF4E5D63C97984D54ULL, 0x2F69AA648C314FAEULL,
+		0x7BB3DF9C2EE90C3CULL, 0x7A4B541E63543AC3ULL, 0x6056D0F328F5629CULL, 0xC9BEA5636736D597ULL,
+		0xE2A0F98DAF69EDBFULL, 0x9A6C72ADC178B142ULL, 0xABC8C11B56273124ULL, 0xB0EE4A69C7C14A32ULL,
+		0x2A1F8096EEADD121ULL, 0x4C11510C9C9060D6ULL, 0x8E453D971EC5DDAEULL, 0x690CABA710C95BBDULL,
+		0x2625A97B99B4A163ULL, 0x380BDCD37E6F26E4ULL, 0x22A2F73AD9580F58ULL, 0x66704289F7693EE1ULL,
+		0x5012C321E7D87F54ULL, 0x19B112F8837D5487ULL, 0x734349537E40E6C7ULL, 0xAF86EAE1D17F0B69ULL,
+		0x55B25F11605717ECULL, 0xAC3C18F72D034D0EULL, 0x3E3A8D2FBC42547DULL, 0x1ED4CE309ECEE6CFULL,
+		0x2C308ED8FF40362CULL, 0x04B3F6CBD91DDA4FULL, 0x4E5B944065785AE7ULL, 0xA5779361369646FDULL,
+		0x8FE87C81FA496717ULL, 0xF04F59CC9F31DA78ULL, 0x98E4B4139E278DAEULL, 0x24D8B24E7C34CF00ULL,
+		0x3DE12F859D221612ULL, 0xDADDAEB150AB985CULL, 0xA43095D410F8E231ULL, 0x86D2615DFBA9F8A5ULL,
+		0xAA7AD98288C902DBULL, 0x16C6018987458AA6ULL, 0x386FDFF0C282413EULL, 0xC3F45AEB51C17C5DULL,
+		0x5DA6A6175FA14320ULL, 0xAAC9468C5CEB5997ULL, 0x06011EB776639648ULL, 0x52B5F2C47A23E8B6ULL,
+		0x12FA17AD5D2C5904ULL, 0x2F474530498295EBULL, 0xCD0FD0270B1D6AA5ULL, 0x7EFD4345B4E36C72ULL,
+		0x04A22E9D0F6F92A0ULL, 0x2B534F6E7192FDECULL, 0xEA1D9D3E0A801DB4ULL, 0xDA336A00D149C27BULL,
+		0xA2DD1B8B531007BBULL, 0xC5DD8D67E591D1B5ULL, 0x2393B599C78873BEULL, 0x62408E790943DE97ULL,
+		0xDC3747867F7F585CULL, 0x4D6706F09331146CULL, 0xDCC6D27E4607A9D0ULL, 0xD4B559427FDE9ABDULL,
+		0x179519633A9CA27BULL, 0x380DBB914B04FB46ULL, 0x25197381FB6BC0A0ULL, 0x5866724E075E3FE7ULL,
+		0x69119F95477D0232ULL, 0x30772C49C13814E8ULL, 0xED70311C3D78ECC0ULL, 0x3941BBD5C7473B64ULL,
+		0xF0CD610430CDB248ULL, 0xEB5DB9B31B7669CDULL, 0x10309D486CDE4EE9ULL, 0xB10D8BF41524A372ULL,
+		0xB11A81DF2553EC57ULL, 0xACB0F5B8E14F7D68ULL, 0xDC19AD0B4B0B53B8ULL, 0x8CF4F498988AA44EULL,
+		0xD1566B17A2C3F0B8ULL, 0xAEBEAE1962E3BC76ULL, 0xE0018B3E53322766ULL, 0x7403F90355D31E9CULL,
+		0x158CBC035198DFCDULL, 0x3D6F9DE30C01103EULL, 0xB206EB95FF527791ULL, 0x1460343F68ED7712ULL,
+		0x6C389F401767FD4AULL, 0x5FEBB4BAF500C17FULL, 0x6EDC92FC24D2DBA2ULL, 0x00000001502D91A0ULL,
+	};
+
+	//t^(D - 1) mod the characteristic polynomial, D = 312 * floor(2^128 / 312)
+	//t^(D - 1) 模特征多项式, D = 312 * floor(2^128 / 312)
+	inline constexpr Polynomial JumpPolynomial64Bit_2Power128
+	{
+		0x27D2E45588D3C767ULL, 0x0EF293176D9CA39CULL, 0xCB746DF45E30B40BULL, 0x6D2A953FC5484F2CULL,
+		0x683D70C37F42C6CDULL, 0xE5D3418DBF69377BULL, 0x794C7AAA8031123FULL, 0x5DF50826247A351AULL,
+		0x0469AB2CB92B4752ULL, 0x2E5BCED8FBB9CAF9ULL, 0xCA7AE1A451967656ULL, 0x25AC661C5B091F6BULL,
+		0xB268C8D0059F1B16ULL, 0x947F6A10DAD0DAACULL, 0xD3C4DE6120713719ULL, 0x6F036E270E09E601ULL,
+		0xBAC90C4233F4D0F3ULL, 0x67F8474B5C1EA4BCULL, 0x071CB6C90D6C5D4DULL, 0x5D883E6893870A8BULL,
+		0xA8145151EA671473ULL, 0xE840AF759748D502ULL, 0x655D1C37B184F3EEULL, 0x6D3D5169E594FFF9ULL,
+		0xCD6317597C0EC31AULL, 0xAE367F4DBEEB2533ULL, 0xA711DE9122108CA9ULL, 0xEA48101794914F4CULL,
+		0x0C7AF6EF8672D793ULL, 0x73A667FCDDAD00FBULL, 0x58E22927CA17C474ULL, 0xC86A5BDBFDCBB24FULL,
+		0x65C9866FFE84DD43ULL, 0xC1182A09E3B5D025ULL, 0x4476B0DD3EFE483AULL, 0xE5E1E4C263038536ULL,
+		0x5A618DA43535C8F3ULL, 0xD230A3F284437ABDULL, 0x31DB08EDF49A6587ULL, 0x387BC71F1E3847F2ULL,
+		0x1A78D95F3DB40A5BULL, 0xAD1D922503C6A2D0ULL, 0x6395B3A57087221FULL, 0xF0DB2DEC069FEC6DULL,
+		0x3BDE54D11827D44AULL, 0xBE063DE07906135EULL, 0x1B6E89A1F834FD2CULL, 0xFB7E6FB7788634DEULL,
+		0x6C167674B8D13078ULL, 0xE13F0E8E36BACF53ULL, 0x68F63C77B664C2CDULL, 0xF42CD7A5766E3B4AULL,
+		0x7C65F3DF66E818A3ULL, 0x90E22298834CF835ULL, 0x0F09C90EBBC9353BULL, 0xF04D3EC94FCDBFD5ULL,
+		0x7F3C78F41DDC9B16ULL, 0x5704442FB7D4FCD9ULL, 0x5F99139A0354C379ULL, 0x9BB4747B10A15088ULL,
+		0x824A4B556B3C04BBULL, 0xDAAC06E21BC9182EULL, 0x85AD608C3AF18A28ULL, 0xA9693BCEF45E9DA5ULL,
+		0x759D2E74D9662849ULL, 0xCEABE22A6F3A0AEBULL, 0x7B852375AC958F28ULL, 0x04FAFBB2D78F38C4ULL,
+		0xEE9FFF56A7F7A47CULL, 0x0C44D3F25A0224AEULL, 0xDE4E17E7C8F5E52EULL, 0x2001DB90FA90BF3DULL,
+		0x9653F09B9B9C6FC1ULL, 0x13D16B8B0FB68399ULL, 0x403EFE1222749795ULL, 0x7FE077CC7B478AADULL,
+		0xA5BC103048B3F96AULL, 0x7A80D1A21719E737ULL, 0xF530E1FE641578A0ULL, 0x441742974C6C5F31ULL,
+		0xEE52E03333D7D996ULL, 0xCDB0FFABC7EFCEB7ULL, 0xCD77F51E035B8468ULL, 0xE69277A575F1EFF6ULL,
+		0xD366447641075607ULL, 0xD71F82F5464AC19CULL, 0xEA54D6574E14930EULL, 0x37A07968E5D98E7AULL,
+		0xBB25ABD002CD538DULL, 0x4937B7AF9AA1336FULL, 0x30620A8009E64A09ULL, 0xF6505A98226DF48DULL,
+		0xD69831AE9D746BC2ULL, 0xE5C1017B1F1F083FULL, 0x9165A3B774344705ULL, 0xF4C8D0C2EDD4F7B2ULL,
+		0x765EB6DFFE4ACE19ULL, 0xA68E6D8624E6CDD3ULL, 0xFAE26548376D1558ULL, 0x90854DDE2D8EDDC9ULL,
+		0x61B697D1C9E90804ULL, 0x9C3560FBF93A9AF6ULL, 0xFF88ADEBD58C4AE3ULL, 0x14151EC09A1CF7D7ULL,
+		0xD42807E5650ACCFCULL, 0xB25D8D06958B85C5ULL, 0x155095C20C3622D9ULL, 0x1C6374B022DE5A90ULL,
+		0x2C46FCDCB54BA927ULL, 0xDBA47FE145123380ULL, 0x96432C5515155D27ULL, 0xD65BC83A08E85843ULL,
+		0xCBA8AD77D3D12154ULL, 0x8C16EE00CAC45F22ULL, 0x6CC09786F978577AULL, 0x180AA011A27FD03DULL,
+		0x66519AD25835E570ULL, 0x1C40B790249A1B23ULL, 0x743B354D8CF295B5ULL, 0xC58E2424B82640F8ULL,
+		0xE7700C89C1853A6FULL, 0x565C75F82440D0D0ULL, 0x58A026D1D77F6B67ULL, 0x3ADB04E97D73E3B1ULL,
+		0x5D90D7FE1B5A1B07ULL, 0xFB2D69FDB20C7748ULL, 0x8469D65D123F30D7ULL, 0x83CFA86A4CD947C5ULL,
+		0xF60A4540FF2E8534ULL, 0x0DAF4C0F1E15AB81ULL, 0x1FDAE3D3813E801EULL, 0xBDA1AE4D6BDFD9FFULL,
+		0x41FA3FC7907C65E3ULL, 0xDDDCA9D00E00BEEAULL, 0x36F5145F7027B166ULL, 0xFBA590BFC4AEBC95ULL,
+		0x132A35FDF8724854ULL, 0xFB1A59CC555E0391ULL, 0x702B32DA7030DB82ULL, 0x83AF710D3D23ADA6ULL,
+		0x7FC7D978423CE9CEULL, 0x518C14406775A41BULL, 0xEF92C779E38CCB8EULL, 0xC6E68F34A3989C67ULL,
+		0xE059CD0BB5407CC4ULL, 0x20C71EC522AABDEDULL, 0xF7C38B0975CB1F4CULL, 0xB7DEF00287AE9DE4ULL,
+		0xB1FB3A3BB9CD9A0AULL, 0x727FDABFE0BA8127ULL, 0xC3935D3AD77A93BBULL, 0x328C786CD17C7759ULL,
+		0xF94D441C474D79DEULL, 0x0833E9A69A60655DULL, 0xBDB844D27897141AULL, 0x1CA9409827C1E24CULL,
+		0x65BEFFB1DBB01C43ULL, 0xFC0B0B7616EC512FULL, 0xD43D7C5030E5AC1DULL, 0x843A872C4096912AULL,
+		0xA285CC09D9F4D77FULL, 0xEE7758FDC52B535DULL, 0xC5D5744E370AC79FULL, 0x705E9286F5168AEDULL,
+		0x0BAA37E71300C955ULL, 0xDE6D2CBA68415EE9ULL, 0xE7059D062F2F63CAULL, 0x4B80DDF7BE0CB1C3ULL,
+		0x32F691252ABB3D61ULL, 0x4EACE9188B144107ULL, 0x85965FC378231709ULL, 0xF51E60408AB71AEFULL,
+		0xD018F2FE851C294DULL, 0x050BF31279FD6D87ULL, 0x191BB8F9D909EF30ULL, 0x24ED903B0A248000ULL,
+		0x5D9F61B71A19AB4FULL, 0xCA287A9190415963ULL, 0x2F3C32A88AB35368ULL, 0x9B86821B8AB4B48FULL,
+		0xF18689586579006BULL, 0x3A570F2F72B1FAB4ULL, 0x67366B212F1ACCDDULL, 0x53EFF5480DFE8C0DULL,
+		0x04650880F91E2E69ULL, 0x2069F8C33B5EDDC1ULL, 0xAA4AB47365C8902FULL, 0x2D0823454F3CCEB1ULL,
+		0x1F8FA05FC14F813BULL, 0x2622D5B36EEE76D9ULL, 0xD2904DA6E93D4169ULL, 0xC6440FF88D627DD9ULL,
+		0x97E94D88E2F7E4EBULL, 0xF69649BA1F7D4F4BULL, 0x1FB391FEDAF67854ULL, 0x8FA9B6388BA2E326ULL,
+		0xFA19ADDC7443E0CDULL, 0x0FCD801210BFA6B0ULL, 0x14417AB461090B89ULL, 0xD3C53B69A509C8FEULL,
+		0x2A6671FD2F39D1BCULL, 0xC95E249B0E2C6FB6ULL, 0x65F1C8B2A5B1C299ULL, 0x13471FD8B9CDD812ULL,
+		0xFD72CEA1082D1C2EULL, 0xBBBFE1F983FE3CC8ULL, 0x94ACE5298C3F09E9ULL, 0x758FB7ECD14E6A08ULL,
+		0xF79FD61CF01E8AE4ULL, 0x68328FC0011424FAULL, 0x7CE4D1ED56D5CC07ULL, 0xF24B8303090D9591ULL,
+		0x4F463A7138A66101ULL, 0x2FB8F03CD51B99A7ULL, 0x665CBD9BA299A7D5ULL, 0xE67909924A1CC2FBULL,
+		0x056CA9F7F758C192ULL, 0xF33463A4871D5A96ULL, 0xE882BF67D5067C64ULL, 0xBA8DEA83B45A1DBFULL,
+		0x80D2D7A374440826ULL, 0x9EC2354C38766EB1ULL, 0xE997ABAC9C96F09CULL, 0x66973D5FFD4BB9FEULL,
+		0x6303280CD49EC000ULL, 0x49844DAE577D5D05ULL, 0xE5CE2829D14A7855ULL, 0x7FE294FFFAC71BDDULL,
+		0x4D724B140484BF53ULL, 0x3B7B23B00DFEB737ULL, 0x4570BB320D20072EULL, 0xD909D9C241748D4BULL,
+		0xBF23718EEE3DEFFAULL, 0xBC33C1AC40E61305ULL, 0xA70722328A3168EBULL, 0x9F8CB3C052608378ULL,
+		0xEB03D313E0746CDEULL, 0xC2011D76B805DB97ULL, 0x79560CAEEC317BA9ULL, 0x83411D643A1DB4F8ULL,
+		0x5F21C16F04E9407EULL, 0xA6CB64ADA555B677ULL, 0x2004E5F65265FFFCULL, 0xAD21F21D043F4132ULL,
+		0xCA63CD820EE48B03ULL, 0xD4E5EC01009BD3DDULL, 0xBAA9A632231CE41DULL, 0xC3543760FA211EA0ULL,
+		0xF53D3A9706638E09ULL, 0xCB43B83EF1AC3D8DULL, 0x166CAD0CE890CF73ULL, 0x64D98BC6B461B8B1ULL,
+		0x1A63D8CE75F1667DULL, 0x2D640C55C6BD337AULL, 0x39791675FC46A3E9ULL, 0x1979082CD658A627ULL,
+		0xDE60AD9F01579AA7ULL, 0x4B08867A21838F55ULL, 0xF937B0274C774D85ULL, 0x1BFB09D90242C769ULL,
+		0x828304AD95FBB6CEULL, 0x10FAFCCDA0815629ULL, 0x7B698013BF4EF9A9ULL, 0xF20E284146762719ULL,
+		0x7EA2CF8A9C0B2446ULL, 0x62D696FE21BF80C5ULL, 0x595171875BC9D684ULL, 0xF2C464C5266FD5CFULL,
+		0x62CBBA34EFB800B0ULL, 0xFF686F986C6B40FBULL, 0x7D4D99676AA51BECULL, 0x330156B87BD0A667ULL,
+		0xF17A2D39F46C53F4ULL, 0x89E5AD08EE6769A1ULL, 0x34BB0352CE1A35ADULL, 0x8C2B57FEA91EF279ULL,
+		0xEEBD22EC216FD8D7ULL, 0x08DB9EAFD3E58EFDULL, 0x4CF2B6218C6DC7CAULL, 0x07C768DA8EF84F0CULL,
+		0x348B5B74B6D782FCULL, 0xDF3B3AA790D2E6C4ULL, 0x9DBEA88425B1B38BULL, 0x217C59259ABA546AULL,
+		0x56E8790C9B8F73CFULL, 0x169E072906F87A62ULL, 0xF126D760344C6397ULL, 0xE2E1DE89CC62CCEBULL,
+		0xDFD50F17EE097D8AULL, 0x17B0398FA14BBFA0ULL, 0xE2F77163B5DA54DFULL, 0xBBBE5088A5EC921AULL,
+		0xE3478B5534911812ULL, 0xA0EF1ACFBECE0F93ULL, 0x6E013B2721796FEDULL, 0x401F831C1020473CULL,
+		0x510AEEA28968F4A3ULL, 0x9522079BFBAF4D4BULL, 0xF110F1B09D10221AULL, 0x48E688A54535F7ABULL,
+		0x16407BF6D2C501FFULL, 0x5BB827B21C8E65A5ULL, 0xC17AF8C664DE3455ULL, 0xB7F8CF2E94BB52A6ULL,
+		0xB69ADBD705373992ULL, 0x2E66EE0B77CAD879ULL, 0x3EF16E6D62130342ULL, 0x409B1E30A1F6B797ULL,
+		0xFC1CC7BE153FBC23ULL, 0xBD5573E1B8D58A2EULL, 0xEA32275404CC8DF6ULL, 0x000000018E1B99D6ULL,
+	};
+}
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+/*
+	Block kernels of the Mersenne Twister, one translation unit per instruction set (MersenneTwister_<instruction set>.cpp).
+	Those files are compiled with their own instruction set flags, so this header only holds the parameters as constants and declares plain functions.
+	A twist kernel regenerates the whole state in place (MT19937 or MT19937-64, the sequences of std::mt19937 and std::mt19937_64);
+	a temper kernel writes the tempered output of Count consecutive state words.
+	梅森旋转的块内核, 每个指令集一个翻译单元 (MersenneTwister_<指令集>.cpp)。
+	这些文件用各自指令集的选项编译, 所以本头文件只以常量形式保存参数, 并声明普通函数。
+	旋转内核原地重新生成整个状态 (MT19937 或 MT19937-64, 即 std::mt19937 与 std::mt19937_64 的序列);
+	回火内核写出 Count 个连续状态字回火后的输出。
+*/
+namespace PseudoRandomNumberGenerators::MersenneTwisterKernels
+{
+	struct Parameters32Bit
+	{
+		using WordType = std::uint32_t;
+
+		static constexpr std::size_t STATE_SIZE = 624;
+		static constexpr std::size_t MIDDLE_WORD_OFFSET = 397;
+		static constexpr WordType LOWER_MASK = 0x7FFFFFFFUL;
+		static constexpr WordType UPPER_MASK = ~LOWER_MASK;
+		static constexpr WordType TWIST_MATRIX_MAGIC_NUMBER = 0x9908B0DFUL;
+		static constexpr WordType INITIALIZATION_MULTIPLIER = 0x6C078965UL;
+
+		//y ^= (y >> U) & D; y ^= (y << S) & B; y ^= (y << T) & C; y ^= y >> L
+		static constexpr unsigned TEMPERING_SHIFT_U = 11, TEMPERING_SHIFT_S = 7, TEMPERING_SHIFT_T = 15, TEMPERING_SHIFT_L = 18;
+		static constexpr WordType TEMPERING_MASK_D = 0xFFFFFFFFUL, TEMPERING_MASK_B = 0x9D2C5680UL, TEMPERING_MASK_C = 0xEFC60000UL;
+	};
+
+	struct Parameters64Bit
+	{
+		using WordType = std::uint64_t;
+
+		static constexpr std::size_t STATE_SIZE = 312;
+		static constexpr std::size_t MIDDLE_WORD_OFFSET = 156;
+		static constexpr WordType LOWER_MASK = 0x7FFFFFFFULL;
+		static constexpr WordType UPPER_MASK = ~LOWER_MASK;
+		static constexpr WordType TWIST_MATRIX_MAGIC_NUMBER = 0xB5026F5AA96619E9ULL;
+		static constexpr WordType INITIALIZATION_MULTIPLIER = 0x5851F42D4C957F2DULL;
+
+		//y ^= (y >> U) & D; y ^= (y << S) & B; y ^= (y << T) & C; y ^= y >> L
+		static constexpr unsigned TEMPERING_SHIFT_U = 29, TEMPERING_SHIFT_S = 17, TEMPERING_SHIFT_T = 37, TEMPERING_SHIFT_L = 43;
+		static constexpr WordType TEMPERING_MASK_D = 0x5555555555555555ULL, TEMPERING_MASK_B = 0x71D67FFFEDA60000ULL, TEMPERING_MASK_C = 0xFFF7EEE000000000ULL;
+	};
+
+	//4 words (32-bit) or 2 words (64-bit) per vector
+	//每个向量4个字 (32位) 或2个字 (64位)
+	void TwistState32BitSSE2(std::uint32_t* State);
+	void TemperState32BitSSE2(const std::uint32_t* State, std::uint32_t* Values, std::size_t Count);
+	void TwistState64BitSSE2(std::uint64_t* State);
+	void TemperState64BitSSE2(const std::uint64_t* State, std::uint64_t* Values, std::size_t Count);
+
+	//8 words (32-bit) or 4 words (64-bit) per vector
+	//每个向量8个字 (32位) 或4个字 (64位)
+	void TwistState32BitAVX2(std::uint32_t* State);
+	void TemperState32BitAVX2(const std::uint32_t* State, std::uint32_t* Values, std::size_t Count);
+	void TwistState64BitAVX2(std::uint64_t* State);
+	void TemperState64BitAVX2(const std::uint64_t* State, std::uint64_t* Values, std::size_t Count);
+}
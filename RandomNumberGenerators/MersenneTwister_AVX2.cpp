@@ -0,0 +1,131 @@
+#include "MersenneTwisterKernels.h"
+
+#include <immintrin.h>
+
+namespace PseudoRandomNumberGenerators::MersenneTwisterKernels
+{
+	namespace
+	{
+		//The element width specific operations of one vector type
+		//一种向量类型中与元素宽度相关的操作
+		struct Lanes32Bit
+		{
+			using Parameters = Parameters32Bit;
+			static constexpr std::size_t LaneCount = 8;
+
+			static __m256i Broadcast(std::uint32_t Value) { return _mm256_set1_epi32(static_cast<int>(Value)); }
+			template<unsigned Shift> static __m256i ShiftRight(__m256i Value) { return _mm256_srli_epi32(Value, Shift); }
+			template<unsigned Shift> static __m256i ShiftLeft(__m256i Value) { return _mm256_slli_epi32(Value, Shift); }
+			//0 - Value, all ones where Value is 1
+			static __m256i Negate(__m256i Value) { return _mm256_sub_epi32(_mm256_setzero_si256(), Value); }
+		};
+
+		struct Lanes64Bit
+		{
+			using Parameters = Parameters64Bit;
+			static constexpr std::size_t LaneCount = 4;
+
+			static __m256i Broadcast(std::uint64_t Value) { return _mm256_set1_epi64x(static_cast<long long>(Value)); }
+			template<unsigned Shift> static __m256i ShiftRight(__m256i Value) { return _mm256_srli_epi64(Value, Shift); }
+			template<unsigned Shift> static __m256i ShiftLeft(__m256i Value) { return _mm256_slli_epi64(Value, Shift); }
+			static __m256i Negate(__m256i Value) { return _mm256_sub_epi64(_mm256_setzero_si256(), Value); }
+		};
+
+		//The same three ranges as MersenneTwister_SSE2.cpp, with twice the words per vector
+		//与 MersenneTwister_SSE2.cpp 相同的三段, 每个向量的字数加倍
+		template<typename Lanes>
+		void TwistState(typename Lanes::Parameters::WordType* State)
+		{
+			using Parameters = typename Lanes::Parameters;
+			using WordType = typename Parameters::WordType;
+			constexpr std::size_t N = Parameters::STATE_SIZE, M = Parameters::MIDDLE_WORD_OFFSET, LaneCount = Lanes::LaneCount;
+
+			const __m256i UpperMask = Lanes::Broadcast(Parameters::UPPER_MASK);
+			const __m256i LowerMask = Lanes::Broadcast(Parameters::LOWER_MASK);
+			const __m256i MagicNumber = Lanes::Broadcast(Parameters::TWIST_MATRIX_MAGIC_NUMBER);
+			const __m256i LowestBit = Lanes::Broadcast(1);
+
+			auto TwistVector = [&](std::size_t Index, std::size_t FarIndex)
+			{
+				const __m256i Current = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(State + Index));
+				const __m256i Next = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(State + Index + 1));
+				const __m256i Far = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(State + FarIndex));
+				const __m256i Spliced = _mm256_or_si256(_mm256_and_si256(Current, UpperMask), _mm256_and_si256(Next, LowerMask));
+				const __m256i Magic = _mm256_and_si256(Lanes::Negate(_mm256_and_si256(Spliced, LowestBit)), MagicNumber);
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(State + Index), _mm256_xor_si256(_mm256_xor_si256(Far, Lanes::template ShiftRight<1>(Spliced)), Magic));
+			};
+			auto TwistWord = [State](std::size_t Index, std::size_t NextIndex, std::size_t FarIndex)
+			{
+				const WordType Spliced = (State[Index] & Parameters::UPPER_MASK) | (State[NextIndex] & Parameters::LOWER_MASK);
+				State[Index] = State[FarIndex] ^ (Spliced >> 1) ^ ((WordType(0) - (Spliced & 1)) & Parameters::TWIST_MATRIX_MAGIC_NUMBER);
+			};
+
+			//Ends of the whole vectors in the first two ranges, (N - M) and (M - 1) words long
+			//前两段中整向量的结束位置, 两段分别长 (N - M) 和 (M - 1) 个字
+			constexpr std::size_t FirstRangeVectorEnd = (N - M) / LaneCount * LaneCount;
+			constexpr std::size_t SecondRangeVectorEnd = (N - M) + (M - 1) / LaneCount * LaneCount;
+
+			for (std::size_t Index = 0; Index < FirstRangeVectorEnd; Index += LaneCount)
+				TwistVector(Index, Index + M);
+			for (std::size_t Index = FirstRangeVectorEnd; Index < N - M; ++Index)
+				TwistWord(Index, Index + 1, Index + M);
+			for (std::size_t Index = N - M; Index < SecondRangeVectorEnd; Index += LaneCount)
+				TwistVector(Index, Index - (N - M));
+			for (std::size_t Index = SecondRangeVectorEnd; Index < N - 1; ++Index)
+				TwistWord(Index, Index + 1, Index - (N - M));
+			TwistWord(N - 1, 0, M - 1);
+		}
+
+		template<typename Lanes>
+		void TemperState(const typename Lanes::Parameters::WordType* State, typename Lanes::Parameters::WordType* Values, std::size_t Count)
+		{
+			using Parameters = typename Lanes::Parameters;
+			using WordType = typename Parameters::WordType;
+			constexpr std::size_t LaneCount = Lanes::LaneCount;
+
+			const __m256i MaskD = Lanes::Broadcast(Parameters::TEMPERING_MASK_D);
+			const __m256i MaskB = Lanes::Broadcast(Parameters::TEMPERING_MASK_B);
+			const __m256i MaskC = Lanes::Broadcast(Parameters::TEMPERING_MASK_C);
+
+			std::size_t Index = 0;
+			for (; Index + LaneCount <= Count; Index += LaneCount)
+			{
+				__m256i Value = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(State + Index));
+				Value = _mm256_xor_si256(Value, _mm256_and_si256(Lanes::template ShiftRight<Parameters::TEMPERING_SHIFT_U>(Value), MaskD));
+				Value = _mm256_xor_si256(Value, _mm256_and_si256(Lanes::template ShiftLeft<Parameters::TEMPERING_SHIFT_S>(Value), MaskB));
+				Value = _mm256_xor_si256(Value, _mm256_and_si256(Lanes::template ShiftLeft<Parameters::TEMPERING_SHIFT_T>(Value), MaskC));
+				Value = _mm256_xor_si256(Value, Lanes::template ShiftRight<Parameters::TEMPERING_SHIFT_L>(Value));
+				_mm256_storeu_si256(reinterpret_cast<__m256i*>(Values + Index), Value);
+			}
+			for (; Index < Count; ++Index)
+			{
+				WordType Value = State[Index];
+				Value ^= (Value >> Parameters::TEMPERING_SHIFT_U) & Parameters::TEMPERING_MASK_D;
+				Value ^= (Value << Parameters::TEMPERING_SHIFT_S) & Parameters::TEMPERING_MASK_B;
+				Value ^= (Value << Parameters::TEMPERING_SHIFT_T) & Parameters::TEMPERING_MASK_C;
+				Value ^= Value >> Parameters::TEMPERING_SHIFT_L;
+				Values[Index] = Value;
+			}
+		}
+	}
+
+	void TwistState32BitAVX2(std::uint32_t* State)
+	{
+		TwistState<Lanes32Bit>(State);
+	}
+
+	void TemperState32BitAVX2(const std::uint32_t* State, std::uint32_t* Values, std::size_t Count)
+	{
+		TemperState<Lanes32Bit>(State, Values, Count);
+	}
+
+	void TwistState64BitAVX2(std::uint64_t* State)
+	{
+		TwistState<Lanes64Bit>(State);
+	}
+
+	void TemperState64BitAVX2(const std::uint64_t* State, std::uint64_t* Values, std::size_t Count)
+	{
+		TemperState<Lanes64Bit>(State, Values, Count);
+	}
+}
@@ -0,0 +1,137 @@
+#include "MersenneTwisterKernels.h"
+
+#include <immintrin.h>
+
+namespace PseudoRandomNumberGenerators::MersenneTwisterKernels
+{
+	namespace
+	{
+		//The element width specific operations of one vector type
+		//一种向量类型中与元素宽度相关的操作
+		struct Lanes32Bit
+		{
+			using Parameters = Parameters32Bit;
+			static constexpr std::size_t LaneCount = 4;
+
+			static __m128i Broadcast(std::uint32_t Value) { return _mm_set1_epi32(static_cast<int>(Value)); }
+			template<unsigned Shift> static __m128i ShiftRight(__m128i Value) { return _mm_srli_epi32(Value, Shift); }
+			template<unsigned Shift> static __m128i ShiftLeft(__m128i Value) { return _mm_slli_epi32(Value, Shift); }
+			//0 - Value, all ones where Value is 1
+			static __m128i Negate(__m128i Value) { return _mm_sub_epi32(_mm_setzero_si128(), Value); }
+		};
+
+		struct Lanes64Bit
+		{
+			using Parameters = Parameters64Bit;
+			static constexpr std::size_t LaneCount = 2;
+
+			static __m128i Broadcast(std::uint64_t Value) { return _mm_set1_epi64x(static_cast<long long>(Value)); }
+			template<unsigned Shift> static __m128i ShiftRight(__m128i Value) { return _mm_srli_epi64(Value, Shift); }
+			template<unsigned Shift> static __m128i ShiftLeft(__m128i Value) { return _mm_slli_epi64(Value, Shift); }
+			static __m128i Negate(__m128i Value) { return _mm_sub_epi64(_mm_setzero_si128(), Value); }
+		};
+
+		/*
+			The twist in three ranges without `% STATE_SIZE`:
+			[0, N - M) reads the far word Index + M, not twisted yet; [N - M, N - 1) reads Index + M - N, twisted at least N - M words earlier, more than one vector back;
+			the last word reads the new State[0]. The magic number is selected with a mask instead of a branch.
+			分三段、不用 `% STATE_SIZE` 的旋转:
+			[0, N - M) 读取尚未旋转的远端字 Index + M; [N - M, N - 1) 读取 Index + M - N, 它至少在 N - M 个字之前已旋转, 超过一个向量;
+			最后一个字读取新的 State[0]。魔数用掩码而不是分支选择。
+		*/
+		template<typename Lanes>
+		void TwistState(typename Lanes::Parameters::WordType* State)
+		{
+			using Parameters = typename Lanes::Parameters;
+			using WordType = typename Parameters::WordType;
+			constexpr std::size_t N = Parameters::STATE_SIZE, M = Parameters::MIDDLE_WORD_OFFSET, LaneCount = Lanes::LaneCount;
+
+			const __m128i UpperMask = Lanes::Broadcast(Parameters::UPPER_MASK);
+			const __m128i LowerMask = Lanes::Broadcast(Parameters::LOWER_MASK);
+			const __m128i MagicNumber = Lanes::Broadcast(Parameters::TWIST_MATRIX_MAGIC_NUMBER);
+			const __m128i LowestBit = Lanes::Broadcast(1);
+
+			auto TwistVector = [&](std::size_t Index, std::size_t FarIndex)
+			{
+				const __m128i Current = _mm_loadu_si128(reinterpret_cast<const __m128i*>(State + Index));
+				const __m128i Next = _mm_loadu_si128(reinterpret_cast<const __m128i*>(State + Index + 1));
+				const __m128i Far = _mm_loadu_si128(reinterpret_cast<const __m128i*>(State + FarIndex));
+				const __m128i Spliced = _mm_or_si128(_mm_and_si128(Current, UpperMask), _mm_and_si128(Next, LowerMask));
+				const __m128i Magic = _mm_and_si128(Lanes::Negate(_mm_and_si128(Spliced, LowestBit)), MagicNumber);
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(State + Index), _mm_xor_si128(_mm_xor_si128(Far, Lanes::template ShiftRight<1>(Spliced)), Magic));
+			};
+			auto TwistWord = [State](std::size_t Index, std::size_t NextIndex, std::size_t FarIndex)
+			{
+				const WordType Spliced = (State[Index] & Parameters::UPPER_MASK) | (State[NextIndex] & Parameters::LOWER_MASK);
+				State[Index] = State[FarIndex] ^ (Spliced >> 1) ^ ((WordType(0) - (Spliced & 1)) & Parameters::TWIST_MATRIX_MAGIC_NUMBER);
+			};
+
+			//Ends of the whole vectors in the first two ranges, (N - M) and (M - 1) words long
+			//前两段中整向量的结束位置, 两段分别长 (N - M) 和 (M - 1) 个字
+			constexpr std::size_t FirstRangeVectorEnd = (N - M) / LaneCount * LaneCount;
+			constexpr std::size_t SecondRangeVectorEnd = (N - M) + (M - 1) / LaneCount * LaneCount;
+
+			for (std::size_t Index = 0; Index < FirstRangeVectorEnd; Index += LaneCount)
+				TwistVector(Index, Index + M);
+			for (std::size_t Index = FirstRangeVectorEnd; Index < N - M; ++Index)
+				TwistWord(Index, Index + 1, Index + M);
+			for (std::size_t Index = N - M; Index < SecondRangeVectorEnd; Index += LaneCount)
+				TwistVector(Index, Index - (N - M));
+			for (std::size_t Index = SecondRangeVectorEnd; Index < N - 1; ++Index)
+				TwistWord(Index, Index + 1, Index - (N - M));
+			TwistWord(N - 1, 0, M - 1);
+		}
+
+		template<typename Lanes>
+		void TemperState(const typename Lanes::Parameters::WordType* State, typename Lanes::Parameters::WordType* Values, std::size_t Count)
+		{
+			using Parameters = typename Lanes::Parameters;
+			using WordType = typename Parameters::WordType;
+			constexpr std::size_t LaneCount = Lanes::LaneCount;
+
+			const __m128i MaskD = Lanes::Broadcast(Parameters::TEMPERING_MASK_D);
+			const __m128i MaskB = Lanes::Broadcast(Parameters::TEMPERING_MASK_B);
+			const __m128i MaskC = Lanes::Broadcast(Parameters::TEMPERING_MASK_C);
+
+			std::size_t Index = 0;
+			for (; Index + LaneCount <= Count; Index += LaneCount)
+			{
+				__m128i Value = _mm_loadu_si128(reinterpret_cast<const __m128i*>(State + Index));
+				Value = _mm_xor_si128(Value, _mm_and_si128(Lanes::template ShiftRight<Parameters::TEMPERING_SHIFT_U>(Value), MaskD));
+				Value = _mm_xor_si128(Value, _mm_and_si128(Lanes::template ShiftLeft<Parameters::TEMPERING_SHIFT_S>(Value), MaskB));
+				Value = _mm_xor_si128(Value, _mm_and_si128(Lanes::template ShiftLeft<Parameters::TEMPERING_SHIFT_T>(Value), MaskC));
+				Value = _mm_xor_si128(Value, Lanes::template ShiftRight<Parameters::TEMPERING_SHIFT_L>(Value));
+				_mm_storeu_si128(reinterpret_cast<__m128i*>(Values + Index), Value);
+			}
+			for (; Index < Count; ++Index)
+			{
+				WordType Value = State[Index];
+				Value ^= (Value >> Parameters::TEMPERING_SHIFT_U) & Parameters::TEMPERING_MASK_D;
+				Value ^= (Value << Parameters::TEMPERING_SHIFT_S) & Parameters::TEMPERING_MASK_B;
+				Value ^= (Value << Parameters::TEMPERING_SHIFT_T) & Parameters::TEMPERING_MASK_C;
+				Value ^= Value >> Parameters::TEMPERING_SHIFT_L;
+				Values[Index] = Value;
+			}
+		}
+	}
+
+	void TwistState32BitSSE2(std::uint32_t* State)
+	{
+		TwistState<Lanes32Bit>(State);
+	}
+
+	void TemperState32BitSSE2(const std::uint32_t* State, std::uint32_t* Values, std::size_t Count)
+	{
+		TemperState<Lanes32Bit>(State, Values, Count);
+	}
+
+	void TwistState64BitSSE2(std::uint64_t* State)
+	{
+		TwistState<Lanes64Bit>(State);
+	}
+
+	void TemperState64BitSSE2(const std::uint64_t* State, std::uint64_t* Values, std::size_t Count)
+	{
+		TemperState<Lanes64Bit>(State, Values, Count);
+	}
+}
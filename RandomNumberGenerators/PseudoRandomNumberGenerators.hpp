@@ -1,6 +1,11 @@
 #pragma once
 
 #include "../MainProgram/Support+Library/Support-Library.hpp"
+#include "../MainProgram/Support+Library/CPU_FeatureDispatch.hpp"
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
 
 namespace PseudoRandomNumberGenerators
 {
@@ -13,41 +18,737 @@ namespace PseudoRandomNumberGenerators
 		static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
 		static constexpr result_type min() { return std::numeric_limits<result_type>::min(); }
 	};
+
+	//Full 64 x 64 -> 128 bit product, returns the high half and stores the low half in Low
+	//64 x 64 -> 128 位完整乘积, 返回高半部分, 低半部分写入 Low
+	constexpr std::uint64_t MultiplyFull64(std::uint64_t A, std::uint64_t B, std::uint64_t& Low)
+	{
+		#if defined(__SIZEOF_INT128__)
+		const unsigned __int128 Product = static_cast<unsigned __int128>(A) * B;
+		Low = static_cast<std::uint64_t>(Product);
+		return static_cast<std::uint64_t>(Product >> 64);
+		#else
+		#if defined(_MSC_VER) && defined(_M_X64)
+		if (!std::is_constant_evaluated())
+		{
+			std::uint64_t High = 0;
+			Low = _umul128(A, B, &High);
+			return High;
+		}
+		#endif
+		const std::uint64_t A_Low = A & 0xFFFFFFFFULL, A_High = A >> 32;
+		const std::uint64_t B_Low = B & 0xFFFFFFFFULL, B_High = B >> 32;
+		const std::uint64_t LowLow = A_Low * B_Low;
+		const std::uint64_t Middle = (LowLow >> 32) + (A_High * B_Low & 0xFFFFFFFFULL) + A_Low * B_High;
+		Low = (Middle << 32) | (LowLow & 0xFFFFFFFFULL);
+		return A_High * B_High + (A_High * B_Low >> 32) + (Middle >> 32);
+		#endif
+	}
+
+	/*
+		Montgomery arithmetic modulo an odd 64-bit Modulus with R = 2^64: a number X is kept as X * R mod Modulus,
+		so a modular product is three 64 x 64 bit multiplications and no division; Add/Multiply/Power take and return Montgomery form.
+		以 R = 2^64 对奇数64位模数做蒙哥马利运算: 数 X 以 X * R mod Modulus 的形式保存,
+		模乘只需三次 64 x 64 位乘法而没有除法; Add/Multiply/Power 的输入输出都是蒙哥马利形式。
+	*/
+	class MontgomeryArithmetic64
+	{
+	public:
+		std::uint64_t Modulus = 0;
+		//-Modulus^-1 mod 2^64
+		std::uint64_t NegativeInverse = 0;
+		//R^2 mod Modulus, converts into Montgomery form
+		std::uint64_t R_Squared = 0;
+		//R mod Modulus, the Montgomery form of 1
+		std::uint64_t One = 0;
+
+		constexpr explicit MontgomeryArithmetic64(std::uint64_t OddModulus)
+			: Modulus(OddModulus)
+		{
+			//Newton iteration doubles the correct low bits each step: 1 (for odd numbers) -> 2 -> 4 -> ... -> 64
+			//牛顿迭代每步使正确的低位数翻倍: 1 (奇数) -> 2 -> 4 -> ... -> 64
+			std::uint64_t Inverse = 1;
+			for (int Step = 0; Step < 6; ++Step)
+				Inverse *= 2 - Modulus * Inverse;
+			NegativeInverse = 0 - Inverse;
+
+			One = (0 - Modulus) % Modulus;
+			//R^2 = R * 2^64: double R mod Modulus 64 times
+			//R^2 = R * 2^64: 将 R 模 Modulus 加倍64次
+			R_Squared = One;
+			for (int Bit = 0; Bit < 64; ++Bit)
+				R_Squared = Add(R_Squared, R_Squared);
+		}
+
+		constexpr std::uint64_t Add(std::uint64_t A, std::uint64_t B) const
+		{
+			const std::uint64_t Sum = A + B;
+			return (Sum < A || Sum >= Modulus) ? Sum - Modulus : Sum;
+		}
+
+		constexpr std::uint64_t Subtract(std::uint64_t A, std::uint64_t B) const
+		{
+			return A >= B ? A - B : A - B + Modulus;
+		}
+
+		//(High * 2^64 + Low) * R^-1 mod Modulus, for High * 2^64 + Low < Modulus * 2^64
+		//(High * 2^64 + Low) * R^-1 mod Modulus, 要求 High * 2^64 + Low < Modulus * 2^64
+		constexpr std::uint64_t Reduce(std::uint64_t High, std::uint64_t Low) const
+		{
+			std::uint64_t ProductLow = 0;
+			const std::uint64_t ProductHigh = MultiplyFull64(Low * NegativeInverse, Modulus, ProductLow);
+			//Low + ProductLow is 0 mod 2^64 by construction, so it carries exactly when Low is not 0
+			//Low + ProductLow 按构造模 2^64 为0, 因此恰好在 Low 不为0时产生进位
+			const std::uint64_t Sum = High + ProductHigh;
+			const std::uint64_t Result = Sum + (Low != 0 ? 1 : 0);
+			const bool IsOverflow = Sum < High || Result < Sum;
+			return (IsOverflow || Result >= Modulus) ? Result - Modulus : Result;
+		}
+
+		constexpr std::uint64_t Multiply(std::uint64_t A, std::uint64_t B) const
+		{
+			std::uint64_t Low = 0;
+			const std::uint64_t High = MultiplyFull64(A, B, Low);
+			return Reduce(High, Low);
+		}
+
+		constexpr std::uint64_t Square(std::uint64_t A) const
+		{
+			return Multiply(A, A);
+		}
+
+		constexpr std::uint64_t ToMontgomery(std::uint64_t X) const
+		{
+			return Multiply(X % Modulus, R_Squared);
+		}
+
+		constexpr std::uint64_t FromMontgomery(std::uint64_t X) const
+		{
+			return Reduce(0, X);
+		}
+
+		//Base^Exponent by left-to-right square-and-multiply
+		//从左到右的平方-乘算法计算 Base^Exponent
+		constexpr std::uint64_t Power(std::uint64_t Base, std::uint64_t Exponent) const
+		{
+			std::uint64_t Result = One;
+			for (int Bit = std::bit_width(Exponent) - 1; Bit >= 0; --Bit)
+			{
+				Result = Square(Result);
+				if ((Exponent >> Bit) & 1)
+					Result = Multiply(Result, Base);
+			}
+			return Result;
+		}
+	};
+
+	/*
+		Uniform integer in [0, Bound) without division on the common path (Lemire's multiply-shift with rejection).
+		The draw X is scaled as (X * Bound) >> Width; the low half of the product tells whether X fell in the short, over-represented slice,
+		and only then is the rejection threshold (2^Width mod Bound) computed and X redrawn, so the result is exactly uniform.
+		Engines whose output is exactly 32 or 64 full bits take the fast path; any other engine goes through std::uniform_int_distribution.
+		无偏地生成 [0, Bound) 内的整数 (Lemire 乘法移位 + 拒绝采样), 常见路径上没有除法;
+		只有当乘积低半部分落在过度代表的区间时, 才计算拒绝阈值 (2^Width mod Bound) 并重新抽取。
+		输出恰好为32位或64位满值的引擎走快速路径, 其它引擎退回 std::uniform_int_distribution。
+	*/
+	template<typename RNG_Type>
+	requires std::uniform_random_bit_generator<std::remove_reference_t<RNG_Type>>
+	inline std::uint64_t BoundedRandom(RNG_Type&& RNG, std::uint64_t Bound)
+	{
+		using EngineType = std::remove_reference_t<RNG_Type>;
+
+		if(Bound <= 1)
+			return 0;
+
+		if constexpr (EngineType::min() == 0 && static_cast<std::uint64_t>(EngineType::max()) == std::numeric_limits<std::uint64_t>::max())
+		{
+			std::uint64_t Low = 0;
+			std::uint64_t High = MultiplyFull64(static_cast<std::uint64_t>(RNG()), Bound, Low);
+			if(Low < Bound)
+			{
+				const std::uint64_t Threshold = (0 - Bound) % Bound;
+				while(Low < Threshold)
+					High = MultiplyFull64(static_cast<std::uint64_t>(RNG()), Bound, Low);
+			}
+			return High;
+		}
+		else if constexpr (EngineType::min() == 0 && static_cast<std::uint64_t>(EngineType::max()) == std::numeric_limits<std::uint32_t>::max())
+		{
+			if(Bound <= std::numeric_limits<std::uint32_t>::max())
+			{
+				const std::uint32_t Bound32 = static_cast<std::uint32_t>(Bound);
+				std::uint64_t Product = static_cast<std::uint64_t>(static_cast<std::uint32_t>(RNG())) * Bound32;
+				if(static_cast<std::uint32_t>(Product) < Bound32)
+				{
+					const std::uint32_t Threshold = (0U - Bound32) % Bound32;
+					while(static_cast<std::uint32_t>(Product) < Threshold)
+						Product = static_cast<std::uint64_t>(static_cast<std::uint32_t>(RNG())) * Bound32;
+				}
+				return Product >> 32;
+			}
+			std::uniform_int_distribution<std::uint64_t> Distribution(0, Bound - 1);
+			return Distribution(RNG);
+		}
+		else
+		{
+			std::uniform_int_distribution<std::uint64_t> Distribution(0, Bound - 1);
+			return Distribution(RNG);
+		}
+	}
+
+	//Checks fill and discard of each of Counts values against as many operator() calls after WarmUp outputs, and that seed() restarts the engine
+	//在 WarmUp 个输出之后, 用同样次数的 operator() 检查 Counts 中每个数量的 fill 与 discard, 并检查 seed() 让引擎重新开始
+	template<typename Engine>
+	inline bool CheckEngineConformance(std::initializer_list<std::size_t> Counts, std::size_t WarmUp = 0)
+	{
+		bool IsPassed = true;
+
+		for (const std::size_t Count : Counts)
+		{
+			Engine Reference(7);
+			for (std::size_t Round = 0; Round < WarmUp; ++Round)
+				Reference();
+			Engine Filled = Reference, Skipped = Reference;
+
+			std::vector<typename Engine::result_type> Values(Count);
+			Filled.fill(Values);
+			Skipped.discard(Count);
+			for (const auto Value : Values)
+				IsPassed &= Value == Reference();
+			IsPassed &= Filled == Reference && Skipped == Reference;
+
+			const auto Next = Reference();
+			IsPassed &= Filled() == Next && Skipped() == Next;
+		}
+
+		Engine Reseeded(99);
+		Reseeded();
+		Reseeded.seed(7);
+		IsPassed &= Reseeded == Engine(7) && !(Reseeded == Engine(8));
+
+		return IsPassed;
+	}
 }
 
+#include "MersenneTwisterKernels.h"
 #include "XorshiftFamily.h"
 
 namespace PseudoRandomNumberGenerators
 {
-	inline std::uint64_t Linear_Congruential(std::uint64_t Seed, std::uint64_t Iterations);
+	std::uint64_t Linear_Congruential(std::uint64_t Seed, std::uint64_t Iterations);
+
+	std::int64_t Nonlinear_InversiveCongruential(std::uint64_t Seed, std::uint64_t Iterations);
+
+	/*
+		Modulus of LinearCongruentialGenerator.
+		TwoPower64 is the native wrap-around of 64-bit arithmetic, the Linear_Congruential sequence (it is full period, the Hull-Dobell conditions hold for its constants).
+		TwoPower64Minus1 is the `% std::numeric_limits<std::uint64_t>::max()` modulus taken exactly, on 128-bit products (2^64 = 1 mod 2^64 - 1).
+		LinearCongruentialGenerator 的模数。
+		TwoPower64 是64位运算的自然回绕, 即 Linear_Congruential 的序列 (其常数满足 Hull-Dobell 条件, 周期为满周期)。
+		TwoPower64Minus1 是精确计算的 `% std::numeric_limits<std::uint64_t>::max()` 模数, 基于128位乘积 (模 2^64 - 1 时 2^64 = 1)。
+	*/
+	enum class LinearCongruentialModulus
+	{
+		TwoPower64,
+		TwoPower64Minus1
+	};
+
+	/*
+		Linear congruential generator X(n + 1) = A * X(n) + B mod M.
+		One step is the affine map X -> A * X + B; composing the map with itself by repeated squaring gives the n-step map in O(log n) multiplications,
+		which is how discard jumps ahead and how the lanes of LinearCongruentialLanes are spaced.
+		线性同余生成器 X(n + 1) = A * X(n) + B mod M。
+		一步就是仿射映射 X -> A * X + B; 通过反复平方将映射与自身复合, 可用 O(log n) 次乘法得到 n 步映射,
+		discard 借此向前跳跃, LinearCongruentialLanes 的通道也按此错开。
+	*/
+	template<LinearCongruentialModulus ModulusKind = LinearCongruentialModulus::TwoPower64>
+	class LinearCongruentialGenerator
+	{
+	public:
+		using result_type = std::uint64_t;
+
+		//https://en.wikipedia.org/wiki/Linear_congruential_generator
+		static constexpr std::uint64_t Multiplier = 6364136223846793005ULL;
+		static constexpr std::uint64_t Increment = 1442695040888963407ULL;
+
+		static constexpr bool IsModulusTwoPower64 = ModulusKind == LinearCongruentialModulus::TwoPower64;
+
+		static constexpr result_type min() { return 0; }
+		static constexpr result_type max() { return IsModulusTwoPower64 ? std::numeric_limits<std::uint64_t>::max() : std::numeric_limits<std::uint64_t>::max() - 1; }
+
+		static constexpr std::uint64_t AddModulo(std::uint64_t A, std::uint64_t B)
+		{
+			if constexpr (IsModulusTwoPower64)
+				return A + B;
+			else
+			{
+				//A carry out of 64 bits is worth 2^64 = 1; the sum then stays below 2^64, and 2^64 - 1 itself wraps to 0
+				//Written as arithmetic on the comparisons rather than branches, which would be taken at random
+				//进位到64位以外相当于 2^64 = 1; 此时和仍小于 2^64, 而 2^64 - 1 本身回绕为 0
+				//用比较结果做算术而不是分支, 因为这些分支的走向是随机的
+				std::uint64_t Sum = A + B;
+				Sum += static_cast<std::uint64_t>(Sum < A);
+				return Sum + static_cast<std::uint64_t>(Sum == std::numeric_limits<std::uint64_t>::max());
+			}
+		}
+
+		static constexpr std::uint64_t MultiplyModulo(std::uint64_t A, std::uint64_t B)
+		{
+			if constexpr (IsModulusTwoPower64)
+				return A * B;
+			else
+			{
+				std::uint64_t Low = 0;
+				const std::uint64_t High = MultiplyFull64(A, B, Low);
+				return AddModulo(High, Low);
+			}
+		}
+
+		//X -> Multiplier * X + Increment mod M
+		//X -> Multiplier * X + Increment mod M
+		struct AffineMap
+		{
+			std::uint64_t Multiplier = 1;
+			std::uint64_t Increment = 0;
+
+			constexpr std::uint64_t operator()(std::uint64_t X) const
+			{
+				return AddModulo(MultiplyModulo(Multiplier, X), Increment);
+			}
+
+			//First, then Second
+			//先 First, 后 Second
+			static constexpr AffineMap Compose(const AffineMap& First, const AffineMap& Second)
+			{
+				return { MultiplyModulo(Second.Multiplier, First.Multiplier), Second(First.Increment) };
+			}
+		};
+
+		static constexpr AffineMap Step { Multiplier, Increment };
+
+		//The map of Steps consecutive steps
+		//连续 Steps 步的映射
+		static constexpr AffineMap StepMap(unsigned long long Steps)
+		{
+			AffineMap Result {};
+			AffineMap Power = Step;
+			for (; Steps != 0; Steps >>= 1)
+			{
+				if (Steps & 1)
+					Result = AffineMap::Compose(Result, Power);
+				Power = AffineMap::Compose(Power, Power);
+			}
+			return Result;
+		}
+
+		explicit LinearCongruentialGenerator(std::uint64_t Seed = 1)
+		{
+			this->seed(Seed);
+		}
+
+		//X(0) = Seed mod M; the first output is X(1)
+		//X(0) = Seed mod M; 第一个输出是 X(1)
+		void seed(std::uint64_t Seed)
+		{
+			this->State = AddModulo(Seed, 0);
+		}
+
+		result_type operator()()
+		{
+			this->State = Step(this->State);
+			return this->State;
+		}
+
+		void discard(unsigned long long Count)
+		{
+			this->State = StepMap(Count)(this->State);
+		}
+
+		//Same values as calling operator() Values.size() times, produced by 8 interleaved lanes
+		//与调用 Values.size() 次 operator() 的结果相同, 由8条交错的通道生成
+		void fill(std::span<result_type> Values);
+
+		std::uint64_t state() const
+		{
+			return this->State;
+		}
+
+	private:
+		std::uint64_t State = 0;
+	};
+
+	/*
+		LaneCount interleaved substreams of one LinearCongruentialGenerator: lane i holds X(n + i) and every lane advances by the LaneCount-step map,
+		so each block is the next LaneCount values of the single sequence, in order.
+		The lanes are independent, so the per-lane loops have no carried dependency; with TwoPower64 they are plain 64-bit multiply-adds the compiler vectorizes,
+		with TwoPower64Minus1 each lane is a 128-bit product whose latency overlaps with the other lanes.
+		同一个 LinearCongruentialGenerator 的 LaneCount 条交错子流: 第 i 条通道保存 X(n + i), 每条通道都按 LaneCount 步的映射前进,
+		因此每个块依次就是单一序列接下来的 LaneCount 个值。
+		各通道相互独立, 逐通道的循环没有循环携带依赖; TwoPower64 下是编译器可以向量化的64位乘加, TwoPower64Minus1 下每条通道的128位乘积延迟可与其它通道重叠。
+	*/
+	template<LinearCongruentialModulus ModulusKind = LinearCongruentialModulus::TwoPower64, std::size_t LaneCount = 8>
+	class LinearCongruentialLanes
+	{
+		static_assert(LaneCount == 4 || LaneCount == 8, "");
 
-	inline std::int64_t Nonlinear_InversiveCongruential(std::uint64_t Seed, std::uint64_t Iterations);
+	public:
+		using Generator = LinearCongruentialGenerator<ModulusKind>;
+		using result_type = typename Generator::result_type;
+
+		static constexpr std::size_t lane_count = LaneCount;
+		static constexpr typename Generator::AffineMap LaneStep = Generator::StepMap(LaneCount);
+
+		//The first block is the next LaneCount outputs of Start
+		//第一个块是 Start 接下来的 LaneCount 个输出
+		explicit LinearCongruentialLanes(const Generator& Start)
+		{
+			std::uint64_t Value = Start.state();
+			for (std::size_t Lane = 0; Lane < LaneCount; ++Lane)
+			{
+				Value = Generator::Step(Value);
+				this->States[Lane] = Value;
+			}
+		}
+
+		//Writes the next LaneCount values of the sequence
+		//写出序列接下来的 LaneCount 个值
+		void NextBlock(std::span<result_type, LaneCount> Block)
+		{
+			for (std::size_t Lane = 0; Lane < LaneCount; ++Lane)
+				Block[Lane] = this->States[Lane];
+			for (std::size_t Lane = 0; Lane < LaneCount; ++Lane)
+				this->States[Lane] = LaneStep(this->States[Lane]);
+		}
+
+		std::array<result_type, LaneCount> operator()()
+		{
+			std::array<result_type, LaneCount> Block;
+			this->NextBlock(Block);
+			return Block;
+		}
+
+	private:
+		std::array<std::uint64_t, LaneCount> States {};
+	};
+
+	template<LinearCongruentialModulus ModulusKind>
+	void LinearCongruentialGenerator<ModulusKind>::fill(std::span<result_type> Values)
+	{
+		constexpr std::size_t LaneCount = 8;
+		std::size_t Index = 0;
+		if (Values.size() >= LaneCount)
+		{
+			LinearCongruentialLanes<ModulusKind, LaneCount> Lanes(*this);
+			for (; Index + LaneCount <= Values.size(); Index += LaneCount)
+				Lanes.NextBlock(Values.subspan(Index).template first<LaneCount>());
+			this->State = Values[Index - 1];
+		}
+		for (; Index < Values.size(); ++Index)
+			Values[Index] = (*this)();
+	}
+
+	/*
+		Inversive congruential generator X(n + 1) = A * X(n)^-1 + B mod P with P = 2^63 - 25 (0^-1 is taken as 0), the sequence of Nonlinear_InversiveCongruential.
+		The inverse is Fermat's X^(P - 2) on exact Montgomery products; P - 2 = (2^58 - 1) * 2^5 + 5, so a fixed addition chain needs 63 squarings and 10 multiplications.
+		The state is kept in Montgomery form and every output is a residue in [0, P).
+		逆同余生成器 X(n + 1) = A * X(n)^-1 + B mod P, P = 2^63 - 25 (0 的逆取为 0), 与 Nonlinear_InversiveCongruential 的序列相同。
+		逆元用费马小定理 X^(P - 2) 在精确的蒙哥马利乘积上计算; P - 2 = (2^58 - 1) * 2^5 + 5, 固定的加法链只需63次平方和10次乘法。
+		状态以蒙哥马利形式保存, 每个输出都是 [0, P) 中的剩余。
+	*/
+	class InversiveCongruentialGenerator
+	{
+	public:
+		using result_type = std::uint64_t;
+
+		//https://www.johndcook.com/blog/2020/02/19/inverse-congruence-rng/
+		static constexpr std::uint64_t Modulus = 9223372036854775783ULL;
+		static constexpr std::uint64_t Multiplier = 5520335699031059059ULL;
+		static constexpr std::uint64_t Increment = 2752743153957480735ULL;
+
+		static constexpr MontgomeryArithmetic64 Arithmetic { Modulus };
+		static constexpr std::uint64_t MultiplierMontgomery = Arithmetic.ToMontgomery(Multiplier);
+		static constexpr std::uint64_t IncrementMontgomery = Arithmetic.ToMontgomery(Increment);
+
+		static constexpr result_type min() { return 0; }
+		static constexpr result_type max() { return Modulus - 1; }
+
+		//X^-1 mod Modulus (0 for 0), argument and result in Montgomery form
+		//X^-1 mod Modulus (0 的结果为 0), 参数与结果都是蒙哥马利形式
+		static constexpr std::uint64_t InverseMontgomery(std::uint64_t X)
+		{
+			auto SquareRepeatedly = [](std::uint64_t Value, int Count)
+			{
+				for (int Round = 0; Round < Count; ++Round)
+					Value = Arithmetic.Square(Value);
+				return Value;
+			};
+
+			//X_k = X^(2^k - 1)
+			const std::uint64_t X_Squared = Arithmetic.Square(X);
+			const std::uint64_t X_2 = Arithmetic.Multiply(X_Squared, X);
+			const std::uint64_t X_4 = Arithmetic.Multiply(SquareRepeatedly(X_2, 2), X_2);
+			const std::uint64_t X_8 = Arithmetic.Multiply(SquareRepeatedly(X_4, 4), X_4);
+			const std::uint64_t X_16 = Arithmetic.Multiply(SquareRepeatedly(X_8, 8), X_8);
+			const std::uint64_t X_32 = Arithmetic.Multiply(SquareRepeatedly(X_16, 16), X_16);
+			const std::uint64_t X_48 = Arithmetic.Multiply(SquareRepeatedly(X_32, 16), X_16);
+			const std::uint64_t X_56 = Arithmetic.Multiply(SquareRepeatedly(X_48, 8), X_8);
+			const std::uint64_t X_58 = Arithmetic.Multiply(SquareRepeatedly(X_56, 2), X_2);
+			const std::uint64_t X_Fifth = Arithmetic.Multiply(Arithmetic.Square(X_Squared), X);
+			return Arithmetic.Multiply(SquareRepeatedly(X_58, 5), X_Fifth);
+		}
+
+		//One step on a state in Montgomery form
+		//对蒙哥马利形式的状态前进一步
+		static constexpr std::uint64_t NextMontgomery(std::uint64_t StateMontgomery)
+		{
+			return Arithmetic.Add(Arithmetic.Multiply(InverseMontgomery(StateMontgomery), MultiplierMontgomery), IncrementMontgomery);
+		}
+
+		explicit InversiveCongruentialGenerator(std::uint64_t Seed = 1)
+		{
+			this->seed(Seed);
+		}
+
+		//X(0) = Seed mod Modulus; the first output is X(1)
+		//X(0) = Seed mod Modulus; 第一个输出是 X(1)
+		void seed(std::uint64_t Seed);
+
+		result_type operator()()
+		{
+			this->StateMontgomery = NextMontgomery(this->StateMontgomery);
+			return Arithmetic.FromMontgomery(this->StateMontgomery);
+		}
+
+		void discard(unsigned long long Count);
+
+		void fill(std::span<result_type> Values);
+
+	private:
+		std::uint64_t StateMontgomery = 0;
+	};
+
+	/*
+		LaneCount independent inversive congruential sequences advanced together with Montgomery's simultaneous inversion:
+		the product of all states is inverted once, and each state's inverse is recovered with 3 multiplications,
+		so a step costs one inversion plus about 5 multiplications per lane instead of one inversion per value.
+		Lane i is exactly InversiveCongruentialGenerator seeded with LaneSeed(Seed, i); outputs are interleaved lane by lane.
+		LaneCount 条独立的逆同余序列用蒙哥马利联合求逆一起前进:
+		所有状态的乘积只求逆一次, 再用3次乘法恢复每个状态的逆元, 因此每步的代价是一次求逆加每条通道约5次乘法, 而不是每个值一次求逆。
+		第 i 条通道恰好是以 LaneSeed(Seed, i) 为种子的 InversiveCongruentialGenerator; 输出按通道依次交错。
+	*/
+	template<std::size_t LaneCount = 16>
+	class InversiveCongruentialGeneratorBatch
+	{
+		static_assert(LaneCount >= 2, "");
+
+	public:
+		using result_type = std::uint64_t;
+		using Generator = InversiveCongruentialGenerator;
+
+		static constexpr std::size_t lane_count = LaneCount;
+
+		static constexpr result_type min() { return Generator::min(); }
+		static constexpr result_type max() { return Generator::max(); }
+
+		//Lane seeds come from SplitMix64, so nearby seeds do not give related lanes
+		//通道种子来自 SplitMix64, 使相近的种子不会产生相关的通道
+		static constexpr std::uint64_t LaneSeed(std::uint64_t Seed, std::size_t Lane)
+		{
+			std::uint64_t Value = Seed + 0x9e3779b97f4a7c15ULL * (Lane + 1);
+			Value = (Value ^ (Value >> 30)) * 0xbf58476d1ce4e5b9ULL;
+			Value = (Value ^ (Value >> 27)) * 0x94d049bb133111ebULL;
+			return Value ^ (Value >> 31);
+		}
+
+		//Advances every lane by one step with a single inversion
+		//用一次求逆使每条通道前进一步
+		static void StepLanes(std::array<std::uint64_t, LaneCount>& StatesMontgomery)
+		{
+			constexpr const MontgomeryArithmetic64& Arithmetic = Generator::Arithmetic;
 
+			//PrefixProducts[i] = States[0] * ... * States[i], a zero state counts as 1 and is inverted to 0 afterwards
+			//PrefixProducts[i] = States[0] * ... * States[i], 为零的状态按1计算, 之后其逆取为0
+			std::array<std::uint64_t, LaneCount> PrefixProducts;
+			std::uint64_t Product = Arithmetic.One;
+			for (std::size_t Lane = 0; Lane < LaneCount; ++Lane)
+			{
+				const std::uint64_t Factor = StatesMontgomery[Lane] != 0 ? StatesMontgomery[Lane] : Arithmetic.One;
+				Product = Arithmetic.Multiply(Product, Factor);
+				PrefixProducts[Lane] = Product;
+			}
+
+			std::uint64_t InverseProduct = Generator::InverseMontgomery(Product);
+			for (std::size_t Lane = LaneCount; Lane-- > 0;)
+			{
+				const std::uint64_t State = StatesMontgomery[Lane];
+				const std::uint64_t Inverse = Lane > 0 ? Arithmetic.Multiply(InverseProduct, PrefixProducts[Lane - 1]) : InverseProduct;
+				if (State != 0)
+					InverseProduct = Arithmetic.Multiply(InverseProduct, State);
+
+				StatesMontgomery[Lane] = Arithmetic.Add(Arithmetic.Multiply(State != 0 ? Inverse : 0, Generator::MultiplierMontgomery), Generator::IncrementMontgomery);
+			}
+		}
+
+		explicit InversiveCongruentialGeneratorBatch(std::uint64_t Seed = 1)
+		{
+			this->seed(Seed);
+		}
+
+		void seed(std::uint64_t Seed)
+		{
+			for (std::size_t Lane = 0; Lane < LaneCount; ++Lane)
+				this->StatesMontgomery[Lane] = Generator::Arithmetic.ToMontgomery(LaneSeed(Seed, Lane));
+			this->Position = LaneCount;
+		}
+
+		result_type operator()()
+		{
+			if (this->Position == LaneCount)
+				this->Refill();
+			return this->Outputs[this->Position++];
+		}
+
+		void discard(unsigned long long Count)
+		{
+			for (; Count > 0 && this->Position < LaneCount; --Count)
+				++this->Position;
+			for (; Count >= LaneCount; Count -= LaneCount)
+				StepLanes(this->StatesMontgomery);
+			for (; Count > 0; --Count)
+				(*this)();
+		}
+
+		//Same values as calling operator() Values.size() times
+		//与调用 Values.size() 次 operator() 的结果相同
+		void fill(std::span<result_type> Values)
+		{
+			std::size_t Index = 0;
+			for (; Index < Values.size() && this->Position < LaneCount; ++Index)
+				Values[Index] = this->Outputs[this->Position++];
+			for (; Index + LaneCount <= Values.size(); Index += LaneCount)
+			{
+				StepLanes(this->StatesMontgomery);
+				for (std::size_t Lane = 0; Lane < LaneCount; ++Lane)
+					Values[Index + Lane] = Generator::Arithmetic.FromMontgomery(this->StatesMontgomery[Lane]);
+			}
+			for (; Index < Values.size(); ++Index)
+				Values[Index] = (*this)();
+		}
+
+	private:
+		std::array<std::uint64_t, LaneCount> StatesMontgomery {};
+		std::array<result_type, LaneCount> Outputs {};
+		std::size_t Position = LaneCount;
+
+		void Refill()
+		{
+			StepLanes(this->StatesMontgomery);
+			for (std::size_t Lane = 0; Lane < LaneCount; ++Lane)
+				this->Outputs[Lane] = Generator::Arithmetic.FromMontgomery(this->StatesMontgomery[Lane]);
+			this->Position = 0;
+		}
+	};
+
+	/*
+		Blum Blum Shub: X(n + 1) = X(n)^2 mod N with N = P * Q, P and Q primes congruent to 3 mod 4.
+		Each squaring is a Montgomery square modulo N, and floor(log2(floor(log2 N))) low bits of every X(n) (5 for the 63 and 64 bit moduli made here)
+		go into a bit buffer that operator() drains 64 bits at a time.
+		The primes are found by a deterministic Miller-Rabin test, and since P and Q are known, discard jumps with X(n + k) = X(n)^(2^k mod lcm(P - 1, Q - 1)).
+		The modulus is one 64-bit word; squaring goes only through MontgomeryArithmetic64, the part a multi-word modulus would replace.
+		Blum Blum Shub: X(n + 1) = X(n)^2 mod N, N = P * Q, P 与 Q 是模4余3的素数。
+		每次平方都是模 N 的蒙哥马利平方, 每个 X(n) 的低 floor(log2(floor(log2 N))) 位 (这里生成的63位和64位模数为5位) 进入位缓冲区, operator() 每次从中取出64位。
+		素数由确定性的 Miller-Rabin 测试找出; 由于 P 和 Q 已知, discard 按 X(n + k) = X(n)^(2^k mod lcm(P - 1, Q - 1)) 跳跃。
+		模数只有一个64位字; 平方只经过 MontgomeryArithmetic64, 多字模数只需替换这一部分。
+	*/
 	class BlumBlumShub
 	{
 
 	private:
 
-		std::linear_congruential_engine<std::uint32_t, 134775813UL, 1UL, (1UL << 32) - 1> LCG;
-		bool IsPrimeNumber(std::uint64_t Number);
-		std::uint64_t FastPowerAlgorithmWithModulus(std::uint64_t BaseNumber, std::uint64_t ExponentNumber, std::uint64_t ModulusNumber);
+		std::linear_congruential_engine<std::uint32_t, 134775813UL, 1UL, std::numeric_limits<std::uint32_t>::max()> LCG;
+
+		//A prime congruent to 3 mod 4 with the top bit set, drawn from LCG
+		//由 LCG 抽取的最高位为1且模4余3的素数
+		std::uint32_t GenerateBlumPrime();
 
 		std::uint32_t Q = 0, P = 0;
 		std::uint64_t N = 0;
-		std::uint64_t X = 0;
+		//lcm(P - 1, Q - 1), the exponents of X can be reduced modulo it
+		//lcm(P - 1, Q - 1), X 的指数可以对它取模
+		std::uint64_t Lambda = 0;
+		MontgomeryArithmetic64 Arithmetic { 1 };
+		std::uint64_t X_Montgomery = 0;
+
+		std::uint32_t BitsPerStep = 1;
+		std::uint64_t BitBuffer = 0;
+		std::uint32_t BufferedBits = 0;
+
+		//Squares X once and returns its low BitsPerStep bits
+		//将 X 平方一次并返回其低 BitsPerStep 位
+		std::uint64_t StepBits()
+		{
+			this->X_Montgomery = this->Arithmetic.Square(this->X_Montgomery);
+			return this->Arithmetic.FromMontgomery(this->X_Montgomery) & ((std::uint64_t(1) << this->BitsPerStep) - 1);
+		}
+
+		//X = X^(2^Steps)
+		void JumpSteps(std::uint64_t Steps);
 
 	public:
+		using result_type = std::uint64_t;
+
+		static constexpr result_type min() { return 0; }
+		static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+		//Deterministic Miller-Rabin for every 64-bit number
+		//对所有64位数都确定的 Miller-Rabin 测试
+		static bool IsPrimeNumber(std::uint64_t Number);
 
 		void ResetState(std::uint64_t Seed);
+
+		//Squares Iterations times (at least once) and returns the new X; the bit buffer is left as it is
+		//平方 Iterations 次 (至少一次) 并返回新的 X; 位缓冲区保持不变
 		std::uint64_t NumberGeneration(std::uint64_t Iterations);
 
+		result_type operator()()
+		{
+			std::uint64_t Result = 0;
+			std::uint32_t FilledBits = 0;
+			while (FilledBits < 64)
+			{
+				if (this->BufferedBits == 0)
+				{
+					this->BitBuffer = this->StepBits();
+					this->BufferedBits = this->BitsPerStep;
+				}
+				const std::uint32_t TakenBits = std::min(64 - FilledBits, this->BufferedBits);
+				Result |= (this->BitBuffer & ((std::uint64_t(1) << TakenBits) - 1)) << FilledBits;
+				this->BitBuffer >>= TakenBits;
+				this->BufferedBits -= TakenBits;
+				FilledBits += TakenBits;
+			}
+			return Result;
+		}
+
+		//Skips Count outputs of operator() with one modular exponentiation
+		//用一次模幂跳过 operator() 的 Count 个输出
+		void discard(unsigned long long Count);
+
+		std::uint64_t modulus() const
+		{
+			return this->N;
+		}
+
+		std::uint32_t bits_per_step() const
+		{
+			return this->BitsPerStep;
+		}
+
 		BlumBlumShub() = delete;
 
 		BlumBlumShub(std::uint64_t Seed)
 			: LCG(Seed)
 		{
-			if(Seed == 0);
-				this->ResetState(1);
 			this->ResetState(Seed);
 		}
 
@@ -110,12 +811,320 @@ namespace PseudoRandomNumberGenerators
 
 	};
 
-	class MersenneTwister64Bit
+	/*
+		Marsaglia's CMWC4096 as a standard engine: x(n) = (b - 1) - (a * x(n - 4096) + c(n - 1)) mod b, c(n) = floor((a * x(n - 4096) + c(n - 1)) / b),
+		with b = 2^32 - 1 and a = 18782; p = a * b^4096 + 1 is prime and the period is about 2^131086.
+		It is the recurrence and seeding of ComplementaryMultiplyWithCarry(std::uint32_t) / NumberGeneration32Bit, without the per-call loop and printing.
+		Every product fits in 64 bits, and the reduction mod 2^32 - 1 is one add and one compare; the 4096 words are a ring whose next slot is Index,
+		stepped in runs up to the end of the ring, so fill and discard are straight loops with no index wrap.
+		The 64-bit engine packs two consecutive words per output (the first in the high half).
+		A CMWC in base 2^64 - 1 would need a multiplier with a * (2^64 - 1)^4096 + 1 prime, and no such multiplier is established, so it keeps the proven 32-bit recurrence.
+		Marsaglia 的 CMWC4096 的标准引擎形式: x(n) = (b - 1) - (a * x(n - 4096) + c(n - 1)) mod b, c(n) = floor((a * x(n - 4096) + c(n - 1)) / b),
+		其中 b = 2^32 - 1, a = 18782, p = a * b^4096 + 1 是素数, 周期约为 2^131086。
+		与 ComplementaryMultiplyWithCarry(std::uint32_t) / NumberGeneration32Bit 的递推和播种相同, 但没有逐次调用的循环和打印。
+		每个乘积都能放进 64 位, 模 2^32 - 1 的约简只需一次加法和一次比较; 4096 个字构成一个环, 下一个位置是 Index,
+		按段推进到环的末尾, 所以 fill 与 discard 是没有下标回绕的直线循环。
+		64 位引擎把两个连续的字组成一个输出 (第一个在高半部分)。
+		以 2^64 - 1 为基的 CMWC 需要使 a * (2^64 - 1)^4096 + 1 为素数的乘数, 目前没有公认的这样的乘数, 所以仍然使用已被证明的 32 位递推。
+	*/
+	template<std::unsigned_integral ResultType>
+	class ComplementaryMultiplyWithCarry4096 : public UniformRandomBitGenerator<ResultType>
 	{
+		static_assert(std::same_as<ResultType, std::uint32_t> || std::same_as<ResultType, std::uint64_t>, "");
 
-	private:
-		//word size (in number of bits)
-		static constexpr std::uint32_t WORD_SIZE = 64;
+		template<std::size_t LaneCount>
+		friend class ComplementaryMultiplyWithCarry4096Lanes;
+
+	public:
+		using result_type = ResultType;
+
+		static constexpr std::size_t STATE_SIZE = 4096;
+		static constexpr std::size_t WORDS_PER_VALUE = sizeof(ResultType) / sizeof(std::uint32_t);
+		static constexpr std::uint64_t MULTIPLIER = 18782ULL;
+		static constexpr std::uint32_t INITIAL_CARRY = 809430660UL;
+
+		//(a * Lagged + Carry) reduced mod 2^32 - 1 and complemented, Carry becomes the new carry
+		//(a * Lagged + Carry) 模 2^32 - 1 约简后取补, Carry 变为新的进位
+		static constexpr std::uint32_t Step(std::uint32_t Lagged, std::uint32_t& Carry)
+		{
+			const std::uint64_t Product = MULTIPLIER * Lagged + Carry;
+			Carry = static_cast<std::uint32_t>(Product >> 32);
+			std::uint32_t Value = static_cast<std::uint32_t>(Product) + Carry;
+			const std::uint32_t Wrapped = Value < Carry;
+			Value += Wrapped;
+			Carry += Wrapped;
+			return 0xFFFFFFFEUL - Value;
+		}
+
+		explicit ComplementaryMultiplyWithCarry4096(std::uint64_t Seed)
+		{
+			this->seed(Seed);
+		}
+
+		ComplementaryMultiplyWithCarry4096(const ComplementaryMultiplyWithCarry4096&) = default;
+		ComplementaryMultiplyWithCarry4096& operator=(const ComplementaryMultiplyWithCarry4096&) = default;
+
+		~ComplementaryMultiplyWithCarry4096()
+		{
+			memory_set_no_optimize_function<0x00>(this->StateArray.data(), sizeof(std::uint32_t) * this->StateArray.size());
+			this->CarryValue = 0;
+			this->Index = 0;
+		}
+
+		void seed(std::uint64_t Seed)
+		{
+			const std::uint64_t NewSeed = Linear_Congruential(Seed, 1);
+
+			this->StateArray[0] = static_cast<std::uint32_t>(NewSeed);
+			this->StateArray[1] = static_cast<std::uint32_t>(NewSeed >> 32);
+
+			//Initialization state functions for the 32-bit version of Mersenne Twister (Edited)
+			for (std::uint32_t Index = 2; Index < STATE_SIZE; ++Index)
+				this->StateArray[Index] = 0x6C078965UL * (this->StateArray[Index - 1] ^ (this->StateArray[Index - 2] >> 30)) + Index;
+
+			this->CarryValue = INITIAL_CARRY;
+			this->Index = 0;
+		}
+
+		result_type operator()()
+		{
+			if constexpr (WORDS_PER_VALUE == 1)
+				return this->NextWord();
+			else
+			{
+				const std::uint64_t High = this->NextWord();
+				return (High << 32) | this->NextWord();
+			}
+		}
+
+		void fill(std::span<result_type> Values)
+		{
+			this->Advance<true>(Values.data(), Values.size());
+		}
+
+		void discard(unsigned long long Count)
+		{
+			this->Advance<false>(nullptr, Count);
+		}
+
+		friend bool operator==(const ComplementaryMultiplyWithCarry4096& Left, const ComplementaryMultiplyWithCarry4096& Right)
+		{
+			return Left.StateArray == Right.StateArray && Left.CarryValue == Right.CarryValue && Left.Index == Right.Index;
+		}
+
+	private:
+		std::array<std::uint32_t, STATE_SIZE> StateArray {};
+		std::uint32_t CarryValue = INITIAL_CARRY;
+		//The next word to replace; always a multiple of WORDS_PER_VALUE
+		//下一个要替换的字; 总是 WORDS_PER_VALUE 的倍数
+		std::size_t Index = 0;
+
+		ComplementaryMultiplyWithCarry4096() = default;
+
+		std::uint32_t NextWord()
+		{
+			const std::uint32_t Word = Step(this->StateArray[this->Index], this->CarryValue);
+			this->StateArray[this->Index] = Word;
+			this->Index = (this->Index + 1) & (STATE_SIZE - 1);
+			return Word;
+		}
+
+		//Steps Count values in runs that stop at the end of the ring, writing them to Values when WriteValues
+		//按到环末尾为止的分段推进 Count 个值, WriteValues 时把它们写入 Values
+		template<bool WriteValues>
+		void Advance(result_type* Values, unsigned long long Count)
+		{
+			std::uint32_t Carry = this->CarryValue;
+			while (Count > 0)
+			{
+				const std::size_t Run = static_cast<std::size_t>(std::min<unsigned long long>(Count, (STATE_SIZE - this->Index) / WORDS_PER_VALUE));
+				std::uint32_t* const Words = this->StateArray.data() + this->Index;
+				for (std::size_t Position = 0; Position < Run; ++Position)
+				{
+					if constexpr (WORDS_PER_VALUE == 1)
+					{
+						Words[Position] = Step(Words[Position], Carry);
+						if constexpr (WriteValues)
+							Values[Position] = Words[Position];
+					}
+					else
+					{
+						Words[2 * Position] = Step(Words[2 * Position], Carry);
+						Words[2 * Position + 1] = Step(Words[2 * Position + 1], Carry);
+						if constexpr (WriteValues)
+							Values[Position] = (static_cast<std::uint64_t>(Words[2 * Position]) << 32) | Words[2 * Position + 1];
+					}
+				}
+				if constexpr (WriteValues)
+					Values += Run;
+				Count -= Run;
+				this->Index = (this->Index + Run * WORDS_PER_VALUE) & (STATE_SIZE - 1);
+			}
+			this->CarryValue = Carry;
+		}
+	};
+
+	using ComplementaryMultiplyWithCarry32Bit4096 = ComplementaryMultiplyWithCarry4096<std::uint32_t>;
+	using ComplementaryMultiplyWithCarry64Bit4096 = ComplementaryMultiplyWithCarry4096<std::uint64_t>;
+
+	/*
+		LaneCount independent CMWC4096 streams stepped side by side; lane l starts as ComplementaryMultiplyWithCarry32Bit4096(Seed + l).
+		The carry chain is what bounds a single stream, and the lanes have no dependency on each other,
+		so the per-lane loop is plain 32 x 32 -> 64 bit multiply-adds and compares the compiler vectorizes (pmuludq / vpmuludq).
+		Word k of lane l is at State[k * LaneCount + l] and all lanes share one ring index; output of step s in lane l goes to Values[s * LaneCount + l].
+		LaneCount 条相互独立的 CMWC4096 流并排推进; 第 l 条通道的起点是 ComplementaryMultiplyWithCarry32Bit4096(Seed + l)。
+		限制单条流的是进位链, 而通道之间没有依赖,
+		所以逐通道的循环只是编译器可以向量化的 32 x 32 -> 64 位乘加与比较 (pmuludq / vpmuludq)。
+		通道 l 的第 k 个字位于 State[k * LaneCount + l], 所有通道共用一个环形下标; 通道 l 第 s 步的输出写到 Values[s * LaneCount + l]。
+	*/
+	template<std::size_t LaneCount = 8>
+	class ComplementaryMultiplyWithCarry4096Lanes
+	{
+		static_assert(LaneCount == 4 || LaneCount == 8, "");
+
+	public:
+		using Generator = ComplementaryMultiplyWithCarry32Bit4096;
+		using result_type = Generator::result_type;
+
+		static constexpr std::size_t lane_count = LaneCount;
+		static constexpr std::size_t STATE_SIZE = Generator::STATE_SIZE;
+
+		explicit ComplementaryMultiplyWithCarry4096Lanes(std::uint64_t Seed)
+		{
+			for (std::size_t Lane = 0; Lane < LaneCount; ++Lane)
+				this->SetLane(Lane, Generator(Seed + Lane));
+		}
+
+		//Lane l continues Streams[l]
+		//通道 l 延续 Streams[l]
+		explicit ComplementaryMultiplyWithCarry4096Lanes(std::span<const Generator, LaneCount> Streams)
+		{
+			for (std::size_t Lane = 0; Lane < LaneCount; ++Lane)
+				this->SetLane(Lane, Streams[Lane]);
+		}
+
+		//The scalar engine that continues lane Lane
+		//延续第 Lane 个通道的标量引擎
+		Generator lane(std::size_t Lane) const
+		{
+			Generator Engine;
+			for (std::size_t Word = 0; Word < STATE_SIZE; ++Word)
+				Engine.StateArray[Word] = this->State[Word * LaneCount + Lane];
+			Engine.CarryValue = this->Carries[Lane];
+			Engine.Index = this->Index;
+			return Engine;
+		}
+
+		//Writes one output of every lane, lane l's to Block[l]
+		//写出每个通道的一个输出, 通道 l 的写到 Block[l]
+		void NextBlock(std::span<result_type, LaneCount> Block)
+		{
+			this->Generate(Block.data(), 1);
+		}
+
+		std::array<result_type, LaneCount> operator()()
+		{
+			std::array<result_type, LaneCount> Block;
+			this->NextBlock(Block);
+			return Block;
+		}
+
+		//Whole steps go straight into Values; when Values.size() is not a multiple of LaneCount, the unused outputs of the last step are dropped
+		//整步直接写入 Values; 若 Values.size() 不是 LaneCount 的倍数, 最后一步中用不上的输出被丢弃
+		void fill(std::span<result_type> Values)
+		{
+			const std::size_t Steps = Values.size() / LaneCount;
+			if (Steps > 0)
+				this->Generate(Values.data(), Steps);
+
+			if (const std::size_t Rest = Values.size() % LaneCount; Rest != 0)
+			{
+				std::array<result_type, LaneCount> Block;
+				this->NextBlock(Block);
+				std::copy_n(Block.begin(), Rest, Values.begin() + Steps * LaneCount);
+			}
+		}
+
+	private:
+		alignas(64) std::array<std::uint32_t, STATE_SIZE * LaneCount> State {};
+		alignas(64) std::array<std::uint32_t, LaneCount> Carries {};
+		std::size_t Index = 0;
+
+		//Rotates the ring of Engine so that its next word sits at the shared index
+		//旋转 Engine 的环, 使它的下一个字位于共用的下标处
+		void SetLane(std::size_t Lane, const Generator& Engine)
+		{
+			for (std::size_t Word = 0; Word < STATE_SIZE; ++Word)
+				this->State[((this->Index + Word) & (STATE_SIZE - 1)) * LaneCount + Lane] = Engine.StateArray[(Engine.Index + Word) & (STATE_SIZE - 1)];
+			this->Carries[Lane] = Engine.CarryValue;
+		}
+
+		void Generate(result_type* Values, std::size_t Steps)
+		{
+			std::array<std::uint32_t, LaneCount> Carry = this->Carries;
+			while (Steps > 0)
+			{
+				const std::size_t Run = std::min(Steps, STATE_SIZE - this->Index);
+				std::uint32_t* const Words = this->State.data() + this->Index * LaneCount;
+				for (std::size_t Position = 0; Position < Run * LaneCount; Position += LaneCount)
+				{
+					//All loads before all stores, so the lanes vectorize without assuming Values and State do not overlap
+					//先全部读取再全部写入, 这样无需假定 Values 与 State 不重叠, 各通道也能向量化
+					std::array<std::uint32_t, LaneCount> Next;
+					for (std::size_t Lane = 0; Lane < LaneCount; ++Lane)
+						Next[Lane] = Generator::Step(Words[Position + Lane], Carry[Lane]);
+					std::copy_n(Next.begin(), LaneCount, Words + Position);
+					std::copy_n(Next.begin(), LaneCount, Values + Position);
+				}
+				Values += Run * LaneCount;
+				Steps -= Run;
+				this->Index = (this->Index + Run) & (STATE_SIZE - 1);
+			}
+			this->Carries = Carry;
+		}
+	};
+
+	using cmwc4096x4 = ComplementaryMultiplyWithCarry4096Lanes<4>;
+	using cmwc4096x8 = ComplementaryMultiplyWithCarry4096Lanes<8>;
+
+	/*
+		GF(2) polynomial jump-ahead of the Mersenne Twister (Haramoto, Matsumoto, Nishimura, Panneton and L'Ecuyer, 2008).
+		The word recurrence F is linear over GF(2), so F^D equals p(F) for p(t) = t^D mod the characteristic polynomial, a polynomial of degree below 19937;
+		p(F) is evaluated with a sliding-window Horner's rule, about 20000 recurrence steps and 3300 state additions instead of D steps.
+		Jumps of 2^64 and 2^128 outputs use precomputed polynomials (MersenneTwisterJumpPolynomials.h); other powers of two are computed by repeated squaring once and cached.
+		梅森旋转的 GF(2) 多项式跳跃 (Haramoto, Matsumoto, Nishimura, Panneton, L'Ecuyer, 2008)。
+		字递推 F 在 GF(2) 上是线性的, 所以 F^D 等于 p(F), 其中 p(t) = t^D 模特征多项式, 次数低于 19937;
+		p(F) 用滑动窗口的 Horner 法则求值, 大约只需 20000 步递推和 3300 次状态加法, 而不是 D 步。
+		跳过 2^64 和 2^128 个输出使用预计算的多项式 (MersenneTwisterJumpPolynomials.h); 其他 2 的幂次用反复平方计算一次并缓存。
+	*/
+	namespace MersenneTwisterJump
+	{
+		//Coefficients of t^0 .. t^19967, least significant word first
+		//t^0 .. t^19967 的系数, 低位字在前
+		using Polynomial = std::array<std::uint64_t, 312>;
+
+		//t^(D - 1) mod the characteristic polynomial, where D is the largest multiple of STATE_SIZE that is at most 2^PowerOfTwo (PowerOfTwo >= bit_width(STATE_SIZE))
+		//t^(D - 1) 模特征多项式, 其中 D 是不超过 2^PowerOfTwo 的 STATE_SIZE 的最大倍数 (PowerOfTwo >= bit_width(STATE_SIZE))
+		template<typename Parameters>
+		Polynomial ComputeJumpPolynomial(std::uint32_t PowerOfTwo);
+
+		//The precomputed polynomial for 2^64 and 2^128, otherwise ComputeJumpPolynomial cached
+		//2^64 与 2^128 使用预计算的多项式, 其他情况为缓存的 ComputeJumpPolynomial 结果
+		template<typename Parameters>
+		const Polynomial& JumpPolynomial(std::uint32_t PowerOfTwo);
+
+		//Moves a state 2^PowerOfTwo outputs ahead. State is a twisted block (or the seeded words) whose next output is State[Index]; Index == STATE_SIZE means a twist is due
+		//把状态前移 2^PowerOfTwo 个输出。State 是一个旋转过的块 (或刚播种的字), 下一个输出是 State[Index]; Index == STATE_SIZE 表示该旋转了
+		template<typename Parameters>
+		void JumpAhead(typename Parameters::WordType* State, std::size_t& Index, std::uint32_t PowerOfTwo);
+	}
+
+	class MersenneTwister64Bit
+	{
+
+	private:
+		//word size (in number of bits)
+		static constexpr std::uint32_t WORD_SIZE = 64;
 		
 		//degree of recurrence
 		static constexpr std::uint32_t STATE_SIZE = 312;
@@ -156,12 +1165,25 @@ namespace PseudoRandomNumberGenerators
 		void TwistState();
 
 	public:
+		//Length of the substreams handed out by Split
+		//Split 分出的子流长度
+		static constexpr std::uint32_t SUBSTREAM_POWER_OF_TWO = 128;
+
 		void ResetState(std::uint64_t Seed);
 		std::uint64_t NumberGeneration(std::uint64_t Iterations);
 
+		//Same state as NumberGeneration(2^PowerOfTwo), see MersenneTwisterJump
+		//与 NumberGeneration(2^PowerOfTwo) 之后的状态相同, 见 MersenneTwisterJump
+		void JumpAhead(std::uint32_t PowerOfTwo);
+
+		//Count generators on disjoint substreams of 2^SUBSTREAM_POWER_OF_TWO outputs, the first one starting at this generator's position; this generator moves past all of them
+		//Count 个位于互不重叠的、长 2^SUBSTREAM_POWER_OF_TWO 个输出的子流上的生成器, 第一个从本生成器的当前位置开始; 本生成器随后越过它们全部
+		std::vector<MersenneTwister64Bit> Split(std::size_t Count);
+
 		MersenneTwister64Bit() = delete;
 
 		explicit MersenneTwister64Bit(std::uint64_t Seed);
+		MersenneTwister64Bit(const MersenneTwister64Bit& Other) = default;
 		~MersenneTwister64Bit();
 	};
 
@@ -213,15 +1235,191 @@ namespace PseudoRandomNumberGenerators
 		void TwistState();
 
 	public:
+		//Length of the substreams handed out by Split
+		//Split 分出的子流长度
+		static constexpr std::uint32_t SUBSTREAM_POWER_OF_TWO = 128;
+
 		void ResetState(std::uint32_t Seed);
 		std::uint32_t NumberGeneration(std::uint64_t Iterations);
 
+		//Same state as NumberGeneration(2^PowerOfTwo), see MersenneTwisterJump
+		//与 NumberGeneration(2^PowerOfTwo) 之后的状态相同, 见 MersenneTwisterJump
+		void JumpAhead(std::uint32_t PowerOfTwo);
+
+		//Count generators on disjoint substreams of 2^SUBSTREAM_POWER_OF_TWO outputs, the first one starting at this generator's position; this generator moves past all of them
+		//Count 个位于互不重叠的、长 2^SUBSTREAM_POWER_OF_TWO 个输出的子流上的生成器, 第一个从本生成器的当前位置开始; 本生成器随后越过它们全部
+		std::vector<MersenneTwister32Bit> Split(std::size_t Count);
+
 		MersenneTwister32Bit() = delete;
 
 		explicit MersenneTwister32Bit(std::uint32_t Seed);
+		MersenneTwister32Bit(const MersenneTwister32Bit& Other) = default;
 		~MersenneTwister32Bit();
 	};
 
+	//Function pointer table of one Mersenne Twister block kernel (see MersenneTwisterKernels.h), selected at runtime by CPU features
+	//一个梅森旋转块内核的函数指针表 (见 MersenneTwisterKernels.h), 运行时按 CPU 特性选择
+	template<typename Parameters>
+	struct MersenneTwisterBlockKernels
+	{
+		using WordType = typename Parameters::WordType;
+
+		const char* Name;
+		CommonToolkit::CPU_FeatureDispatch::CPU_FeatureSet RequiredFeatures;
+		void (*TwistState)(WordType* State);
+		void (*TemperState)(const WordType* State, WordType* Values, std::size_t Count);
+	};
+
+	/*
+		Mersenne Twister that twists and tempers a whole block at once, the same sequence as MersenneTwister32Bit / MersenneTwister64Bit (and std::mt19937 / std::mt19937_64).
+		The twist runs in three ranges without `% STATE_SIZE` and selects the magic number with a mask, the tempering is done for the whole block into an output buffer,
+		and both run in the widest SIMD kernel the processor supports; fill writes whole blocks straight into the caller's span.
+		整块旋转和回火的梅森旋转, 序列与 MersenneTwister32Bit / MersenneTwister64Bit (以及 std::mt19937 / std::mt19937_64) 相同。
+		旋转分三段进行, 不用 `% STATE_SIZE`, 并用掩码选择魔数; 回火对整块进行并写入输出缓冲区,
+		两者都在处理器支持的最宽的 SIMD 内核中运行; fill 把整块直接写入调用者的 span。
+	*/
+	template<typename Parameters>
+	class MersenneTwisterBlock
+	{
+	public:
+		using result_type = typename Parameters::WordType;
+		using KernelTable = MersenneTwisterBlockKernels<Parameters>;
+
+		static constexpr std::size_t STATE_SIZE = Parameters::STATE_SIZE;
+		static constexpr result_type default_seed = 5489U;
+
+		//Length of the substreams handed out by split
+		//split 分出的子流长度
+		static constexpr std::uint32_t SUBSTREAM_POWER_OF_TWO = 128;
+
+		static constexpr result_type min() { return std::numeric_limits<result_type>::min(); }
+		static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+		//Every compiled kernel, best first; the last one is portable
+		//所有编译进来的内核, 最优在前; 最后一个是可移植的
+		static std::span<const KernelTable* const> KernelCandidates();
+
+		//The kernel the engine uses, chosen once from the candidates
+		//引擎使用的内核, 从候选者中选择一次
+		static const KernelTable& Kernels()
+		{
+			static const KernelTable& Selected = CommonToolkit::CPU_FeatureDispatch::SelectKernelTable(KernelCandidates());
+			return Selected;
+		}
+
+		explicit MersenneTwisterBlock(result_type Seed = default_seed)
+		{
+			this->seed(Seed);
+		}
+
+		void seed(result_type Seed)
+		{
+			constexpr unsigned WORD_SIZE = std::numeric_limits<result_type>::digits;
+
+			this->StateArray[0] = Seed;
+			for (std::size_t Index = 1; Index < STATE_SIZE; ++Index)
+				this->StateArray[Index] = Parameters::INITIALIZATION_MULTIPLIER * (this->StateArray[Index - 1] ^ (this->StateArray[Index - 1] >> (WORD_SIZE - 2))) + static_cast<result_type>(Index);
+			this->Position = STATE_SIZE;
+		}
+
+		result_type operator()()
+		{
+			if (this->Position == STATE_SIZE)
+				this->Refill();
+			return this->TemperedArray[this->Position++];
+		}
+
+		//Same values as calling operator() Values.size() times
+		//与调用 Values.size() 次 operator() 的结果相同
+		void fill(std::span<result_type> Values)
+		{
+			const KernelTable& Table = Kernels();
+
+			std::size_t Index = std::min(Values.size(), STATE_SIZE - this->Position);
+			std::copy_n(this->TemperedArray.begin() + this->Position, Index, Values.begin());
+			this->Position += Index;
+
+			for (; Index + STATE_SIZE <= Values.size(); Index += STATE_SIZE)
+			{
+				Table.TwistState(this->StateArray.data());
+				Table.TemperState(this->StateArray.data(), Values.data() + Index, STATE_SIZE);
+			}
+
+			if (Index < Values.size())
+			{
+				this->Refill();
+				this->Position = Values.size() - Index;
+				std::copy_n(this->TemperedArray.begin(), this->Position, Values.begin() + Index);
+			}
+		}
+
+		//Same state as discard(2^PowerOfTwo), see MersenneTwisterJump
+		//与 discard(2^PowerOfTwo) 之后的状态相同, 见 MersenneTwisterJump
+		void jump(std::uint32_t PowerOfTwo)
+		{
+			MersenneTwisterJump::JumpAhead<Parameters>(this->StateArray.data(), this->Position, PowerOfTwo);
+			if (this->Position < STATE_SIZE)
+				Kernels().TemperState(this->StateArray.data(), this->TemperedArray.data(), STATE_SIZE);
+		}
+
+		//Count engines on disjoint substreams of 2^SUBSTREAM_POWER_OF_TWO outputs, the first one starting at this engine's position; this engine moves past all of them
+		//Count 个位于互不重叠的、长 2^SUBSTREAM_POWER_OF_TWO 个输出的子流上的引擎, 第一个从本引擎的当前位置开始; 本引擎随后越过它们全部
+		std::vector<MersenneTwisterBlock> split(std::size_t Count)
+		{
+			std::vector<MersenneTwisterBlock> Substreams;
+			Substreams.reserve(Count);
+			for (std::size_t Index = 0; Index < Count; ++Index)
+			{
+				Substreams.push_back(*this);
+				this->jump(SUBSTREAM_POWER_OF_TWO);
+			}
+			return Substreams;
+		}
+
+		//Whole skipped blocks are twisted but not tempered
+		//整块跳过的部分只旋转不回火
+		void discard(unsigned long long Count)
+		{
+			const std::size_t Buffered = STATE_SIZE - this->Position;
+			if (Count <= Buffered)
+			{
+				this->Position += static_cast<std::size_t>(Count);
+				return;
+			}
+
+			Count -= Buffered;
+			for (; Count >= STATE_SIZE; Count -= STATE_SIZE)
+				Kernels().TwistState(this->StateArray.data());
+			this->Position = STATE_SIZE;
+			if (Count > 0)
+			{
+				this->Refill();
+				this->Position = static_cast<std::size_t>(Count);
+			}
+		}
+
+	private:
+		alignas(64) std::array<result_type, STATE_SIZE> StateArray {};
+		alignas(64) std::array<result_type, STATE_SIZE> TemperedArray {};
+		std::size_t Position = STATE_SIZE;
+
+		void Refill()
+		{
+			const KernelTable& Table = Kernels();
+			Table.TwistState(this->StateArray.data());
+			Table.TemperState(this->StateArray.data(), this->TemperedArray.data(), STATE_SIZE);
+			this->Position = 0;
+		}
+	};
+
+	using MersenneTwister32BitBlock = MersenneTwisterBlock<MersenneTwisterKernels::Parameters32Bit>;
+	using MersenneTwister64BitBlock = MersenneTwisterBlock<MersenneTwisterKernels::Parameters64Bit>;
+
+	template<>
+	std::span<const MersenneTwisterBlockKernels<MersenneTwisterKernels::Parameters32Bit>* const> MersenneTwister32BitBlock::KernelCandidates();
+	template<>
+	std::span<const MersenneTwisterBlockKernels<MersenneTwisterKernels::Parameters64Bit>* const> MersenneTwister64BitBlock::KernelCandidates();
+
 	enum AlgorithmNames : std::uint64_t
 	{
 		BLUM_BLUM_SHUB = 0,
@@ -568,16 +1766,7 @@ namespace PseudoRandomNumberGenerators
 		static constexpr auto short_lag = ShortLag;
 		
 		// Set the modulus and result modulus based on the type of DataType
-		static constexpr DataType modulus_value =
-			std::is_same_v<DataType, std::uint64_t>
-			? (std::uint64_t(1) << 64) - 2
-			: std::is_same_v<DataType, std::uint32_t>
-			? (std::uint32_t(1) << 32) - 2
-			: std::is_same_v<DataType, std::uint16_t>
-			? (std::uint16_t(1) << 16) - 2
-			: std::is_same_v<DataType, std::uint8_t>
-			? (std::uint8_t(1) << 8) - 2
-			: 0;
+		static constexpr DataType modulus_value = std::numeric_limits<DataType>::max() - 1;
 
 		static constexpr DataType result_modulus_value =
 			std::is_same_v<DataType, std::uint64_t>
@@ -619,14 +1808,14 @@ namespace PseudoRandomNumberGenerators
 		{
 			if constexpr (std::numeric_limits<DataType>::digits > 32)
 			{
-				std::linear_congruential_engine<std::uint64_t, 6364136223846793005ULL, 1442695040888963407ULL, (1ULL << 64) - 1> LCG(Seed);
+				std::linear_congruential_engine<std::uint64_t, 6364136223846793005ULL, 1442695040888963407ULL, std::numeric_limits<std::uint64_t>::max()> LCG(Seed);
 
 				for (std::size_t Index = 0; Index < long_lag; ++Index)
 					this->StateSequence[Index] = static_cast<DataType>(LCG());
 			}
 			else
 			{
-				std::linear_congruential_engine<std::uint32_t, 134775813UL, 1UL, (1UL << 32) - 1> LCG(Seed);
+				std::linear_congruential_engine<std::uint32_t, 134775813UL, 1UL, std::numeric_limits<std::uint32_t>::max()> LCG(Seed);
 
 				for (std::size_t Index = 0; Index < long_lag; ++Index)
 					this->StateSequence[Index] = static_cast<DataType>(LCG());
@@ -666,16 +1855,7 @@ namespace PseudoRandomNumberGenerators
 		static constexpr auto short_lag = ShortLag;
 
 		// Set the modulus and result modulus based on the type of DataType
-		static constexpr DataType modulus_value =
-			std::is_same_v<DataType, std::uint64_t>
-			? (std::uint64_t(1) << 64) - 2
-			: std::is_same_v<DataType, std::uint32_t>
-			? (std::uint32_t(1) << 32) - 2
-			: std::is_same_v<DataType, std::uint16_t>
-			? (std::uint16_t(1) << 16) - 2
-			: std::is_same_v<DataType, std::uint8_t>
-			? (std::uint8_t(1) << 8) - 2
-			: 0;
+		static constexpr DataType modulus_value = std::numeric_limits<DataType>::max() - 1;
 
 		static constexpr DataType result_modulus_value =
 			std::is_same_v<DataType, std::uint64_t>
@@ -718,14 +1898,14 @@ namespace PseudoRandomNumberGenerators
 		{
 			if constexpr (std::numeric_limits<DataType>::digits > 32)
 			{
-				std::linear_congruential_engine<std::uint64_t, 6364136223846793005ULL, 1442695040888963407ULL, (1ULL << 64) - 1> LCG(Seed);
+				std::linear_congruential_engine<std::uint64_t, 6364136223846793005ULL, 1442695040888963407ULL, std::numeric_limits<std::uint64_t>::max()> LCG(Seed);
 
 				for (std::size_t Index = 0; Index < long_lag; ++Index)
 					this->StateSequence[Index] = static_cast<DataType>( LCG() );
 			}
 			else
 			{
-				std::linear_congruential_engine<std::uint32_t, 134775813UL, 1UL, (1UL << 32) - 1> LCG(Seed);
+				std::linear_congruential_engine<std::uint32_t, 134775813UL, 1UL, std::numeric_limits<std::uint32_t>::max()> LCG(Seed);
 				
 				for (std::size_t Index = 0; Index < long_lag; ++Index)
 					this->StateSequence[Index] = static_cast<DataType>(LCG());
@@ -765,16 +1945,7 @@ namespace PseudoRandomNumberGenerators
 		static constexpr auto short_lag = ShortLag;
 
 		// Set the modulus and result modulus based on the type of DataType
-		static constexpr DataType modulus_value =
-			std::is_same_v<DataType, std::uint64_t>
-			? (std::uint64_t(1) << 64) - 2
-			: std::is_same_v<DataType, std::uint32_t>
-			? (std::uint32_t(1) << 32) - 2
-			: std::is_same_v<DataType, std::uint16_t>
-			? (std::uint16_t(1) << 16) - 2
-			: std::is_same_v<DataType, std::uint8_t>
-			? (std::uint8_t(1) << 8) - 2
-			: 0;
+		static constexpr DataType modulus_value = std::numeric_limits<DataType>::max() - 1;
 
 		static constexpr DataType result_modulus_value =
 			std::is_same_v<DataType, std::uint64_t>
@@ -817,14 +1988,14 @@ namespace PseudoRandomNumberGenerators
 		{
 			if constexpr (std::numeric_limits<DataType>::digits > 32)
 			{
-				std::linear_congruential_engine<std::uint64_t, 6364136223846793005ULL, 1442695040888963407ULL, (1ULL << 64) - 1> LCG(Seed);
+				std::linear_congruential_engine<std::uint64_t, 6364136223846793005ULL, 1442695040888963407ULL, std::numeric_limits<std::uint64_t>::max()> LCG(Seed);
 
 				for (std::size_t Index = 0; Index < long_lag; ++Index)
 					this->StateSequence[Index] = static_cast<DataType>(LCG());
 			}
 			else
 			{
-				std::linear_congruential_engine<std::uint32_t, 134775813UL, 1UL, (1UL << 32) - 1> LCG(Seed);
+				std::linear_congruential_engine<std::uint32_t, 134775813UL, 1UL, std::numeric_limits<std::uint32_t>::max()> LCG(Seed);
 
 				for (std::size_t Index = 0; Index < long_lag; ++Index)
 					this->StateSequence[Index] = static_cast<DataType>(LCG());
@@ -849,75 +2020,597 @@ namespace PseudoRandomNumberGenerators
 	};
 
 	/*
-		golden ratio is 0x9e3779b97f4a7c13 with 64 bit number
+		Block-mode lagged-Fibonacci generators with carry, the recurrences of Marsaglia and Zaman taken modulo b = 2^w (w = the bits of DataType):
+			AdditionWithCarry:  x(n) = x(n - ShortLag) + x(n - LongLag) + c
+			SubtractWithBorrow: x(n) = x(n - LongLag) - x(n - ShortLag) - c   (Method II, the operand order of SubtractWithBorrow above)
+			SubtractWithCarry:  x(n) = x(n - ShortLag) - x(n - LongLag) - c   (Method I, the same sequence as std::subtract_with_carry_engine<DataType, w, ShortLag, LongLag>)
+		where c is the carry (or borrow) out of the previous step.
+		StateSequence always holds the last LongLag outputs, oldest first, so a refill writes the next LongLag outputs over it in two straight loops with fixed indices:
+		the first ShortLag outputs read x(n - ShortLag) from the end of the previous block, the rest read it from earlier in the new block.
+		Per output there is no %, no index wrap and no branch; the carry is 0 or 1 and is added or subtracted as a number,
+		through a wider type for 8/16/32-bit words and through two unsigned comparisons for 64-bit words.
+		The carry makes each output depend on the one before, so the loop is a branch-free add/subtract-with-carry chain rather than SIMD.
+		带进位的块模式滞后斐波那契生成器, 即 Marsaglia 与 Zaman 的递推, 取模 b = 2^w (w 为 DataType 的位数):
+			AdditionWithCarry:  x(n) = x(n - ShortLag) + x(n - LongLag) + c
+			SubtractWithBorrow: x(n) = x(n - LongLag) - x(n - ShortLag) - c   (方法 II, 与上面 SubtractWithBorrow 的操作数顺序相同)
+			SubtractWithCarry:  x(n) = x(n - ShortLag) - x(n - LongLag) - c   (方法 I, 与 std::subtract_with_carry_engine<DataType, w, ShortLag, LongLag> 的序列相同)
+		其中 c 是上一步的进位 (或借位)。
+		StateSequence 始终保存最近的 LongLag 个输出 (最旧的在前), 所以一次补充用两个下标固定的直线循环, 把接下来的 LongLag 个输出写在它上面:
+		前 ShortLag 个输出从上一块的末尾读取 x(n - ShortLag), 其余的从新块中更早的位置读取。
+		每个输出都没有 %, 没有下标回绕, 也没有分支; 进位为 0 或 1, 直接作为数值加上或减去,
+		8/16/32 位字借助更宽的类型, 64 位字借助两次无符号比较。
+		进位使每个输出依赖前一个输出, 所以该循环是无分支的带进位加减链, 而不是 SIMD。
 	*/
+	enum class LaggedFibonacciOperation
+	{
+		AdditionWithCarry,
+		SubtractWithBorrow,
+		SubtractWithCarry
+	};
 
-	// An implementation of xorshiro (https://vigna.di.unimi.it/xorshift/)
-	// wrapped to fit the C++11 RandomNumberGenerator requirements.
-	// This allows us to use it with all the other facilities in <random>.
-	//
-	// Credits go to David Blackman and Sebastiano Vigna.
-	//
-	// TODO: make generic? (parameterise scrambler/width/hyperparameters/etc.)
-	// Not as easy to do nicely as it might sound,
-	// and this as it is is good enough for my purposes.
-
-	struct xorshiro128 : UniformRandomBitGenerator<std::uint64_t>
+	template<std::unsigned_integral DataType, std::size_t ShortLag, std::size_t LongLag, LaggedFibonacciOperation Operation>
+	class LaggedFibonacciBlock : public UniformRandomBitGenerator<DataType>
 	{
-		static constexpr std::uint32_t num_state_words = 2;
-		using state_type = std::array<std::uint64_t, num_state_words>;
+		static_assert(ShortLag > 0U, "");
+		static_assert(LongLag > ShortLag, "");
 
-		// cannot initialize with an all-zero state
-		constexpr xorshiro128() noexcept
-			: state { 12, 34 }
-		{
-		}
+	public:
+		using result_type = DataType;
 
-		// using SplitMix64 generator to initialize the state;
-		// using a different generator helps prevent seed correlation
-		explicit constexpr xorshiro128( result_type seed ) noexcept
+		static constexpr auto long_lag = LongLag;
+		static constexpr auto short_lag = ShortLag;
+		static constexpr int word_size = std::numeric_limits<DataType>::digits;
+
+		//Twice the width for 8/16-bit words is still 32-bit arithmetic after promotion, so those use 32 bits and 32-bit words use 64
+		//8/16 位字即使用两倍宽度, 整数提升后也还是 32 位运算, 所以它们使用 32 位, 32 位字使用 64 位
+		using WideType = std::conditional_t<(word_size <= 16), std::uint32_t, std::uint64_t>;
+
+		//Value + Other + Carry, Carry becomes the carry out
+		//Value + Other + Carry, Carry 变为进位输出
+		static constexpr DataType AddWithCarry(DataType Value, DataType Other, DataType& Carry)
 		{
-			auto splitmix64 = [ seed_value = seed ]() mutable {
-				auto z = ( seed_value += 0x9e3779b97f4a7c15 );
-				z = ( z ^ ( z >> 30 ) ) * 0xbf58476d1ce4e5b9;
-				z = ( z ^ ( z >> 27 ) ) * 0x94d049bb133111eb;
-				return z ^ ( z >> 31 );
-			};
-			std::ranges::generate( state, splitmix64 );
+			if constexpr (word_size < 64)
+			{
+				const WideType Sum = WideType(Value) + Other + Carry;
+				Carry = static_cast<DataType>(Sum >> word_size);
+				return static_cast<DataType>(Sum);
+			}
+			else
+			{
+				const DataType Sum = Value + Other;
+				const DataType Result = Sum + Carry;
+				Carry = static_cast<DataType>(Sum < Value) | static_cast<DataType>(Result < Sum);
+				return Result;
+			}
 		}
 
-		explicit xorshiro128( std::initializer_list<result_type> initializer_list_args )
+		//Value - Other - Borrow, Borrow becomes the borrow out
+		//Value - Other - Borrow, Borrow 变为借位输出
+		static constexpr DataType SubtractWithBorrow(DataType Value, DataType Other, DataType& Borrow)
 		{
-			*this = xorshiro128(initializer_list_args.begin(), initializer_list_args.end());
+			if constexpr (word_size < 64)
+			{
+				const WideType Difference = WideType(Value) - Other - Borrow;
+				Borrow = static_cast<DataType>(Difference >> (std::numeric_limits<WideType>::digits - 1));
+				return static_cast<DataType>(Difference);
+			}
+			else
+			{
+				const DataType Difference = Value - Other;
+				const DataType Result = Difference - Borrow;
+				Borrow = static_cast<DataType>(Value < Other) | static_cast<DataType>(Difference < Borrow);
+				return Result;
+			}
 		}
 
-		template <std::input_or_output_iterator SeedDataIteratorType>
-		requires
-		( 
-			not std::convertible_to<SeedDataIteratorType, result_type>
-		)
-		explicit xorshiro128( SeedDataIteratorType&& begin, SeedDataIteratorType&& end )
+		static constexpr DataType Step(DataType ShortLagged, DataType LongLagged, DataType& Carry)
 		{
-			std::vector<result_type> seed_vector { begin, end };
-			this->generate_number_state_seeds( seed_vector );
-			seed_vector.clear();
-			seed_vector.shrink_to_fit();
+			if constexpr (Operation == LaggedFibonacciOperation::AdditionWithCarry)
+				return AddWithCarry(ShortLagged, LongLagged, Carry);
+			else if constexpr (Operation == LaggedFibonacciOperation::SubtractWithBorrow)
+				return SubtractWithBorrow(LongLagged, ShortLagged, Carry);
+			else
+				return SubtractWithBorrow(ShortLagged, LongLagged, Carry);
 		}
 
-		explicit xorshiro128( std::span<const result_type> seed_span )
+		//Seeded like the classes above: LongLag words from the same linear congruential generator, then the first LongLag outputs are dropped
+		//与上面的类相同的播种: 用同一个线性同余生成器产生 LongLag 个字, 然后丢弃最初的 LongLag 个输出
+		explicit LaggedFibonacciBlock(DataType Seed = 123456U)
 		{
-			this->generate_number_state_seeds( seed_span );
+			this->seed(Seed);
 		}
 
-		explicit xorshiro128( std::seed_seq& s_q )
+		//Starts after the given outputs, oldest first, and carry (the order the standard gives the text state of std::subtract_with_carry_engine)
+		//从给定的输出 (最旧的在前) 与进位之后开始 (标准规定的 std::subtract_with_carry_engine 文本状态也是这个顺序)
+		LaggedFibonacciBlock(std::span<const DataType, LongLag> PreviousOutputs, DataType Carry)
 		{
-			this->generate_number_state_seeds(s_q);
+			std::ranges::copy(PreviousOutputs, this->StateSequence.begin());
+			this->StateCarryValue = Carry & 1U;
+			this->Position = LongLag;
 		}
 
-		constexpr void seed() noexcept
+		LaggedFibonacciBlock(const LaggedFibonacciBlock&) = default;
+		LaggedFibonacciBlock& operator=(const LaggedFibonacciBlock&) = default;
+
+		~LaggedFibonacciBlock()
+		{
+			memory_set_no_optimize_function<0x00>(StateSequence.data(), sizeof(DataType) * StateSequence.size());
+			this->StateCarryValue = 0;
+			this->Position = 0;
+		}
+
+		void seed(DataType Seed = 123456U)
+		{
+			if constexpr (word_size > 32)
+			{
+				std::linear_congruential_engine<std::uint64_t, 6364136223846793005ULL, 1442695040888963407ULL, std::numeric_limits<std::uint64_t>::max()> LCG(Seed);
+
+				for (std::size_t Index = 0; Index < long_lag; ++Index)
+					this->StateSequence[Index] = static_cast<DataType>(LCG());
+			}
+			else
+			{
+				std::linear_congruential_engine<std::uint32_t, 134775813UL, 1UL, std::numeric_limits<std::uint32_t>::max()> LCG(Seed);
+
+				for (std::size_t Index = 0; Index < long_lag; ++Index)
+					this->StateSequence[Index] = static_cast<DataType>(LCG());
+			}
+			this->StateCarryValue = 0;
+
+			//Discard the pseudo-random numbers generated by the long_lag round
+			this->Refill();
+			this->Position = LongLag;
+		}
+
+		result_type operator()()
+		{
+			if (this->Position == LongLag)
+				this->Refill();
+			return this->StateSequence[this->Position++];
+		}
+
+		void fill(std::span<result_type> Values)
+		{
+			std::size_t Index = std::min(Values.size(), LongLag - this->Position);
+			std::copy_n(this->StateSequence.begin() + this->Position, Index, Values.begin());
+			this->Position += Index;
+			for (; Index < Values.size(); Index += LongLag)
+			{
+				this->Refill();
+				this->Position = std::min(Values.size() - Index, LongLag);
+				std::copy_n(this->StateSequence.begin(), this->Position, Values.begin() + Index);
+			}
+		}
+
+		void discard(unsigned long long Count)
+		{
+			const std::size_t Buffered = LongLag - this->Position;
+			if (Count <= Buffered)
+			{
+				this->Position += Count;
+				return;
+			}
+			Count -= Buffered;
+			for (; Count > LongLag; Count -= LongLag)
+				this->Refill();
+			this->Refill();
+			this->Position = Count;
+		}
+
+		bool operator==(const LaggedFibonacciBlock& Other) const
+		{
+			//Compared as the position in the sequence, not the buffer layout
+			//按序列中的位置比较, 而不是缓冲区的布局
+			return this->StateSequence == Other.StateSequence && this->StateCarryValue == Other.StateCarryValue && this->Position == Other.Position;
+		}
+
+	private:
+		std::array<DataType, LongLag> StateSequence {};
+		DataType StateCarryValue = 0;
+		std::size_t Position = LongLag;
+
+		void Refill()
+		{
+			DataType Carry = this->StateCarryValue;
+			for (std::size_t Index = 0; Index < ShortLag; ++Index)
+				this->StateSequence[Index] = Step(this->StateSequence[Index + (LongLag - ShortLag)], this->StateSequence[Index], Carry);
+			for (std::size_t Index = ShortLag; Index < LongLag; ++Index)
+				this->StateSequence[Index] = Step(this->StateSequence[Index - ShortLag], this->StateSequence[Index], Carry);
+			this->StateCarryValue = Carry;
+			this->Position = 0;
+		}
+	};
+
+	template<std::unsigned_integral DataType, std::size_t ShortLag, std::size_t LongLag>
+	using AdditionWithCarryBlock = LaggedFibonacciBlock<DataType, ShortLag, LongLag, LaggedFibonacciOperation::AdditionWithCarry>;
+	template<std::unsigned_integral DataType, std::size_t ShortLag, std::size_t LongLag>
+	using SubtractWithBorrowBlock = LaggedFibonacciBlock<DataType, ShortLag, LongLag, LaggedFibonacciOperation::SubtractWithBorrow>;
+	template<std::unsigned_integral DataType, std::size_t ShortLag, std::size_t LongLag>
+	using SubtractWithCarryBlock = LaggedFibonacciBlock<DataType, ShortLag, LongLag, LaggedFibonacciOperation::SubtractWithCarry>;
+
+	/*
+		GF(2) jump-ahead of the xorshiro engines below, the same idea as MersenneTwisterJump at a much smaller degree.
+		The state update G of an n-bit xorshiro engine (n = 64 * num_state_words) is linear over GF(2), so G^D equals p(G) for p(t) = t^D mod the characteristic polynomial of G, which has degree n;
+		the jump_polynomial / long_jump_polynomial tables of the engines are such p for their fixed distances.
+		Evaluating p(G) by Horner's rule still takes n steps and up to n state additions per jump, so a distance that is used many times is turned once into the n x n bit matrix p(G).
+		The matrix is kept as 16 precomputed images for every 4 bits of the state, so one jump is n / 4 state-sized XORs with no data dependent branches.
+		The images live in a fixed-size array inside the matrix, so building the matrices of jump() and long_jump() on first use allocates nothing and those stay noexcept.
+		The engines use it for jump(), long_jump() and jump_power_of_two(k); jump(steps) for an arbitrary count computes t^steps by repeated squaring and applies it by Horner's rule.
+		xorshiro 引擎的 GF(2) 跳跃, 与 MersenneTwisterJump 思路相同, 只是次数小得多。
+		n 位 xorshiro 引擎 (n = 64 * num_state_words) 的状态更新 G 在 GF(2) 上是线性的, 所以 G^D 等于 p(G), 其中 p(t) = t^D 模 G 的特征多项式 (次数为 n);
+		引擎中的 jump_polynomial / long_jump_polynomial 表就是各自固定距离的这个 p。
+		用 Horner 法则求 p(G) 每次跳跃仍要 n 步和最多 n 次状态加法, 所以反复使用的距离会一次性变成 n x n 的位矩阵 p(G)。
+		矩阵按状态的每 4 位保存 16 个预计算的像, 一次跳跃只是 n / 4 次状态大小的异或, 没有依赖数据的分支。
+		这些像保存在矩阵内的定长数组中, 因此首次使用时构建 jump() 与 long_jump() 的矩阵不分配内存, 它们仍是 noexcept。
+		引擎的 jump(), long_jump() 与 jump_power_of_two(k) 使用矩阵; 任意步数的 jump(steps) 用反复平方求出 t^steps, 再用 Horner 法则作用。
+	*/
+	namespace XorshiroJump
+	{
+		//Coefficients of t^0 .. t^(64 * StateWords - 1), least significant word first; a characteristic polynomial is stored without its leading t^(64 * StateWords)
+		//t^0 .. t^(64 * StateWords - 1) 的系数, 低位字在前; 特征多项式存放时省略最高项 t^(64 * StateWords)
+		template<std::size_t StateWords>
+		using Polynomial = std::array<std::uint64_t, StateWords>;
+
+		//The 32 bits of Value moved to the even bit positions, which squares a polynomial over GF(2)
+		//把 Value 的 32 位移到偶数位上, 即 GF(2) 上多项式的平方
+		constexpr std::uint64_t SpreadBits(std::uint32_t Value)
+		{
+			std::uint64_t Result = Value;
+			Result = (Result | (Result << 16)) & 0x0000FFFF0000FFFFULL;
+			Result = (Result | (Result << 8)) & 0x00FF00FF00FF00FFULL;
+			Result = (Result | (Result << 4)) & 0x0F0F0F0F0F0F0F0FULL;
+			Result = (Result | (Result << 2)) & 0x3333333333333333ULL;
+			Result = (Result | (Result << 1)) & 0x5555555555555555ULL;
+			return Result;
+		}
+
+		//Arithmetic modulo a characteristic polynomial of degree 64 * StateWords
+		//模一个 64 * StateWords 次特征多项式的运算
+		template<std::size_t StateWords>
+		class PolynomialModulus
+		{
+		public:
+			explicit PolynomialModulus(const Polynomial<StateWords>& CharacteristicPolynomial)
+				: LowCoefficients(CharacteristicPolynomial), FoldTable(256)
+			{
+				//FoldTable[Value] = Value(t) * t^Degree mod the characteristic polynomial, so a squared polynomial is reduced one byte at a time
+				//FoldTable[Value] = Value(t) * t^Degree 模特征多项式, 平方后的多项式因此可以逐字节约化
+				std::array<Polynomial<StateWords>, 8> Powers {};
+				Powers[0] = LowCoefficients;
+				for (std::size_t Bit = 1; Bit < 8; ++Bit)
+					Powers[Bit] = this->MultiplyByT(Powers[Bit - 1]);
+				for (std::size_t Value = 1; Value < 256; ++Value)
+					FoldTable[Value] = Add(FoldTable[Value & (Value - 1)], Powers[std::countr_zero(Value)]);
+			}
+
+			Polynomial<StateWords> MultiplyByT(Polynomial<StateWords> Value) const
+			{
+				const bool IsOverflowed = (Value[StateWords - 1] >> 63) != 0;
+				for (std::size_t Word = StateWords - 1; Word > 0; --Word)
+					Value[Word] = (Value[Word] << 1) | (Value[Word - 1] >> 63);
+				Value[0] <<= 1;
+				return IsOverflowed ? Add(Value, LowCoefficients) : Value;
+			}
+
+			Polynomial<StateWords> Square(const Polynomial<StateWords>& Value) const
+			{
+				std::array<std::uint64_t, 2 * StateWords> Product {};
+				for (std::size_t Word = 0; Word < StateWords; ++Word)
+				{
+					Product[2 * Word] = SpreadBits(static_cast<std::uint32_t>(Value[Word]));
+					Product[2 * Word + 1] = SpreadBits(static_cast<std::uint32_t>(Value[Word] >> 32));
+				}
+
+				//Fold the upper half from its top byte down; the byte at t^(Degree + 8 * Byte) adds FoldTable[byte] * t^(8 * Byte), which only reaches lower bytes.
+				//The word being folded stays in a register, so the chain from one byte to the next does not go through memory
+				//从最高字节向下折叠上半部分; t^(Degree + 8 * Byte) 处的字节加上 FoldTable[字节] * t^(8 * Byte), 只会影响更低的字节。
+				//正在折叠的字保存在寄存器中, 因此字节之间的依赖链不经过内存
+				for (std::size_t Word = StateWords; Word-- > 0;)
+				{
+					std::uint64_t Folding = Product[StateWords + Word];
+					for (std::size_t BitShift = 56; BitShift > 0; BitShift -= 8)
+					{
+						const auto& Fold = FoldTable[(Folding >> BitShift) & 0xFF];
+						Product[Word] ^= Fold[0] << BitShift;
+						for (std::size_t Index = 1; Index < StateWords; ++Index)
+							Product[Word + Index] ^= (Fold[Index] << BitShift) | (Fold[Index - 1] >> (64 - BitShift));
+						Folding ^= Fold[StateWords - 1] >> (64 - BitShift);
+					}
+					const auto& Fold = FoldTable[Folding & 0xFF];
+					for (std::size_t Index = 0; Index < StateWords; ++Index)
+						Product[Word + Index] ^= Fold[Index];
+				}
+
+				Polynomial<StateWords> Result {};
+				std::copy_n(Product.begin(), StateWords, Result.begin());
+				return Result;
+			}
+
+			//t^Exponent, left-to-right square-and-multiply
+			//t^Exponent, 从高位到低位的平方-乘法
+			Polynomial<StateWords> PowerOfT(std::uint64_t Exponent) const
+			{
+				Polynomial<StateWords> Result {};
+				Result[0] = 1;
+				for (int Bit = std::bit_width(Exponent) - 1; Bit >= 0; --Bit)
+				{
+					Result = this->Square(Result);
+					if ((Exponent >> Bit) & 1)
+						Result = this->MultiplyByT(Result);
+				}
+				return Result;
+			}
+
+			//t^(2^PowerOfTwo), PowerOfTwo squarings of t
+			//t^(2^PowerOfTwo), 对 t 平方 PowerOfTwo 次
+			Polynomial<StateWords> PowerOfTwoOfT(std::uint32_t PowerOfTwo) const
+			{
+				Polynomial<StateWords> Result {};
+				Result[0] = 2;
+				for (std::uint32_t Round = 0; Round < PowerOfTwo; ++Round)
+					Result = this->Square(Result);
+				return Result;
+			}
+
+		private:
+			static Polynomial<StateWords> Add(Polynomial<StateWords> Left, const Polynomial<StateWords>& Right)
+			{
+				for (std::size_t Word = 0; Word < StateWords; ++Word)
+					Left[Word] ^= Right[Word];
+				return Left;
+			}
+
+			Polynomial<StateWords> LowCoefficients;
+			std::vector<Polynomial<StateWords>> FoldTable;
+		};
+
+		//Engine becomes p(G) applied to its state, by Horner's rule over the coefficients (the original loop of Vigna's jump functions)
+		//用对系数的 Horner 法则把 p(G) 作用到 Engine 的状态上 (即 Vigna 跳跃函数原来的循环)
+		template<typename Engine>
+		constexpr void ApplyPolynomial(Engine& Generator, const Polynomial<Engine::num_state_words>& JumpPolynomial) noexcept
+		{
+			typename Engine::state_type Sum {};
+			for (std::size_t Word = 0; Word < Engine::num_state_words; ++Word)
+			{
+				for (std::size_t Bit = 0; Bit < 64; ++Bit)
+				{
+					if ((JumpPolynomial[Word] >> Bit) & 1)
+					{
+						const auto State = Generator.get_state();
+						for (std::size_t Index = 0; Index < Engine::num_state_words; ++Index)
+							Sum[Index] ^= State[Index];
+					}
+					Generator();
+				}
+			}
+			Generator.set_state(Sum);
+		}
+
+		//The bit matrix p(G): Table[16 * Group + Value] is p(G) applied to the state whose only nonzero bits are Value at bits 4 * Group .. 4 * Group + 3
+		//位矩阵 p(G): Table[16 * Group + Value] 是 p(G) 作用在仅第 4 * Group .. 4 * Group + 3 位为 Value 的状态上的结果
+		template<std::size_t StateWords>
+		class JumpMatrix
+		{
+		public:
+			using StateType = std::array<std::uint64_t, StateWords>;
+
+			//One Horner evaluation per state bit, n^2 engine steps in all; built in place, the table is too large to be returned by value on every stack
+			//每个状态位一次 Horner 求值, 总共 n^2 步; 就地构建, 表太大, 不宜在栈上按值返回
+			template<typename Engine>
+			JumpMatrix(std::type_identity<Engine>, const Polynomial<StateWords>& JumpPolynomial) noexcept
+			{
+				static_assert(Engine::num_state_words == StateWords);
+
+				for (std::size_t Group = 0; Group < StateWords * 16; ++Group)
+				{
+					StateType* Images = this->Table.data() + Group * 16;
+					for (std::size_t Bit = 0; Bit < 4; ++Bit)
+					{
+						StateType UnitState {};
+						UnitState[Group / 16] = std::uint64_t(1) << (Group % 16 * 4 + Bit);
+
+						Engine Generator;
+						Generator.set_state(UnitState);
+						ApplyPolynomial(Generator, JumpPolynomial);
+						Images[std::size_t(1) << Bit] = Generator.get_state();
+					}
+					for (std::size_t Value = 3; Value < 16; ++Value)
+					{
+						if (std::has_single_bit(Value))
+							continue;
+						for (std::size_t Word = 0; Word < StateWords; ++Word)
+							Images[Value][Word] = Images[Value & (Value - 1)][Word] ^ Images[Value & (0 - Value)][Word];
+					}
+				}
+			}
+
+			void Apply(StateType& State) const
+			{
+				StateType Result {};
+				const StateType* Images = this->Table.data();
+				for (std::size_t Word = 0; Word < StateWords; ++Word)
+				{
+					std::uint64_t Bits = State[Word];
+					for (std::size_t Group = 0; Group < 16; ++Group, Images += 16, Bits >>= 4)
+					{
+						const StateType& Image = Images[Bits & 15];
+						for (std::size_t Index = 0; Index < StateWords; ++Index)
+							Result[Index] ^= Image[Index];
+					}
+				}
+				State = Result;
+			}
+
+			template<typename Engine>
+			void Apply(Engine& Generator) const
+			{
+				StateType State = Generator.get_state();
+				this->Apply(State);
+				Generator.set_state(State);
+			}
+
+		private:
+			//Images[0] of every group stays the zero state
+			//每组的 Images[0] 保持为零状态
+			std::array<StateType, StateWords * 16 * 16> Table {};
+		};
+
+		//The matrix of a fixed jump polynomial (an engine's jump_polynomial or long_jump_polynomial), built on first use
+		//固定跳跃多项式 (引擎的 jump_polynomial 或 long_jump_polynomial) 的矩阵, 首次使用时构建
+		template<typename Engine, const auto& JumpPolynomial>
+		const JumpMatrix<Engine::num_state_words>& FixedJumpMatrix() noexcept
+		{
+			static const JumpMatrix<Engine::num_state_words> Matrix(std::type_identity<Engine> {}, JumpPolynomial);
+			return Matrix;
+		}
+
+		//Constant evaluation cannot keep the matrix, so it falls back to Horner's rule
+		//常量求值无法保存矩阵, 所以退回到 Horner 法则
+		template<const auto& JumpPolynomial, typename Engine>
+		constexpr void FixedJump(Engine& Generator) noexcept
+		{
+			if (std::is_constant_evaluated())
+				ApplyPolynomial(Generator, JumpPolynomial);
+			else
+				FixedJumpMatrix<Engine, JumpPolynomial>().Apply(Generator);
+		}
+
+		//The matrix of t^(2^PowerOfTwo), built once per engine type and PowerOfTwo
+		//t^(2^PowerOfTwo) 的矩阵, 每种引擎与每个 PowerOfTwo 只构建一次
+		template<typename Engine>
+		const JumpMatrix<Engine::num_state_words>& PowerOfTwoJumpMatrix(std::uint32_t PowerOfTwo)
+		{
+			constexpr std::size_t StateWords = Engine::num_state_words;
+
+			//Map nodes never move, so the returned reference stays valid after the lock is released
+			//map 的节点不会移动, 所以解锁后返回的引用仍然有效
+			static std::mutex Mutex;
+			static std::map<std::uint32_t, JumpMatrix<StateWords>> Built;
+			std::scoped_lock Lock(Mutex);
+			auto Iterator = Built.find(PowerOfTwo);
+			if (Iterator == Built.end())
+			{
+				const PolynomialModulus<StateWords> Modulus(Engine::characteristic_polynomial);
+				Iterator = Built.try_emplace(PowerOfTwo, std::type_identity<Engine> {}, Modulus.PowerOfTwoOfT(PowerOfTwo)).first;
+			}
+			return Iterator->second;
+		}
+
+		//Up to this many steps, stepping is cheaper than about 64 squarings of StateWords x StateWords word operations each plus the Horner pass
+		//不超过这个步数时, 逐步推进比约 64 次平方 (每次 StateWords x StateWords 次字运算) 再加一遍 Horner 更便宜
+		template<std::size_t StateWords>
+		inline constexpr std::uint64_t MaximumSteppedCount = 256 * StateWords * StateWords;
+
+		//Same state as Steps calls of operator()
+		//与调用 Steps 次 operator() 之后的状态相同
+		template<typename Engine>
+		void JumpSteps(Engine& Generator, std::uint64_t Steps)
+		{
+			constexpr std::size_t StateWords = Engine::num_state_words;
+
+			if (Steps <= MaximumSteppedCount<StateWords>)
+			{
+				while (Steps-- > 0)
+					Generator();
+				return;
+			}
+
+			const PolynomialModulus<StateWords> Modulus(Engine::characteristic_polynomial);
+			ApplyPolynomial(Generator, Modulus.PowerOfT(Steps));
+		}
+	}
+
+	/*
+		golden ratio is 0x9e3779b97f4a7c13 with 64 bit number
+	*/
+
+	// An implementation of xorshiro (https://vigna.di.unimi.it/xorshift/)
+	// wrapped to fit the C++11 RandomNumberGenerator requirements.
+	// This allows us to use it with all the other facilities in <random>.
+	//
+	// Credits go to David Blackman and Sebastiano Vigna.
+	//
+	// TODO: make generic? (parameterise scrambler/width/hyperparameters/etc.)
+	// Not as easy to do nicely as it might sound,
+	// and this as it is is good enough for my purposes.
+
+	struct xorshiro128 : UniformRandomBitGenerator<std::uint64_t>
+	{
+		static constexpr std::uint32_t num_state_words = 2;
+		using state_type = std::array<std::uint64_t, num_state_words>;
+
+		// the jump() and long_jump() polynomials (Vigna's jump tables) and the characteristic polynomial of the state update, see XorshiroJump
+		static constexpr XorshiroJump::Polynomial<num_state_words> jump_polynomial {
+			0xdf900294d8f554a5, 0x170865df4b3201fc
+		};
+		static constexpr XorshiroJump::Polynomial<num_state_words> long_jump_polynomial {
+			0xd2a98b26625eee7b, 0xdddf9b1090aa7ac1
+		};
+		static constexpr XorshiroJump::Polynomial<num_state_words> characteristic_polynomial {
+			0x095b8f76579aa001, 0x0008828e513b43d5
+		};
+
+		// cannot initialize with an all-zero state
+		constexpr xorshiro128() noexcept
+			: state { 12, 34 }
+		{
+		}
+
+		// using SplitMix64 generator to initialize the state;
+		// using a different generator helps prevent seed correlation
+		explicit constexpr xorshiro128( result_type seed ) noexcept
+		{
+			auto splitmix64 = [ seed_value = seed ]() mutable {
+				auto z = ( seed_value += 0x9e3779b97f4a7c15 );
+				z = ( z ^ ( z >> 30 ) ) * 0xbf58476d1ce4e5b9;
+				z = ( z ^ ( z >> 27 ) ) * 0x94d049bb133111eb;
+				return z ^ ( z >> 31 );
+			};
+			std::ranges::generate( state, splitmix64 );
+		}
+
+		explicit xorshiro128( std::initializer_list<result_type> initializer_list_args )
+		{
+			*this = xorshiro128(initializer_list_args.begin(), initializer_list_args.end());
+		}
+
+		template <std::input_or_output_iterator SeedDataIteratorType>
+		requires
+		( 
+			not std::convertible_to<SeedDataIteratorType, result_type>
+		)
+		explicit xorshiro128( SeedDataIteratorType&& begin, SeedDataIteratorType&& end )
+		{
+			std::vector<result_type> seed_vector { begin, end };
+			this->generate_number_state_seeds( seed_vector );
+			seed_vector.clear();
+			seed_vector.shrink_to_fit();
+		}
+
+		explicit xorshiro128( std::span<const result_type> seed_span )
+		{
+			this->generate_number_state_seeds( seed_span );
+		}
+
+		explicit xorshiro128( std::seed_seq& s_q )
+		{
+			this->generate_number_state_seeds(s_q);
+		}
+
+		constexpr void seed() noexcept
 		{
 			*this = xorshiro128();
 		}
+
+		// the raw state words, e.g. for the jump matrices of XorshiroJump
+		constexpr const state_type& get_state() const noexcept
+		{
+			return state;
+		}
+		constexpr void set_state( const state_type& new_state ) noexcept
+		{
+			state = new_state;
+		}
 		constexpr void seed( result_type s ) noexcept
 		{
 			*this = xorshiro128( s );
@@ -981,26 +2674,7 @@ namespace PseudoRandomNumberGenerators
 		*/
 		constexpr void jump() noexcept
 		{
-			constexpr std::uint64_t jump_table[] = {
-				0xdf900294d8f554a5, 0x170865df4b3201fc
-			};
-
-			state_type temporary_state {};
-			for ( std::uint32_t jump_table_index = 0; jump_table_index < std::ssize( jump_table ); jump_table_index++ )
-			{
-				for ( std::uint32_t b = 0; b < 64; b++ )
-				{
-					if ( jump_table[ jump_table_index ] & ( static_cast<std::uint64_t>( 1 ) << b ) )
-					{
-						temporary_state[ 0 ] ^= state[ 0 ];
-						temporary_state[ 1 ] ^= state[ 1 ];
-					}
-					operator()();
-				}
-			}
-
-			temporary_state[ 0 ] = state[ 0 ];
-			temporary_state[ 1 ] = state[ 1 ];
+			XorshiroJump::FixedJump<jump_polynomial>( *this );
 		}
 
 		/*
@@ -1011,28 +2685,19 @@ namespace PseudoRandomNumberGenerators
 		*/
 		constexpr void long_jump() noexcept
 		{
-			constexpr std::uint64_t long_jump_table[] = {
-				0xd2a98b26625eee7b, 0xdddf9b1090aa7ac1
-			};
-
-			state_type temporary_state {};
-			for ( std::uint32_t long_jump_table_index = 0; long_jump_table_index < std::ssize( long_jump_table ); long_jump_table_index++ )
-			{
-				for ( std::uint32_t b = 0; b < 64; b++ )
-				{
-					if ( long_jump_table[ long_jump_table_index ] & ( static_cast<std::uint64_t>( 1 ) << b ) )
-					{
-						temporary_state[ 0 ] ^= state[ 0 ];
-						temporary_state[ 1 ] ^= state[ 1 ];
-
-					}
-					operator()();
-				}
-			}
+			XorshiroJump::FixedJump<long_jump_polynomial>( *this );
+		}
 
-			temporary_state[ 0 ] = state[ 0 ];
-			temporary_state[ 1 ] = state[ 1 ];
+		// same state as steps calls of operator()(), for any steps
+		void jump( std::uint64_t steps )
+		{
+			XorshiroJump::JumpSteps( *this, steps );
+		}
 
+		// same state as 2^power_of_two calls of operator()(); the jump matrix of each power_of_two is built once and shared by all engines of this type
+		void jump_power_of_two( std::uint32_t power_of_two )
+		{
+			XorshiroJump::PowerOfTwoJumpMatrix<xorshiro128>( power_of_two ).Apply( *this );
 		}
 
 		constexpr bool operator==( const xorshiro128& ) const noexcept = default;
@@ -1114,6 +2779,20 @@ namespace PseudoRandomNumberGenerators
 		static constexpr std::uint32_t num_state_words = 4;
 		using state_type = std::array<std::uint64_t, num_state_words>;
 
+		// the jump() and long_jump() polynomials (Vigna's jump tables) and the characteristic polynomial of the state update, see XorshiroJump
+		static constexpr XorshiroJump::Polynomial<num_state_words> jump_polynomial {
+			0x180ec6d33cfd0aba, 0xd5a61266f0c9392c,
+			0xa9582618e03fc9aa, 0x39abdc4529b1661c
+		};
+		static constexpr XorshiroJump::Polynomial<num_state_words> long_jump_polynomial {
+			0x76e15d3efefdcbbf, 0xc5004e441c522fb3,
+			0x77710069854ee241, 0x39109bb02acbe635
+		};
+		static constexpr XorshiroJump::Polynomial<num_state_words> characteristic_polynomial {
+			0x9d116f2bb0f0f001, 0x0280002bcefd1a5e,
+			0x04b4edcf26259f85, 0x0003c03c3f3ecb19
+		};
+
 		// cannot initialize with an all-zero state
 		constexpr xorshiro256() noexcept
 			: state { 12, 34 }
@@ -1165,6 +2844,16 @@ namespace PseudoRandomNumberGenerators
 		{
 			*this = xorshiro256();
 		}
+
+		// the raw state words, e.g. for running several jump()-spaced streams side by side (XorshiroLanes)
+		constexpr const state_type& get_state() const noexcept
+		{
+			return state;
+		}
+		constexpr void set_state( const state_type& new_state ) noexcept
+		{
+			state = new_state;
+		}
 		constexpr void seed( result_type s ) noexcept
 		{
 			*this = xorshiro256( s );
@@ -1214,33 +2903,7 @@ namespace PseudoRandomNumberGenerators
 		*/
 		constexpr void jump() noexcept
 		{
-			constexpr std::uint64_t jump_table[] = {
-				0x180ec6d33cfd0aba,
-				0xd5a61266f0c9392c,
-				0xa9582618e03fc9aa,
-				0x39abdc4529b1661c,
-			};
-
-			state_type temporary_state {};
-			for ( std::uint32_t jump_table_index = 0; jump_table_index < std::ssize( jump_table ); jump_table_index++ )
-			{
-				for ( std::uint32_t b = 0; b < 64; b++ )
-				{
-					if ( jump_table[ jump_table_index ] & ( static_cast<std::uint64_t>( 1 ) << b ) )
-					{
-						temporary_state[ 0 ] ^= state[ 0 ];
-						temporary_state[ 1 ] ^= state[ 1 ];
-						temporary_state[ 2 ] ^= state[ 2 ];
-						temporary_state[ 3 ] ^= state[ 3 ];
-					}
-					operator()();
-				}
-			}
-
-			state[ 0 ] = temporary_state[ 0 ];
-			state[ 1 ] = temporary_state[ 1 ];
-			state[ 2 ] = temporary_state[ 2 ];
-			state[ 3 ] = temporary_state[ 3 ];
+			XorshiroJump::FixedJump<jump_polynomial>( *this );
 		}
 
 		/*
@@ -1251,33 +2914,19 @@ namespace PseudoRandomNumberGenerators
 		*/
 		constexpr void long_jump() noexcept
 		{
-			constexpr std::uint64_t long_jump_table[] = {
-				0x76e15d3efefdcbbf,
-				0xc5004e441c522fb3,
-				0x77710069854ee241,
-				0x39109bb02acbe635,
-			};
+			XorshiroJump::FixedJump<long_jump_polynomial>( *this );
+		}
 
-			state_type temporary_state {};
-			for ( std::uint32_t long_jump_table_index = 0; long_jump_table_index < std::ssize( long_jump_table ); long_jump_table_index++ )
-			{
-				for ( std::uint32_t b = 0; b < 64; b++ )
-				{
-					if ( long_jump_table[ long_jump_table_index ] & ( static_cast<std::uint64_t>( 1 ) << b ) )
-					{
-						temporary_state[ 0 ] ^= state[ 0 ];
-						temporary_state[ 1 ] ^= state[ 1 ];
-						temporary_state[ 2 ] ^= state[ 2 ];
-						temporary_state[ 3 ] ^= state[ 3 ];
-					}
-					operator()();
-				}
-			}
+		// same state as steps calls of operator()(), for any steps
+		void jump( std::uint64_t steps )
+		{
+			XorshiroJump::JumpSteps( *this, steps );
+		}
 
-			state[ 0 ] = temporary_state[ 0 ];
-			state[ 1 ] = temporary_state[ 1 ];
-			state[ 2 ] = temporary_state[ 2 ];
-			state[ 3 ] = temporary_state[ 3 ];
+		// same state as 2^power_of_two calls of operator()(); the jump matrix of each power_of_two is built once and shared by all engines of this type
+		void jump_power_of_two( std::uint32_t power_of_two )
+		{
+			XorshiroJump::PowerOfTwoJumpMatrix<xorshiro256>( power_of_two ).Apply( *this );
 		}
 
 		constexpr bool operator==( const xorshiro256& ) const noexcept = default;
@@ -1359,6 +3008,26 @@ namespace PseudoRandomNumberGenerators
 		static constexpr std::uint32_t num_state_words = 8;
 		using state_type = std::array<std::uint64_t, num_state_words>;
 
+		// the jump() and long_jump() polynomials (Vigna's jump tables) and the characteristic polynomial of the state update, see XorshiroJump
+		static constexpr XorshiroJump::Polynomial<num_state_words> jump_polynomial {
+			0x33ed89b6e7a353f9, 0x760083d7955323be,
+			0x2837f2fbb5f22fae, 0x4b8c5674d309511c,
+			0xb11ac47a7ba28c25, 0xf1be7667092bcc1c,
+			0x53851efdb6df0aaf, 0x1ebbc8b23eaf25db
+		};
+		static constexpr XorshiroJump::Polynomial<num_state_words> long_jump_polynomial {
+			0x11467fef8f921d28, 0xa2a819f2e79c8ea8,
+			0xa8299fc284b3959a, 0xb4d347340ca63ee1,
+			0x1cb0940bedbff6ce, 0xd956c5c4fa1f8e17,
+			0x915e38fd4eda93bc, 0x5b3ccdfa5d7daca5
+		};
+		static constexpr XorshiroJump::Polynomial<num_state_words> characteristic_polynomial {
+			0xcf3cff0c00000001, 0x7fdc78d886f00c63,
+			0xf05e63fca6d7b781, 0x7a67058e7bbab6f0,
+			0xf11eef832e32518f, 0x51ba7c47edc758ad,
+			0x8f2d27268ce4b20b, 0x0000500055d8b77f
+		};
+
 		std::size_t state_position = 0;
 
 		// cannot initialize with an all-zero state
@@ -1412,6 +3081,16 @@ namespace PseudoRandomNumberGenerators
 		{
 			*this = xorshiro512();
 		}
+
+		// the raw state words, e.g. for running several jump()-spaced streams side by side (XorshiroLanes)
+		constexpr const state_type& get_state() const noexcept
+		{
+			return state;
+		}
+		constexpr void set_state( const state_type& new_state ) noexcept
+		{
+			state = new_state;
+		}
 		constexpr void seed( result_type s ) noexcept
 		{
 			*this = xorshiro512( s );
@@ -1470,41 +3149,7 @@ namespace PseudoRandomNumberGenerators
 		*/
 		constexpr void jump() noexcept
 		{
-			constexpr std::uint64_t jump_table[] = {
-				0x33ed89b6e7a353f9, 0x760083d7955323be,
-				0x2837f2fbb5f22fae, 0x4b8c5674d309511c,
-				0xb11ac47a7ba28c25, 0xf1be7667092bcc1c,
-				0x53851efdb6df0aaf, 0x1ebbc8b23eaf25db
-			};
-
-			state_type temporary_state {};
-			for ( std::uint32_t jump_table_index = 0; jump_table_index < std::ssize( jump_table ); jump_table_index++ )
-			{
-				for ( std::uint32_t b = 0; b < 64; b++ )
-				{
-					if ( jump_table[ jump_table_index ] & ( static_cast<std::uint64_t>( 1 ) << b ) )
-					{
-						temporary_state[ 0 ] ^= state[ 0 ];
-						temporary_state[ 1 ] ^= state[ 1 ];
-						temporary_state[ 2 ] ^= state[ 2 ];
-						temporary_state[ 3 ] ^= state[ 3 ];
-						temporary_state[ 4 ] ^= state[ 4 ];
-						temporary_state[ 5 ] ^= state[ 5 ];
-						temporary_state[ 6 ] ^= state[ 6 ];
-						temporary_state[ 7 ] ^= state[ 7 ];
-					}
-					operator()();
-				}
-			}
-
-			temporary_state[ 0 ] = state[ 0 ];
-			temporary_state[ 1 ] = state[ 1 ];
-			temporary_state[ 2 ] = state[ 2 ];
-			temporary_state[ 3 ] = state[ 3 ];
-			temporary_state[ 4 ] = state[ 4 ];
-			temporary_state[ 5 ] = state[ 5 ];
-			temporary_state[ 6 ] = state[ 6 ];
-			temporary_state[ 7 ] = state[ 7 ];
+			XorshiroJump::FixedJump<jump_polynomial>( *this );
 		}
 
 		/*
@@ -1515,42 +3160,19 @@ namespace PseudoRandomNumberGenerators
 		*/
 		constexpr void long_jump() noexcept
 		{
-			constexpr std::uint64_t long_jump_table[] = {
-				0x11467fef8f921d28, 0xa2a819f2e79c8ea8,
-				0xa8299fc284b3959a, 0xb4d347340ca63ee1,
-				0x1cb0940bedbff6ce, 0xd956c5c4fa1f8e17,
-				0x915e38fd4eda93bc, 0x5b3ccdfa5d7daca5
-			};
-
-			state_type temporary_state {};
-			for ( std::uint32_t long_jump_table_index = 0; long_jump_table_index < std::ssize( long_jump_table ); long_jump_table_index++ )
-			{
-				for ( std::uint32_t b = 0; b < 64; b++ )
-				{
-					if ( long_jump_table[ long_jump_table_index ] & ( static_cast<std::uint64_t>( 1 ) << b ) )
-					{
-						temporary_state[ 0 ] ^= state[ 0 ];
-						temporary_state[ 1 ] ^= state[ 1 ];
-						temporary_state[ 2 ] ^= state[ 2 ];
-						temporary_state[ 3 ] ^= state[ 3 ];
-						temporary_state[ 4 ] ^= state[ 4 ];
-						temporary_state[ 5 ] ^= state[ 5 ];
-						temporary_state[ 6 ] ^= state[ 6 ];
-						temporary_state[ 7 ] ^= state[ 7 ];
+			XorshiroJump::FixedJump<long_jump_polynomial>( *this );
+		}
 
-					}
-					operator()();
-				}
-			}
+		// same state as steps calls of operator()(), for any steps
+		void jump( std::uint64_t steps )
+		{
+			XorshiroJump::JumpSteps( *this, steps );
+		}
 
-			temporary_state[ 0 ] = state[ 0 ];
-			temporary_state[ 1 ] = state[ 1 ];
-			temporary_state[ 2 ] = state[ 2 ];
-			temporary_state[ 3 ] = state[ 3 ];
-			temporary_state[ 4 ] = state[ 4 ];
-			temporary_state[ 5 ] = state[ 5 ];
-			temporary_state[ 6 ] = state[ 6 ];
-			temporary_state[ 7 ] = state[ 7 ];
+		// same state as 2^power_of_two calls of operator()(); the jump matrix of each power_of_two is built once and shared by all engines of this type
+		void jump_power_of_two( std::uint32_t power_of_two )
+		{
+			XorshiroJump::PowerOfTwoJumpMatrix<xorshiro512>( power_of_two ).Apply( *this );
 		}
 
 	private:
@@ -1605,6 +3227,38 @@ namespace PseudoRandomNumberGenerators
 		static constexpr std::uint32_t num_state_words = 16;
 		using state_type = std::array<std::uint64_t, num_state_words>;
 
+		// the jump() and long_jump() polynomials (Vigna's jump tables) and the characteristic polynomial of the state update, see XorshiroJump
+		static constexpr XorshiroJump::Polynomial<num_state_words> jump_polynomial {
+			0x931197d8e3177f17, 0xb59422e0b9138c5f,
+			0xf06a6afb49d668bb, 0xacb8a6412c8a1401,
+			0x12304ec85f0b3468, 0xb7dfe7079209891e,
+			0x405b7eec77d9eb14, 0x34ead68280c44e4a,
+			0xe0e4ba3e0ac9e366, 0x8f46eda8348905b7,
+			0x328bf4dbad90d6ff, 0xc8fd6fb31c9effc3,
+			0xe899d452d4b67652, 0x45f387286ade3205,
+			0x03864f454a8920bd, 0xa68fa28725b1b384
+		};
+		static constexpr XorshiroJump::Polynomial<num_state_words> long_jump_polynomial {
+			0x7374156360bbf00f, 0x4630c2efa3b3c1f6,
+			0x6654183a892786b1, 0x94f7bfcbfb0f1661,
+			0x27d8243d3d13eb2d, 0x9701730f3dfb300f,
+			0x2f293baae6f604ad, 0xa661831cb60cd8b6,
+			0x68280c77d9fe008c, 0x50554160f5ba9459,
+			0x2fc20b17ec7b2a9a, 0x49189bbdc8ec9f8f,
+			0x92a65bca41852cc1, 0xf46820dd0509c12a,
+			0x52b00c35fbf92185, 0x1e5b3b7f589e03c1
+		};
+		static constexpr XorshiroJump::Polynomial<num_state_words> characteristic_polynomial {
+			0x5cfeb8cc48ddb211, 0xb73e379d035a06dd,
+			0x17d5100a20a0350e, 0x7550223f68f98cac,
+			0x29d373b5c5ed3459, 0x3689b412ef70de48,
+			0xa1d3b6ee079a7cc6, 0x9bf0b669abd100f8,
+			0x955c84e105f60997, 0x6ca140c61889cddd,
+			0xabaf68c5fc3a0e4a, 0xa46134526b83adc5,
+			0x0710704d05683d63, 0x580d080b44b606a2,
+			0x008040a0580158a1, 0x0000000000800081
+		};
+
 		std::size_t state_position = 0;
 
 		// cannot initialize with an all-zero state
@@ -1658,6 +3312,21 @@ namespace PseudoRandomNumberGenerators
 		{
 			*this = xorshiro1024();
 		}
+
+		// the state words rotated to start at state_position, so that the same words always step the same way;
+		// set_state takes them in that order and restarts state_position at 0
+		constexpr state_type get_state() const noexcept
+		{
+			state_type rotated_state {};
+			for ( std::size_t index = 0; index < num_state_words; ++index )
+				rotated_state[ index ] = state[ ( index + state_position ) & 15 ];
+			return rotated_state;
+		}
+		constexpr void set_state( const state_type& new_state ) noexcept
+		{
+			state = new_state;
+			state_position = 0;
+		}
 		constexpr void seed( result_type s ) noexcept
 		{
 			*this = xorshiro1024( s );
@@ -1707,61 +3376,7 @@ namespace PseudoRandomNumberGenerators
 		*/
 		constexpr void jump() noexcept
 		{
-			constexpr std::uint64_t jump_table[] = {
-				0x931197d8e3177f17, 0xb59422e0b9138c5f,
-				0xf06a6afb49d668bb, 0xacb8a6412c8a1401,
-				0x12304ec85f0b3468, 0xb7dfe7079209891e,
-				0x405b7eec77d9eb14, 0x34ead68280c44e4a,
-				0xe0e4ba3e0ac9e366, 0x8f46eda8348905b7,
-				0x328bf4dbad90d6ff, 0xc8fd6fb31c9effc3,
-				0xe899d452d4b67652, 0x45f387286ade3205,
-				0x03864f454a8920bd, 0xa68fa28725b1b384
-			};
-
-			state_type temporary_state {};
-			for ( std::uint32_t jump_table_index = 0; jump_table_index < std::ssize( jump_table ); jump_table_index++ )
-			{
-				for ( std::uint32_t b = 0; b < 64; b++ )
-				{
-					if ( jump_table[ jump_table_index ] & ( static_cast<std::uint64_t>( 1 ) << b ) )
-					{
-						temporary_state[ 0 ] ^= state[ 0 ];
-						temporary_state[ 1 ] ^= state[ 1 ];
-						temporary_state[ 2 ] ^= state[ 2 ];
-						temporary_state[ 3 ] ^= state[ 3 ];
-						temporary_state[ 4 ] ^= state[ 4 ];
-						temporary_state[ 5 ] ^= state[ 5 ];
-						temporary_state[ 6 ] ^= state[ 6 ];
-						temporary_state[ 7 ] ^= state[ 7 ];
-						temporary_state[ 8 ] ^= state[ 8 ];
-						temporary_state[ 9 ] ^= state[ 9 ];
-						temporary_state[ 10 ] ^= state[ 10 ];
-						temporary_state[ 11 ] ^= state[ 11 ];
-						temporary_state[ 12 ] ^= state[ 12 ];
-						temporary_state[ 13 ] ^= state[ 13 ];
-						temporary_state[ 14 ] ^= state[ 14 ];
-						temporary_state[ 15 ] ^= state[ 15 ];
-					}
-					operator()();
-				}
-			}
-
-			temporary_state[ 0 ] = state[ 0 ];
-			temporary_state[ 1 ] = state[ 1 ];
-			temporary_state[ 2 ] = state[ 2 ];
-			temporary_state[ 3 ] = state[ 3 ];
-			temporary_state[ 4 ] = state[ 4 ];
-			temporary_state[ 5 ] = state[ 5 ];
-			temporary_state[ 6 ] = state[ 6 ];
-			temporary_state[ 7 ] = state[ 7 ];
-			temporary_state[ 8 ] = state[ 8 ];
-			temporary_state[ 9 ] = state[ 9 ];
-			temporary_state[ 10 ] = state[ 10 ];
-			temporary_state[ 11 ] = state[ 11 ];
-			temporary_state[ 12 ] = state[ 12 ];
-			temporary_state[ 13 ] = state[ 13 ];
-			temporary_state[ 14 ] = state[ 14 ];
-			temporary_state[ 15 ] = state[ 15 ];
+			XorshiroJump::FixedJump<jump_polynomial>( *this );
 		}
 
 		/*
@@ -1772,62 +3387,19 @@ namespace PseudoRandomNumberGenerators
 		*/
 		constexpr void long_jump() noexcept
 		{
-			constexpr std::uint64_t long_jump_table[] = {
-				0x7374156360bbf00f, 0x4630c2efa3b3c1f6,
-				0x6654183a892786b1, 0x94f7bfcbfb0f1661,
-				0x27d8243d3d13eb2d, 0x9701730f3dfb300f,
-				0x2f293baae6f604ad, 0xa661831cb60cd8b6,
-				0x68280c77d9fe008c, 0x50554160f5ba9459,
-				0x2fc20b17ec7b2a9a, 0x49189bbdc8ec9f8f,
-				0x92a65bca41852cc1, 0xf46820dd0509c12a,
-				0x52b00c35fbf92185, 0x1e5b3b7f589e03c1
-			};
-
-			state_type temporary_state {};
-			for ( std::uint32_t long_jump_table_index = 0; long_jump_table_index < std::ssize( long_jump_table ); long_jump_table_index++ )
-			{
-				for ( std::uint32_t b = 0; b < 64; b++ )
-				{
-					if ( long_jump_table[ long_jump_table_index ] & ( static_cast<std::uint64_t>( 1 ) << b ) )
-					{
-						temporary_state[ 0 ] ^= state[ 0 ];
-						temporary_state[ 1 ] ^= state[ 1 ];
-						temporary_state[ 2 ] ^= state[ 2 ];
-						temporary_state[ 3 ] ^= state[ 3 ];
-						temporary_state[ 4 ] ^= state[ 4 ];
-						temporary_state[ 5 ] ^= state[ 5 ];
-						temporary_state[ 6 ] ^= state[ 6 ];
-						temporary_state[ 7 ] ^= state[ 7 ];
-						temporary_state[ 8 ] ^= state[ 8 ];
-						temporary_state[ 9 ] ^= state[ 9 ];
-						temporary_state[ 10 ] ^= state[ 10 ];
-						temporary_state[ 11 ] ^= state[ 11 ];
-						temporary_state[ 12 ] ^= state[ 12 ];
-						temporary_state[ 13 ] ^= state[ 13 ];
-						temporary_state[ 14 ] ^= state[ 14 ];
-						temporary_state[ 15 ] ^= state[ 15 ];
+			XorshiroJump::FixedJump<long_jump_polynomial>( *this );
+		}
 
-					}
-					operator()();
-				}
-			}
+		// same state as steps calls of operator()(), for any steps
+		void jump( std::uint64_t steps )
+		{
+			XorshiroJump::JumpSteps( *this, steps );
+		}
 
-			temporary_state[ 0 ] = state[ 0 ];
-			temporary_state[ 1 ] = state[ 1 ];
-			temporary_state[ 2 ] = state[ 2 ];
-			temporary_state[ 3 ] = state[ 3 ];
-			temporary_state[ 4 ] = state[ 4 ];
-			temporary_state[ 5 ] = state[ 5 ];
-			temporary_state[ 6 ] = state[ 6 ];
-			temporary_state[ 7 ] = state[ 7 ];
-			temporary_state[ 8 ] = state[ 8 ];
-			temporary_state[ 9 ] = state[ 9 ];
-			temporary_state[ 10 ] = state[ 10 ];
-			temporary_state[ 11 ] = state[ 11 ];
-			temporary_state[ 12 ] = state[ 12 ];
-			temporary_state[ 13 ] = state[ 13 ];
-			temporary_state[ 14 ] = state[ 14 ];
-			temporary_state[ 15 ] = state[ 15 ];
+		// same state as 2^power_of_two calls of operator()(); the jump matrix of each power_of_two is built once and shared by all engines of this type
+		void jump_power_of_two( std::uint32_t power_of_two )
+		{
+			XorshiroJump::PowerOfTwoJumpMatrix<xorshiro1024>( power_of_two ).Apply( *this );
 		}
 
 	private:
@@ -1876,4 +3448,1202 @@ namespace PseudoRandomNumberGenerators
 			}
 		}
 	};
-}
\ No newline at end of file
+
+	//Function pointer table of one multi-lane xoshiro kernel (see XoshiroKernels.h), selected at runtime by CPU features
+	//一个多通道 xoshiro 内核的函数指针表 (见 XoshiroKernels.h), 运行时按 CPU 特性选择
+	template<typename ScalarEngine, std::size_t LaneCount>
+	struct XorshiroLanesKernels
+	{
+		const char* Name;
+		CommonToolkit::CPU_FeatureDispatch::CPU_FeatureSet RequiredFeatures;
+		void (*Generate)(std::uint64_t* State, std::uint64_t* Values, std::size_t Steps);
+	};
+
+	/*
+		LaneCount (4 or 8) xorshiro256 or xorshiro512 streams held side by side in SIMD registers, one output of every lane per step.
+		Lane 0 continues the engine the lanes are built from and every further lane starts one jump() after the previous one, so the lanes never overlap;
+		long_jump() moves all lanes on together, which hands whole lane sets out to other threads. fill runs the widest kernel the processor supports
+		straight into the caller's buffer, lane l of step s at Values[s * LaneCount + l]; LaneBufferedGenerator hands the values out one at a time.
+		LaneCount (4 或 8) 个 xorshiro256 或 xorshiro512 流并排放在 SIMD 寄存器中, 每步每个通道输出一个值。
+		通道 0 延续构造所用的引擎, 之后每个通道都比前一个多一次 jump(), 因此各通道互不重叠;
+		long_jump() 让所有通道一起前进, 用于把整组通道分给其他线程。fill 在处理器支持的最宽内核中运行,
+		直接写入调用者的缓冲区, 第 s 步通道 l 的值位于 Values[s * LaneCount + l]; LaneBufferedGenerator 逐个交出这些值。
+	*/
+	template<typename ScalarEngine, std::size_t LaneCount>
+	class XorshiroLanes
+	{
+		static_assert(LaneCount == 4 || LaneCount == 8, "");
+		static_assert(ScalarEngine::num_state_words == 4 || ScalarEngine::num_state_words == 8, "");
+
+	public:
+		using Generator = ScalarEngine;
+		using result_type = typename Generator::result_type;
+		using KernelTable = XorshiroLanesKernels<ScalarEngine, LaneCount>;
+
+		static constexpr std::size_t lane_count = LaneCount;
+		static constexpr std::size_t STATE_WORDS = Generator::num_state_words;
+
+		//Every compiled kernel, best first; the last one is portable
+		//所有编译进来的内核, 最优在前; 最后一个是可移植的
+		static std::span<const KernelTable* const> KernelCandidates();
+
+		static const KernelTable& Kernels()
+		{
+			static const KernelTable& Selected = CommonToolkit::CPU_FeatureDispatch::SelectKernelTable(KernelCandidates());
+			return Selected;
+		}
+
+		explicit XorshiroLanes(Generator Start)
+		{
+			for (std::size_t Lane = 0; Lane < LaneCount; ++Lane)
+			{
+				this->SetLane(Lane, Start);
+				Start.jump();
+			}
+		}
+
+		explicit XorshiroLanes(result_type Seed)
+			: XorshiroLanes(Generator(Seed))
+		{
+		}
+
+		//The scalar engine that continues lane Lane
+		//延续第 Lane 个通道的标量引擎
+		Generator lane(std::size_t Lane) const
+		{
+			typename Generator::state_type Words {};
+			for (std::size_t Word = 0; Word < STATE_WORDS; ++Word)
+				Words[Word] = this->State[Word * LaneCount + Lane];
+
+			Generator Engine;
+			Engine.set_state(Words);
+			return Engine;
+		}
+
+		//Writes one output of every lane, lane l's to Block[l]
+		//写出每个通道的一个输出, 通道 l 的写到 Block[l]
+		void NextBlock(std::span<result_type, LaneCount> Block)
+		{
+			Kernels().Generate(this->State.data(), Block.data(), 1);
+		}
+
+		std::array<result_type, LaneCount> operator()()
+		{
+			std::array<result_type, LaneCount> Block;
+			this->NextBlock(Block);
+			return Block;
+		}
+
+		//Whole steps go straight into Values; when Values.size() is not a multiple of LaneCount, the unused outputs of the last step are dropped
+		//整步直接写入 Values; 若 Values.size() 不是 LaneCount 的倍数, 最后一步中用不上的输出被丢弃
+		void fill(std::span<result_type> Values)
+		{
+			const std::size_t Steps = Values.size() / LaneCount;
+			if (Steps > 0)
+				Kernels().Generate(this->State.data(), Values.data(), Steps);
+
+			if (const std::size_t Rest = Values.size() % LaneCount; Rest != 0)
+			{
+				std::array<result_type, LaneCount> Block;
+				this->NextBlock(Block);
+				std::copy_n(Block.begin(), Rest, Values.begin() + Steps * LaneCount);
+			}
+		}
+
+		void long_jump()
+		{
+			for (std::size_t Lane = 0; Lane < LaneCount; ++Lane)
+			{
+				Generator Engine = this->lane(Lane);
+				Engine.long_jump();
+				this->SetLane(Lane, Engine);
+			}
+		}
+
+	private:
+		//Word w of lane l at State[w * LaneCount + l]
+		//通道 l 的第 w 个字位于 State[w * LaneCount + l]
+		alignas(64) std::array<std::uint64_t, STATE_WORDS * LaneCount> State {};
+
+		void SetLane(std::size_t Lane, const Generator& Engine)
+		{
+			const auto& Words = Engine.get_state();
+			for (std::size_t Word = 0; Word < STATE_WORDS; ++Word)
+				this->State[Word * LaneCount + Lane] = Words[Word];
+		}
+	};
+
+	using xorshiro256x4 = XorshiroLanes<xorshiro256, 4>;
+	using xorshiro256x8 = XorshiroLanes<xorshiro256, 8>;
+	using xorshiro512x4 = XorshiroLanes<xorshiro512, 4>;
+	using xorshiro512x8 = XorshiroLanes<xorshiro512, 8>;
+
+	template<>
+	std::span<const XorshiroLanesKernels<xorshiro256, 4>* const> xorshiro256x4::KernelCandidates();
+	template<>
+	std::span<const XorshiroLanesKernels<xorshiro256, 8>* const> xorshiro256x8::KernelCandidates();
+	template<>
+	std::span<const XorshiroLanesKernels<xorshiro512, 4>* const> xorshiro512x4::KernelCandidates();
+	template<>
+	std::span<const XorshiroLanesKernels<xorshiro512, 8>* const> xorshiro512x8::KernelCandidates();
+
+	/*
+		A uniform_random_bit_generator over a multi-lane engine (XorshiroLanes, LinearCongruentialLanes) for scalar consumers such as the <random> distributions.
+		Values come out in the order the lanes write them, BufferedSteps steps at a time; fill drains the buffer and then lets the lanes write straight into the caller's span.
+		多通道引擎 (XorshiroLanes, LinearCongruentialLanes) 之上的 uniform_random_bit_generator, 供 <random> 分布等标量使用者使用。
+		值按通道写出的顺序交出, 每次缓冲 BufferedSteps 步; fill 先取完缓冲区, 再让通道直接写入调用者的 span。
+	*/
+	template<typename LanesType, std::size_t BufferedSteps = 64>
+	class LaneBufferedGenerator
+	{
+	public:
+		using result_type = typename LanesType::result_type;
+
+		static constexpr std::size_t BUFFER_SIZE = LanesType::lane_count * BufferedSteps;
+
+		static constexpr result_type min() { return LanesType::Generator::min(); }
+		static constexpr result_type max() { return LanesType::Generator::max(); }
+
+		explicit LaneBufferedGenerator(const LanesType& Lanes)
+			: Lanes(Lanes)
+		{
+		}
+
+		explicit LaneBufferedGenerator(result_type Seed) requires std::constructible_from<LanesType, result_type>
+			: Lanes(Seed)
+		{
+		}
+
+		result_type operator()()
+		{
+			if (this->Position == BUFFER_SIZE)
+				this->Refill();
+			return this->Buffer[this->Position++];
+		}
+
+		//Same values as calling operator() Values.size() times
+		//与调用 Values.size() 次 operator() 的结果相同
+		void fill(std::span<result_type> Values)
+		{
+			std::size_t Index = std::min(Values.size(), BUFFER_SIZE - this->Position);
+			std::copy_n(this->Buffer.begin() + this->Position, Index, Values.begin());
+			this->Position += Index;
+
+			const std::size_t WholeSteps = (Values.size() - Index) / LanesType::lane_count * LanesType::lane_count;
+			this->WriteSteps(Values.subspan(Index, WholeSteps));
+			Index += WholeSteps;
+
+			if (Index < Values.size())
+			{
+				this->Refill();
+				this->Position = Values.size() - Index;
+				std::copy_n(this->Buffer.begin(), this->Position, Values.begin() + Index);
+			}
+		}
+
+		void discard(unsigned long long Count)
+		{
+			const std::size_t Buffered = BUFFER_SIZE - this->Position;
+			if (Count <= Buffered)
+			{
+				this->Position += static_cast<std::size_t>(Count);
+				return;
+			}
+
+			for (Count -= Buffered; Count > BUFFER_SIZE; Count -= BUFFER_SIZE)
+				this->Refill();
+			this->Refill();
+			this->Position = static_cast<std::size_t>(Count);
+		}
+
+	private:
+		LanesType Lanes;
+		std::array<result_type, BUFFER_SIZE> Buffer {};
+		std::size_t Position = BUFFER_SIZE;
+
+		//Values.size() is a multiple of the lane count
+		//Values.size() 是通道数的倍数
+		void WriteSteps(std::span<result_type> Values)
+		{
+			if constexpr (requires { this->Lanes.fill(Values); })
+				this->Lanes.fill(Values);
+			else
+			{
+				for (std::size_t Index = 0; Index < Values.size(); Index += LanesType::lane_count)
+					this->Lanes.NextBlock(Values.subspan(Index).template first<LanesType::lane_count>());
+			}
+		}
+
+		void Refill()
+		{
+			this->WriteSteps(this->Buffer);
+			this->Position = 0;
+		}
+	};
+}
+
+namespace PseudoRandomNumberGenerators
+{
+	//Checks BoundedRandom stays in range and is roughly uniform on the 64-bit, 32-bit and fallback engine paths
+	//检查 BoundedRandom 在64位, 32位和后备引擎路径上都不越界且大致均匀
+	inline void TestBoundedRandom()
+	{
+		constexpr std::uint64_t Bound = 7;
+		constexpr std::size_t DrawCount = 700000;
+
+		auto CheckEngine = [](auto& Engine, const char* EngineName)
+		{
+			std::array<std::size_t, Bound> Histogram {};
+			for (std::size_t Count = 0; Count < DrawCount; ++Count)
+			{
+				const std::uint64_t Value = BoundedRandom(Engine, Bound);
+				if (Value >= Bound)
+				{
+					std::cout << EngineName << ": value " << Value << " out of range" << std::endl;
+					return;
+				}
+				++Histogram[Value];
+			}
+
+			//Chi-square with 6 degrees of freedom, 22.46 is the 0.1% critical value
+			//自由度为6的卡方检验, 22.46 是 0.1% 临界值
+			const double Expected = static_cast<double>(DrawCount) / Bound;
+			double ChiSquare = 0.0;
+			for (const std::size_t Observed : Histogram)
+				ChiSquare += (Observed - Expected) * (Observed - Expected) / Expected;
+
+			std::cout << EngineName << ": chi-square " << ChiSquare << ", " << (ChiSquare < 22.46 ? "passed" : "failed") << std::endl;
+		};
+
+		xorshiro256 Engine64(1);
+		std::mt19937 Engine32(1);
+		std::minstd_rand EngineFallback(1);
+		CheckEngine(Engine64, "xorshiro256");
+		CheckEngine(Engine32, "mt19937");
+		CheckEngine(EngineFallback, "minstd_rand");
+
+		//Large bound close to 2^64, where the modulo bias of PRNG() % Bound would be worst: PRNG() % Bound puts 2/3 of the draws in the lower half.
+		//The binomial standard deviation of the ratio over 100000 draws is 0.0016, so 0.005 is about three of them
+		//接近 2^64 的大边界, 这是 PRNG() % Bound 偏差最严重的情况: PRNG() % Bound 会让 2/3 的结果落在下半部分。
+		//100000 次抽样的比例的二项分布标准差为 0.0016, 所以 0.005 约为三倍标准差
+		constexpr std::size_t LargeBoundDrawCount = 100000;
+		const std::uint64_t LargeBound = (std::numeric_limits<std::uint64_t>::max() / 3) * 2;
+		std::size_t LowerHalfCount = 0;
+		for (std::size_t Count = 0; Count < LargeBoundDrawCount; ++Count)
+		{
+			if (BoundedRandom(Engine64, LargeBound) < LargeBound / 2)
+				++LowerHalfCount;
+		}
+		const double LowerHalfRatio = static_cast<double>(LowerHalfCount) / LargeBoundDrawCount;
+		std::cout << "Large bound lower half ratio: " << LowerHalfRatio << " (expect 0.5), " << (std::abs(LowerHalfRatio - 0.5) < 0.005 ? "passed" : "failed") << std::endl;
+	}
+
+	static_assert(std::uniform_random_bit_generator<InversiveCongruentialGenerator>);
+	static_assert(std::uniform_random_bit_generator<InversiveCongruentialGeneratorBatch<>>);
+
+	//Checks the inversive congruential engines against known answers of the exact recurrence and against each other
+	//用精确递推式的已知答案检查逆同余引擎, 并相互交叉检查
+	inline void TestInversiveCongruentialGenerator()
+	{
+		bool IsPassed = true;
+		using Generator = InversiveCongruentialGenerator;
+		constexpr const MontgomeryArithmetic64& Arithmetic = Generator::Arithmetic;
+
+		//X(n + 1) = A * X(n)^(P - 2) + B mod P computed with arbitrary precision integers, from X(0) = 1
+		//用任意精度整数从 X(0) = 1 计算的 X(n + 1) = A * X(n)^(P - 2) + B mod P
+		constexpr std::array<std::uint64_t, 5> KnownAnswers { 8273078852988539794ULL, 3286139687049767243ULL, 7119930851214572175ULL, 1450343777143808033ULL, 2682517072003759493ULL };
+		Generator Engine(1);
+		for (const std::uint64_t KnownAnswer : KnownAnswers)
+			IsPassed &= Engine() == KnownAnswer;
+		for (std::uint64_t Iterations = 1; Iterations <= KnownAnswers.size(); ++Iterations)
+			IsPassed &= static_cast<std::uint64_t>(Nonlinear_InversiveCongruential(1, Iterations)) == KnownAnswers[Iterations - 1];
+		IsPassed &= Generator(0)() == Generator::Increment;
+
+		Generator Discarded(123456789);
+		Discarded.discard(999);
+		IsPassed &= Discarded() == 1007645655560990572ULL;
+
+		//X * X^-1 = 1, and the addition chain agrees with plain square-and-multiply
+		//X * X^-1 = 1, 且加法链与普通平方-乘算法一致
+		std::mt19937_64 PRNG(1);
+		for (std::size_t Count = 0; Count < 1000; ++Count)
+		{
+			const std::uint64_t X = Arithmetic.ToMontgomery(PRNG());
+			const std::uint64_t Inverse = Generator::InverseMontgomery(X);
+			IsPassed &= X == 0 || Arithmetic.Multiply(X, Inverse) == Arithmetic.One;
+			IsPassed &= Inverse == Arithmetic.Power(X, Generator::Modulus - 2);
+		}
+
+		//fill and discard continue the same sequence as operator()
+		//fill 与 discard 延续与 operator() 相同的序列
+		Generator Single(42), Filled(42);
+		std::vector<std::uint64_t> Values(100);
+		Filled.fill(Values);
+		for (const std::uint64_t Value : Values)
+			IsPassed &= Single() == Value;
+		IsPassed &= Single() == Filled();
+
+		//Each batch lane is the single engine seeded with its lane seed; a lane at zero steps like the single engine does
+		//每条批量通道都等于以其通道种子播种的单个引擎; 处于零的通道与单个引擎的步进方式相同
+		InversiveCongruentialGeneratorBatch<8> Batch(7);
+		std::array<Generator, 8> Lanes;
+		for (std::size_t Lane = 0; Lane < Lanes.size(); ++Lane)
+			Lanes[Lane].seed(InversiveCongruentialGeneratorBatch<8>::LaneSeed(7, Lane));
+		std::vector<std::uint64_t> BatchValues(8 * 20 + 3);
+		Batch();
+		Batch.fill(std::span(BatchValues).subspan(1));
+		BatchValues[0] = Lanes[0]();
+		for (std::size_t Index = 1; Index < BatchValues.size(); ++Index)
+			IsPassed &= BatchValues[Index] == Lanes[Index % 8]();
+
+		std::array<std::uint64_t, 4> ZeroLaneStates { Arithmetic.ToMontgomery(5), 0, Arithmetic.ToMontgomery(9), Arithmetic.ToMontgomery(Generator::Modulus - 1) };
+		InversiveCongruentialGeneratorBatch<4>::StepLanes(ZeroLaneStates);
+		IsPassed &= Arithmetic.FromMontgomery(ZeroLaneStates[0]) == Generator(5)();
+		IsPassed &= Arithmetic.FromMontgomery(ZeroLaneStates[1]) == Generator::Increment;
+		IsPassed &= Arithmetic.FromMontgomery(ZeroLaneStates[2]) == Generator(9)();
+		IsPassed &= Arithmetic.FromMontgomery(ZeroLaneStates[3]) == Generator(Generator::Modulus - 1)();
+
+		std::cout << "Inversive congruential generator known answers and batch cross-check: " << (IsPassed ? "passed" : "failed") << std::endl;
+	}
+
+	static_assert(std::uniform_random_bit_generator<LinearCongruentialGenerator<LinearCongruentialModulus::TwoPower64>>);
+	static_assert(std::uniform_random_bit_generator<LinearCongruentialGenerator<LinearCongruentialModulus::TwoPower64Minus1>>);
+
+	//Checks jump-ahead, bulk fill and the interleaved lanes of the linear congruential generator against stepping one value at a time
+	//用逐个生成的值检查线性同余生成器的向前跳跃, 批量填充和交错通道
+	inline void TestLinearCongruentialGenerator()
+	{
+		bool IsPassed = true;
+		using Generator64 = LinearCongruentialGenerator<LinearCongruentialModulus::TwoPower64>;
+		using GeneratorMersenne = LinearCongruentialGenerator<LinearCongruentialModulus::TwoPower64Minus1>;
+
+		//Linear_Congruential against the loop it replaced
+		//Linear_Congruential 与其替换掉的循环比较
+		for (const std::uint64_t Seed : { std::uint64_t(0), std::uint64_t(1), std::uint64_t(123456789), std::uint64_t(0xDEADBEEFCAFEBABEULL) })
+		{
+			std::uint64_t RandomNumber = Seed == 0 ? 1 : Seed;
+			IsPassed &= Linear_Congruential(Seed, 0) == RandomNumber;
+			for (std::uint64_t Iterations = 1; Iterations <= 300; ++Iterations)
+			{
+				RandomNumber = (Generator64::Multiplier * RandomNumber + Generator64::Increment) % std::numeric_limits<std::uint64_t>::max();
+				IsPassed &= Linear_Congruential(Seed, Iterations) == RandomNumber;
+			}
+		}
+
+		//Jumps computed with arbitrary precision integers
+		//用任意精度整数计算的跳跃
+		Generator64 Jumped64(1);
+		Jumped64.discard(1000000000000000000ULL - 1);
+		IsPassed &= Jumped64() == 10481596027596177409ULL;
+		GeneratorMersenne JumpedMersenne(1);
+		JumpedMersenne.discard(1000000000000000000ULL - 1);
+		IsPassed &= JumpedMersenne() == 5698504804477150432ULL;
+		JumpedMersenne.seed(123456789);
+		JumpedMersenne.discard((1ULL << 40) + 12345 - 1);
+		IsPassed &= JumpedMersenne() == 9425655238351296712ULL;
+		GeneratorMersenne FirstMersenne(1);
+		IsPassed &= FirstMersenne() == 7806831264735756412ULL && FirstMersenne() == 12090269542734012997ULL && FirstMersenne() == 11239174419629776042ULL;
+
+		//The modulus 2^64 has full period: 2^64 steps come back to the seed
+		//模 2^64 为满周期: 2^64 步后回到种子
+		Generator64 FullPeriod(42);
+		FullPeriod.discard(std::numeric_limits<unsigned long long>::max());
+		IsPassed &= FullPeriod() == 42;
+
+		auto CheckAgainstStepping = [&IsPassed]<typename GeneratorType>(GeneratorType Stepped)
+		{
+			GeneratorType Jumped = Stepped, Filled = Stepped;
+			for (std::uint64_t Count = 0; Count < 1000; Count += 37)
+			{
+				GeneratorType Copy = Stepped;
+				for (std::uint64_t Step = 0; Step < Count; ++Step)
+					Copy();
+				Jumped = Stepped;
+				Jumped.discard(Count);
+				IsPassed &= Jumped() == Copy();
+			}
+
+			std::vector<std::uint64_t> Values(1000 + 5);
+			Filled.fill(Values);
+			for (const std::uint64_t Value : Values)
+				IsPassed &= Stepped() == Value;
+			IsPassed &= Stepped() == Filled();
+
+			LinearCongruentialLanes<GeneratorType::IsModulusTwoPower64 ? LinearCongruentialModulus::TwoPower64 : LinearCongruentialModulus::TwoPower64Minus1, 4> Lanes(Stepped);
+			for (std::size_t Block = 0; Block < 100; ++Block)
+			{
+				for (const std::uint64_t Value : Lanes())
+					IsPassed &= Stepped() == Value;
+			}
+		};
+		CheckAgainstStepping(Generator64(987654321));
+		CheckAgainstStepping(GeneratorMersenne(987654321));
+		CheckAgainstStepping(GeneratorMersenne(std::numeric_limits<std::uint64_t>::max() - 1));
+
+		std::cout << "Linear congruential generator jump-ahead, fill and lanes: " << (IsPassed ? "passed" : "failed") << std::endl;
+	}
+
+	static_assert(std::uniform_random_bit_generator<BlumBlumShub>);
+
+	//Checks the Miller-Rabin test, the generated modulus, and the bit stream and jumps of Blum Blum Shub against plain squaring
+	//用普通平方检查 Miller-Rabin 测试, 生成的模数, 以及 Blum Blum Shub 的位流和跳跃
+	inline void TestBlumBlumShub()
+	{
+		bool IsPassed = true;
+
+		auto IsPrimeByTrialDivision = [](std::uint64_t Number)
+		{
+			if (Number < 2)
+				return false;
+			for (std::uint64_t Divisor = 2; Divisor * Divisor <= Number; ++Divisor)
+			{
+				if (Number % Divisor == 0)
+					return false;
+			}
+			return true;
+		};
+		for (std::uint64_t Number = 0; Number < 20000; ++Number)
+			IsPassed &= BlumBlumShub::IsPrimeNumber(Number) == IsPrimeByTrialDivision(Number);
+		for (std::uint64_t Number = 4294967000ULL; Number < 4294968000ULL; ++Number)
+			IsPassed &= BlumBlumShub::IsPrimeNumber(Number) == IsPrimeByTrialDivision(Number);
+
+		//Strong pseudoprimes to small bases, Carmichael numbers and primes near 2^64
+		//小基的强伪素数, 卡迈克尔数以及 2^64 附近的素数
+		for (const std::uint64_t Composite : { 2047ULL, 3215031751ULL, 341550071728321ULL, 3825123056546413051ULL, 18446744073709551615ULL, 4294967291ULL * 4294967279ULL })
+			IsPassed &= !BlumBlumShub::IsPrimeNumber(Composite);
+		for (const std::uint64_t Prime : { 2305843009213693951ULL, 18446744073709551557ULL, 4294967291ULL, 9223372036854775783ULL })
+			IsPassed &= BlumBlumShub::IsPrimeNumber(Prime);
+
+		//Plain (A * B) mod Modulus for checking the Montgomery squares
+		//用于检查蒙哥马利平方的普通 (A * B) mod Modulus
+		auto SquareModulo = [](std::uint64_t A, std::uint64_t Modulus)
+		{
+			std::uint64_t Result = 0;
+			for (std::uint64_t B = A; B != 0; B >>= 1)
+			{
+				if (B & 1)
+					Result = Result >= Modulus - A ? Result - (Modulus - A) : Result + A;
+				A = A >= Modulus - A ? A - (Modulus - A) : A + A;
+			}
+			return Result;
+		};
+
+		for (const std::uint64_t Seed : { 0ULL, 1ULL, 2ULL, 123456789ULL })
+		{
+			BlumBlumShub Engine(Seed);
+			const std::uint64_t N = Engine.modulus();
+			IsPassed &= std::bit_width(N) >= 63 && Engine.bits_per_step() == 5;
+
+			std::uint64_t PrimeFactor = 0;
+			for (std::uint64_t Candidate = (std::uint64_t(1) << 31) + 3; Candidate < (std::uint64_t(1) << 32) && PrimeFactor == 0; Candidate += 4)
+			{
+				if (N % Candidate == 0)
+					PrimeFactor = Candidate;
+			}
+			IsPassed &= PrimeFactor != 0 && BlumBlumShub::IsPrimeNumber(PrimeFactor) && BlumBlumShub::IsPrimeNumber(N / PrimeFactor) && (N / PrimeFactor) % 4 == 3 && N / PrimeFactor != PrimeFactor;
+
+			//Every output word is the low 5 bits of consecutive squares, least significant first
+			//每个输出字由连续平方的低5位组成, 低位在前
+			BlumBlumShub Words = Engine, Jumped = Engine;
+			std::uint64_t X = Engine.NumberGeneration(1);
+			IsPassed &= Engine.NumberGeneration(1) == SquareModulo(X, N);
+			X = SquareModulo(X, N);
+
+			Jumped.NumberGeneration(1000);
+			std::uint64_t Reference = X;
+			for (std::uint64_t Step = 2; Step < 1000; ++Step)
+				Reference = SquareModulo(Reference, N);
+			IsPassed &= Jumped.NumberGeneration(1) == SquareModulo(Reference, N);
+
+			BlumBlumShub Stepped = Words;
+			std::uint64_t Bits = 0;
+			std::uint32_t BitCount = 0;
+			for (std::size_t Word = 0; Word < 20; ++Word)
+			{
+				std::uint64_t Expected = 0;
+				for (std::uint32_t Filled = 0; Filled < 64;)
+				{
+					if (BitCount == 0)
+					{
+						Bits = Stepped.NumberGeneration(1) & 31;
+						BitCount = 5;
+					}
+					const std::uint32_t Taken = std::min<std::uint32_t>(64 - Filled, BitCount);
+					Expected |= (Bits & ((std::uint64_t(1) << Taken) - 1)) << Filled;
+					Bits >>= Taken;
+					BitCount -= Taken;
+					Filled += Taken;
+				}
+				IsPassed &= Words() == Expected;
+			}
+
+			//discard with whole and partial groups of outputs, from a partly used bit buffer
+			//从部分使用的位缓冲区开始, 以整组和部分组输出进行 discard
+			for (const unsigned long long Count : { 1ULL, 4ULL, 5ULL, 13ULL, 1000ULL })
+			{
+				BlumBlumShub Discarded = Words, Called = Words;
+				Discarded.discard(Count);
+				for (unsigned long long Index = 0; Index < Count; ++Index)
+					Called();
+				IsPassed &= Discarded() == Called() && Discarded() == Called();
+			}
+		}
+
+		std::cout << "Blum Blum Shub primes, Montgomery squaring and bit stream: " << (IsPassed ? "passed" : "failed") << std::endl;
+	}
+
+	static_assert(std::uniform_random_bit_generator<MersenneTwister32BitBlock>);
+	static_assert(std::uniform_random_bit_generator<MersenneTwister64BitBlock>);
+
+	//Checks every Mersenne Twister block kernel this processor can run against the portable one, and the block engine against the one-word classes
+	//用可移植内核检查本处理器能运行的每个梅森旋转块内核, 并用逐字生成的类检查块引擎
+	inline void TestMersenneTwisterBlock()
+	{
+		bool IsAllPassed = true;
+
+		auto CheckKernels = [&IsAllPassed]<typename EngineType>(std::string_view EngineName)
+		{
+			using WordType = typename EngineType::result_type;
+			const auto Candidates = EngineType::KernelCandidates();
+			const auto& Portable = *Candidates.back();
+
+			std::mt19937_64 PRNG(1);
+			std::vector<WordType> InitialState(EngineType::STATE_SIZE);
+			for (WordType& Word : InitialState)
+				Word = static_cast<WordType>(PRNG());
+
+			for (const auto* Kernels : Candidates)
+			{
+				if (!CommonToolkit::CPU_FeatureDispatch::HasFeatures(Kernels->RequiredFeatures))
+				{
+					std::cout << EngineName << " " << Kernels->Name << " kernel: skipped (not supported by this processor)" << std::endl;
+					continue;
+				}
+
+				bool IsPassed = true;
+				std::vector<WordType> KernelState(InitialState), ReferenceState(InitialState);
+				for (std::size_t Round = 0; Round < 3; ++Round)
+				{
+					Kernels->TwistState(KernelState.data());
+					Portable.TwistState(ReferenceState.data());
+					IsPassed &= KernelState == ReferenceState;
+
+					//Every count, so each tail length after the last whole vector is covered
+					//每个数量都测, 以覆盖最后一个整向量之后的各种尾部长度
+					for (std::size_t Count : { std::size_t(0), std::size_t(1), std::size_t(3), std::size_t(7), std::size_t(9), EngineType::STATE_SIZE - 1, EngineType::STATE_SIZE })
+					{
+						std::vector<WordType> KernelValues(Count), ReferenceValues(Count);
+						Kernels->TemperState(KernelState.data(), KernelValues.data(), Count);
+						Portable.TemperState(ReferenceState.data(), ReferenceValues.data(), Count);
+						IsPassed &= KernelValues == ReferenceValues;
+					}
+				}
+
+				std::cout << EngineName << " " << Kernels->Name << " kernel cross-check: " << (IsPassed ? "passed" : "failed") << std::endl;
+				IsAllPassed &= IsPassed;
+			}
+		};
+		CheckKernels.template operator()<MersenneTwister32BitBlock>("MersenneTwister32BitBlock");
+		CheckKernels.template operator()<MersenneTwister64BitBlock>("MersenneTwister64BitBlock");
+
+		bool IsPassed = true;
+
+		//The same sequence as the one-word classes (after a reseed too) and the standard engines
+		//与逐字生成的类 (包括重新播种之后) 以及标准引擎的序列相同
+		MersenneTwister32Bit OneWord32(5489);
+		MersenneTwister64Bit OneWord64(1);
+		OneWord32.ResetState(12345);
+		OneWord64.ResetState(12345);
+		MersenneTwister32BitBlock Block32(12345);
+		MersenneTwister64BitBlock Block64(12345);
+		std::mt19937 Standard32(12345);
+		std::mt19937_64 Standard64(12345);
+		for (std::size_t Count = 0; Count < 3 * 624 + 100; ++Count)
+		{
+			const std::uint32_t Value32 = Block32();
+			IsPassed &= Value32 == OneWord32.NumberGeneration(1) && Value32 == Standard32();
+			const std::uint64_t Value64 = Block64();
+			IsPassed &= Value64 == OneWord64.NumberGeneration(1) && Value64 == Standard64();
+		}
+		IsPassed &= MersenneTwister32BitBlock()() == std::mt19937()() && MersenneTwister64BitBlock()() == std::mt19937_64()();
+
+		//fill and discard from every position in the buffered block, including whole blocks
+		//从缓冲块中的各个位置开始 fill 与 discard, 包括整块
+		for (const std::size_t Count : { 0, 1, 5, 311, 312, 313, 623, 624, 625, 1248, 2000 })
+		{
+			MersenneTwister32BitBlock Filled32(7), Stepped32(7), Discarded32(7);
+			MersenneTwister64BitBlock Filled64(7), Stepped64(7), Discarded64(7);
+			for (std::size_t Skip = 0; Skip < Count % 97; ++Skip)
+			{
+				Filled32(); Stepped32(); Discarded32();
+				Filled64(); Stepped64(); Discarded64();
+			}
+
+			std::vector<std::uint32_t> Values32(Count);
+			std::vector<std::uint64_t> Values64(Count);
+			Filled32.fill(Values32);
+			Filled64.fill(Values64);
+			Discarded32.discard(Count);
+			Discarded64.discard(Count);
+			for (std::size_t Index = 0; Index < Count; ++Index)
+			{
+				IsPassed &= Values32[Index] == Stepped32();
+				IsPassed &= Values64[Index] == Stepped64();
+			}
+			const std::uint32_t Next32 = Stepped32();
+			const std::uint64_t Next64 = Stepped64();
+			IsPassed &= Filled32() == Next32 && Discarded32() == Next32;
+			IsPassed &= Filled64() == Next64 && Discarded64() == Next64;
+		}
+
+		std::cout << "Mersenne Twister block engine (dispatched to " << MersenneTwister32BitBlock::Kernels().Name << "): " << (IsPassed && IsAllPassed ? "passed" : "failed") << std::endl;
+	}
+
+	/*
+		Checks the jump-ahead against plain stepping from several positions in a block, for jumps within one block and jumps past the degree of the characteristic polynomial,
+		the precomputed jump polynomials against repeated squaring, and split against successive jumps.
+		从块中的多个位置出发, 对块内的跳跃以及超过特征多项式次数的跳跃, 把跳跃与逐步生成相比较;
+		再把预计算的跳跃多项式与反复平方的结果相比较, 把 split 与连续跳跃相比较。
+	*/
+	inline void TestMersenneTwisterJump()
+	{
+		using MersenneTwisterKernels::Parameters32Bit;
+		using MersenneTwisterKernels::Parameters64Bit;
+
+		bool IsPassed = true;
+
+		for (const std::uint32_t PowerOfTwo : { 3U, 9U, 10U, 15U, 17U })
+		{
+			for (const std::uint64_t Offset : { 0, 1, 300, 623, 624, 1000 })
+			{
+				MersenneTwister32Bit Jumped32(5489), Stepped32(5489);
+				MersenneTwister64Bit Jumped64(5489), Stepped64(5489);
+				MersenneTwister32BitBlock JumpedBlock32(5489);
+				MersenneTwister64BitBlock JumpedBlock64(5489);
+				if (Offset > 0)
+				{
+					Jumped32.NumberGeneration(Offset);
+					Jumped64.NumberGeneration(Offset);
+					JumpedBlock32.discard(Offset);
+					JumpedBlock64.discard(Offset);
+				}
+
+				Jumped32.JumpAhead(PowerOfTwo);
+				Jumped64.JumpAhead(PowerOfTwo);
+				JumpedBlock32.jump(PowerOfTwo);
+				JumpedBlock64.jump(PowerOfTwo);
+				Stepped32.NumberGeneration(Offset + (std::uint64_t(1) << PowerOfTwo));
+				Stepped64.NumberGeneration(Offset + (std::uint64_t(1) << PowerOfTwo));
+
+				for (std::size_t Count = 0; Count < 700; ++Count)
+				{
+					const std::uint32_t Value32 = Stepped32.NumberGeneration(1);
+					IsPassed &= Jumped32.NumberGeneration(1) == Value32 && JumpedBlock32() == Value32;
+					const std::uint64_t Value64 = Stepped64.NumberGeneration(1);
+					IsPassed &= Jumped64.NumberGeneration(1) == Value64 && JumpedBlock64() == Value64;
+				}
+			}
+		}
+
+		for (const std::uint32_t PowerOfTwo : { 64U, 128U })
+		{
+			IsPassed &= MersenneTwisterJump::ComputeJumpPolynomial<Parameters32Bit>(PowerOfTwo) == MersenneTwisterJump::JumpPolynomial<Parameters32Bit>(PowerOfTwo);
+			IsPassed &= MersenneTwisterJump::ComputeJumpPolynomial<Parameters64Bit>(PowerOfTwo) == MersenneTwisterJump::JumpPolynomial<Parameters64Bit>(PowerOfTwo);
+		}
+
+		MersenneTwister32BitBlock Engine32(2024), Expected32(2024);
+		MersenneTwister64Bit Engine64(2024), Expected64(2024);
+		Engine32.discard(100);
+		Expected32.discard(100);
+		Engine64.NumberGeneration(100);
+		Expected64.NumberGeneration(100);
+		std::vector<MersenneTwister32BitBlock> Substreams32 = Engine32.split(3);
+		std::vector<MersenneTwister64Bit> Substreams64 = Engine64.Split(3);
+		for (std::size_t Index = 0; Index < 3; ++Index)
+		{
+			MersenneTwister32BitBlock Start32(Expected32);
+			MersenneTwister64Bit Start64(Expected64);
+			for (std::size_t Count = 0; Count < 10; ++Count)
+			{
+				IsPassed &= Substreams32[Index]() == Start32();
+				IsPassed &= Substreams64[Index].NumberGeneration(1) == Start64.NumberGeneration(1);
+			}
+			Expected32.jump(MersenneTwister32BitBlock::SUBSTREAM_POWER_OF_TWO);
+			Expected64.JumpAhead(MersenneTwister64Bit::SUBSTREAM_POWER_OF_TWO);
+		}
+		IsPassed &= Substreams32.size() == 3 && Engine32() == Expected32() && Engine64.NumberGeneration(1) == Expected64.NumberGeneration(1);
+
+		std::cout << "Mersenne Twister jump-ahead and split: " << (IsPassed ? "passed" : "failed") << std::endl;
+	}
+
+	static_assert(std::uniform_random_bit_generator<LaneBufferedGenerator<xorshiro256x8>>);
+	static_assert(std::uniform_random_bit_generator<LaneBufferedGenerator<LinearCongruentialLanes<LinearCongruentialModulus::TwoPower64, 4>>>);
+
+	/*
+		Cross-checks every supported multi-lane xoshiro kernel against the portable one, the lanes against jump()-spaced scalar engines (fill, NextBlock, long_jump),
+		and LaneBufferedGenerator against the lanes it wraps; also pins xorshiro512::jump / long_jump to values of the reference implementation.
+		把每个受支持的多通道 xoshiro 内核与可移植内核交叉核对, 把各通道与按 jump() 错开的标量引擎核对 (fill, NextBlock, long_jump),
+		并把 LaneBufferedGenerator 与其包装的通道核对; 另外用参考实现的值固定 xorshiro512::jump / long_jump 的结果。
+	*/
+	inline void TestXorshiroLanes()
+	{
+		bool IsPassed = true;
+
+		auto CheckLanes = [&IsPassed]<typename LanesType>(std::string_view LanesName)
+		{
+			using Generator = typename LanesType::Generator;
+			constexpr std::size_t LaneCount = LanesType::lane_count;
+
+			const auto Candidates = LanesType::KernelCandidates();
+			const auto& Portable = *Candidates.back();
+			std::vector<std::uint64_t> InitialState(LanesType::STATE_WORDS * LaneCount);
+			std::mt19937_64 PRNG(3);
+			for (std::uint64_t& Word : InitialState)
+				Word = PRNG();
+
+			for (const auto* Kernels : Candidates)
+			{
+				if (!CommonToolkit::CPU_FeatureDispatch::HasFeatures(Kernels->RequiredFeatures))
+				{
+					std::cout << LanesName << " " << Kernels->Name << " kernel: skipped (not supported by this processor)" << std::endl;
+					continue;
+				}
+
+				bool IsKernelPassed = true;
+				std::vector<std::uint64_t> KernelState(InitialState), ReferenceState(InitialState);
+				std::vector<std::uint64_t> KernelValues(LaneCount * 37), ReferenceValues(LaneCount * 37);
+				for (const std::size_t Steps : { std::size_t(0), std::size_t(1), std::size_t(37) })
+				{
+					Kernels->Generate(KernelState.data(), KernelValues.data(), Steps);
+					Portable.Generate(ReferenceState.data(), ReferenceValues.data(), Steps);
+					IsKernelPassed &= KernelState == ReferenceState && KernelValues == ReferenceValues;
+				}
+				std::cout << LanesName << " " << Kernels->Name << " kernel cross-check: " << (IsKernelPassed ? "passed" : "failed") << std::endl;
+				IsPassed &= IsKernelPassed;
+			}
+
+			//Lane l is the seed engine after l jumps
+			//通道 l 是种子引擎 jump l 次之后的状态
+			LanesType Lanes(Generator(2024));
+			std::vector<Generator> Scalars;
+			Generator Start(2024);
+			for (std::size_t Lane = 0; Lane < LaneCount; ++Lane)
+			{
+				Scalars.push_back(Start);
+				Start.jump();
+			}
+
+			std::vector<std::uint64_t> Values(LaneCount * 100 + 3);
+			Lanes.fill(Values);
+			for (std::size_t Index = 0; Index < Values.size(); ++Index)
+				IsPassed &= Values[Index] == Scalars[Index % LaneCount]();
+			//The last partial step dropped the other lanes' outputs
+			//最后不完整的一步丢弃了其余通道的输出
+			for (std::size_t Lane = 3; Lane < LaneCount; ++Lane)
+				Scalars[Lane]();
+
+			const std::array<std::uint64_t, LaneCount> Block = Lanes();
+			for (std::size_t Lane = 0; Lane < LaneCount; ++Lane)
+				IsPassed &= Block[Lane] == Scalars[Lane]();
+
+			Lanes.long_jump();
+			for (std::size_t Lane = 0; Lane < LaneCount; ++Lane)
+			{
+				Scalars[Lane].long_jump();
+				IsPassed &= Lanes.lane(Lane).get_state() == Scalars[Lane].get_state();
+			}
+
+			//The adapter hands out exactly what fill writes, through operator(), fill and discard in any mix
+			//适配器交出的值与 fill 写出的完全相同, 无论 operator(), fill 与 discard 如何混用
+			LaneBufferedGenerator<LanesType> Adapter(Lanes);
+			LanesType Reference(Lanes);
+			std::vector<std::uint64_t> Expected(LaneCount * 1000);
+			Reference.fill(Expected);
+			std::size_t Position = 0;
+			for (const std::size_t Count : { 1, 5, 300, 2, 900, 64, 1000 })
+			{
+				IsPassed &= Adapter() == Expected[Position++];
+				std::vector<std::uint64_t> Chunk(Count);
+				Adapter.fill(Chunk);
+				IsPassed &= std::equal(Chunk.begin(), Chunk.end(), Expected.begin() + Position);
+				Position += Count;
+				Adapter.discard(Count / 2);
+				Position += Count / 2;
+			}
+		};
+		CheckLanes.template operator()<xorshiro256x4>("xorshiro256x4");
+		CheckLanes.template operator()<xorshiro256x8>("xorshiro256x8");
+		CheckLanes.template operator()<xorshiro512x4>("xorshiro512x4");
+		CheckLanes.template operator()<xorshiro512x8>("xorshiro512x8");
+
+		//Over the congruential lanes the adapter gives back the plain sequence
+		//在同余通道之上, 适配器还原出普通序列
+		LinearCongruentialGenerator<LinearCongruentialModulus::TwoPower64> Congruential(7);
+		LaneBufferedGenerator<LinearCongruentialLanes<LinearCongruentialModulus::TwoPower64, 8>> CongruentialAdapter((LinearCongruentialLanes<LinearCongruentialModulus::TwoPower64, 8>(Congruential)));
+		for (std::size_t Count = 0; Count < 1000; ++Count)
+			IsPassed &= CongruentialAdapter() == Congruential();
+
+		xorshiro512 Jumped(1), LongJumped(1);
+		Jumped.jump();
+		LongJumped.long_jump();
+		IsPassed &= Jumped() == 0x352754b85bf1e46cULL && LongJumped() == 0x9eac137297d06669ULL;
+
+		std::cout << "xorshiro multi-lane engines (dispatched to " << xorshiro256x8::Kernels().Name << "): " << (IsPassed ? "passed" : "failed") << std::endl;
+	}
+
+	inline void TestXorshiroJump()
+	{
+		bool IsPassed = true;
+
+		//Known answers are one output after Vigna's reference jump() / long_jump() of seed 1 (xorshiro1024 first steps 5 times, so that state_position is not 0)
+		//已知答案是种子 1 经过 Vigna 参考 jump() / long_jump() 之后的一个输出 (xorshiro1024 先走 5 步, 使 state_position 不为 0)
+		auto CheckEngine = [&IsPassed]<typename Engine>(std::string_view EngineName, std::uint32_t JumpPowerOfTwo, std::uint64_t JumpedValue, std::uint64_t LongJumpedValue)
+		{
+			constexpr std::size_t StateBits = 64 * Engine::num_state_words;
+			bool IsEnginePassed = true;
+
+			Engine Seeded(1);
+			if constexpr (std::same_as<Engine, xorshiro1024>)
+				Seeded.discard(5);
+
+			//The characteristic polynomial annihilates the state update: its low coefficients applied by Horner's rule give the same state as G^n
+			//特征多项式零化状态更新: 用 Horner 法则作用其低次系数, 得到与 G^n 相同的状态
+			Engine Annihilated(Seeded), Stepped(Seeded);
+			XorshiroJump::ApplyPolynomial(Annihilated, Engine::characteristic_polynomial);
+			Stepped.discard(StateBits);
+			IsEnginePassed &= Annihilated.get_state() == Stepped.get_state();
+
+			//The cached matrices agree with Horner's rule and with the known answers
+			//缓存的矩阵与 Horner 法则以及已知答案一致
+			Engine Jumped(Seeded), LongJumped(Seeded), HornerJumped(Seeded), HornerLongJumped(Seeded);
+			Jumped.jump();
+			LongJumped.long_jump();
+			XorshiroJump::ApplyPolynomial(HornerJumped, Engine::jump_polynomial);
+			XorshiroJump::ApplyPolynomial(HornerLongJumped, Engine::long_jump_polynomial);
+			IsEnginePassed &= Jumped.get_state() == HornerJumped.get_state() && LongJumped.get_state() == HornerLongJumped.get_state();
+			IsEnginePassed &= Jumped() == JumpedValue && LongJumped() == LongJumpedValue;
+
+			//Powers of two computed by squaring agree with stepping and with the fixed tables
+			//用平方计算的 2 的幂次与逐步推进以及固定表一致
+			for (const std::uint32_t PowerOfTwo : { 0U, 5U, 12U, 16U })
+			{
+				Engine Powered(Seeded), Reference(Seeded);
+				Powered.jump_power_of_two(PowerOfTwo);
+				Reference.discard(std::uint64_t(1) << PowerOfTwo);
+				IsEnginePassed &= Powered.get_state() == Reference.get_state();
+			}
+			Engine PoweredJump(Seeded), PoweredLongJump(Seeded), FixedJumps(Seeded);
+			PoweredJump.jump_power_of_two(JumpPowerOfTwo);
+			FixedJumps.jump();
+			IsEnginePassed &= PoweredJump.get_state() == FixedJumps.get_state();
+			PoweredLongJump.jump_power_of_two(JumpPowerOfTwo + JumpPowerOfTwo / 2);
+			FixedJumps.long_jump();
+			PoweredLongJump.jump_power_of_two(JumpPowerOfTwo);
+			IsEnginePassed &= PoweredLongJump.get_state() == FixedJumps.get_state();
+
+			//Arbitrary counts on both sides of the stepping threshold, and a count beyond stepping reach against a power of two
+			//逐步推进阈值两侧的任意步数, 以及一个无法逐步推进的步数与 2 的幂次对照
+			constexpr std::uint64_t Threshold = XorshiroJump::MaximumSteppedCount<Engine::num_state_words>;
+			for (const std::uint64_t Steps : { std::uint64_t(0), std::uint64_t(1), Threshold, Threshold + 1, std::uint64_t(10007), std::uint64_t(65536 + 3) })
+			{
+				Engine Skipped(Seeded), Reference(Seeded);
+				Skipped.jump(Steps);
+				Reference.discard(Steps);
+				IsEnginePassed &= Skipped.get_state() == Reference.get_state() && Skipped() == Reference();
+			}
+			Engine Skipped(Seeded), Composed(Seeded);
+			Skipped.jump((std::uint64_t(1) << 40) + 12345);
+			Composed.jump_power_of_two(40);
+			Composed.discard(12345);
+			IsEnginePassed &= Skipped.get_state() == Composed.get_state();
+
+			std::cout << EngineName << " jump-ahead: " << (IsEnginePassed ? "passed" : "failed") << std::endl;
+			IsPassed &= IsEnginePassed;
+		};
+		CheckEngine.template operator()<xorshiro128>("xorshiro128", 64, 0x3cdba30c3a6ea1f0ULL, 0xd969a5673fdaf21bULL);
+		CheckEngine.template operator()<xorshiro256>("xorshiro256", 128, 0x332802f81eaae9d0ULL, 0x39f49e454a208207ULL);
+		CheckEngine.template operator()<xorshiro512>("xorshiro512", 256, 0x352754b85bf1e46cULL, 0x9eac137297d06669ULL);
+		CheckEngine.template operator()<xorshiro1024>("xorshiro1024", 512, 0x4ead47903e38ebb1ULL, 0xc904a802c00fd1e2ULL);
+
+		//Constant evaluation still jumps, by Horner's rule
+		//常量求值仍然可以跳跃, 使用 Horner 法则
+		static_assert([]
+		{
+			xorshiro128 Jumped(1);
+			Jumped.jump();
+			return Jumped();
+		}() == 0x3cdba30c3a6ea1f0ULL);
+
+		std::cout << "xorshiro jump-ahead: " << (IsPassed ? "passed" : "failed") << std::endl;
+	}
+
+	//Checks the lagged Fibonacci blocks against a one-output-at-a-time recurrence and std::subtract_with_carry_engine, and where the two lags read in the ring
+	//用逐个输出的递推与 std::subtract_with_carry_engine 检查滞后斐波那契块, 并检查两个滞后在环中读取的位置
+	inline void TestLaggedFibonacciBlock()
+	{
+		bool IsPassed = true;
+
+		//One output at a time from a growing history, with the carry written as a comparison of the exact sum against 2^w
+		//用不断增长的历史逐个输出, 进位写成精确和与 2^w 的比较
+		auto ReferenceStep = []<typename DataType>(LaggedFibonacciOperation Operation, DataType ShortLagged, DataType LongLagged, DataType& Carry) -> DataType
+		{
+			constexpr DataType Maximum = std::numeric_limits<DataType>::max();
+			switch (Operation)
+			{
+				case LaggedFibonacciOperation::AdditionWithCarry:
+				{
+					const bool CarryOut = (Carry == 1 && LongLagged == Maximum) || static_cast<DataType>(LongLagged + Carry) > static_cast<DataType>(Maximum - ShortLagged);
+					const DataType Result = static_cast<DataType>(ShortLagged + LongLagged + Carry);
+					Carry = CarryOut;
+					return Result;
+				}
+				case LaggedFibonacciOperation::SubtractWithBorrow:
+					std::swap(ShortLagged, LongLagged);
+					[[fallthrough]];
+				default:
+				{
+					const bool BorrowOut = LongLagged > ShortLagged || (LongLagged == ShortLagged && Carry == 1);
+					const DataType Result = static_cast<DataType>(ShortLagged - LongLagged - Carry);
+					Carry = BorrowOut;
+					return Result;
+				}
+			}
+		};
+
+		auto CheckEngine = [&IsPassed, &ReferenceStep]<typename Engine>(std::string_view EngineName, LaggedFibonacciOperation Operation)
+		{
+			using DataType = typename Engine::result_type;
+			bool IsEnginePassed = true;
+
+			std::vector<DataType> History(Engine::long_lag);
+			std::mt19937_64 Words(2024);
+			for (auto& Word : History)
+				Word = static_cast<DataType>(Words());
+			DataType Carry = 1;
+
+			Engine Generator(std::span<const DataType, Engine::long_lag>(History.data(), Engine::long_lag), Carry);
+			for (std::size_t Count = 0; Count < 20 * Engine::long_lag + 7; ++Count)
+			{
+				const std::size_t Size = History.size();
+				History.push_back(ReferenceStep(Operation, History[Size - Engine::short_lag], History[Size - Engine::long_lag], Carry));
+				IsEnginePassed &= Generator() == History.back();
+			}
+
+			//A one in the newest word alone: the short lag reads it back every ShortLag outputs, and the long lag once more at output LongLag - 1, just before both indices wrap
+			//只有最新的字为一: 短滞后每 ShortLag 个输出读回它一次, 长滞后在第 LongLag - 1 个输出再读一次, 恰好在两个下标回绕之前
+			if (Operation == LaggedFibonacciOperation::AdditionWithCarry)
+			{
+				std::array<DataType, Engine::long_lag> Impulse {};
+				Impulse.back() = 1;
+				Engine Echoes(Impulse, 0);
+				for (std::size_t Count = 0; Count <= Engine::long_lag; ++Count)
+					IsEnginePassed &= Echoes() == ((Count + 1) % Engine::short_lag == 0) + (Count + 1 == Engine::long_lag);
+			}
+
+			IsEnginePassed &= CheckEngineConformance<Engine>({ 0, 1, Engine::long_lag - 1, Engine::long_lag, Engine::long_lag + 1, 3 * Engine::long_lag + 5, 5 * Engine::long_lag + 3 }, 1);
+
+			std::cout << EngineName << ": " << (IsEnginePassed ? "passed" : "failed") << std::endl;
+			IsPassed &= IsEnginePassed;
+		};
+		CheckEngine.template operator()<AdditionWithCarryBlock<std::uint8_t, 3, 17>>("AdditionWithCarryBlock<uint8_t, 3, 17>", LaggedFibonacciOperation::AdditionWithCarry);
+		CheckEngine.template operator()<AdditionWithCarryBlock<std::uint16_t, 5, 23>>("AdditionWithCarryBlock<uint16_t, 5, 23>", LaggedFibonacciOperation::AdditionWithCarry);
+		CheckEngine.template operator()<AdditionWithCarryBlock<std::uint32_t, 8, 48>>("AdditionWithCarryBlock<uint32_t, 8, 48>", LaggedFibonacciOperation::AdditionWithCarry);
+		CheckEngine.template operator()<AdditionWithCarryBlock<std::uint64_t, 11, 28>>("AdditionWithCarryBlock<uint64_t, 11, 28>", LaggedFibonacciOperation::AdditionWithCarry);
+		CheckEngine.template operator()<SubtractWithBorrowBlock<std::uint8_t, 3, 17>>("SubtractWithBorrowBlock<uint8_t, 3, 17>", LaggedFibonacciOperation::SubtractWithBorrow);
+		CheckEngine.template operator()<SubtractWithBorrowBlock<std::uint16_t, 5, 23>>("SubtractWithBorrowBlock<uint16_t, 5, 23>", LaggedFibonacciOperation::SubtractWithBorrow);
+		CheckEngine.template operator()<SubtractWithBorrowBlock<std::uint32_t, 3, 17>>("SubtractWithBorrowBlock<uint32_t, 3, 17>", LaggedFibonacciOperation::SubtractWithBorrow);
+		CheckEngine.template operator()<SubtractWithBorrowBlock<std::uint64_t, 5, 62>>("SubtractWithBorrowBlock<uint64_t, 5, 62>", LaggedFibonacciOperation::SubtractWithBorrow);
+		CheckEngine.template operator()<SubtractWithCarryBlock<std::uint8_t, 3, 17>>("SubtractWithCarryBlock<uint8_t, 3, 17>", LaggedFibonacciOperation::SubtractWithCarry);
+		CheckEngine.template operator()<SubtractWithCarryBlock<std::uint16_t, 5, 23>>("SubtractWithCarryBlock<uint16_t, 5, 23>", LaggedFibonacciOperation::SubtractWithCarry);
+		CheckEngine.template operator()<SubtractWithCarryBlock<std::uint32_t, 3, 17>>("SubtractWithCarryBlock<uint32_t, 3, 17>", LaggedFibonacciOperation::SubtractWithCarry);
+		CheckEngine.template operator()<SubtractWithCarryBlock<std::uint64_t, 5, 62>>("SubtractWithCarryBlock<uint64_t, 5, 62>", LaggedFibonacciOperation::SubtractWithCarry);
+
+		//SubtractWithCarry continues std::subtract_with_carry_engine from its text state (the last LongLag values, then the carry)
+		//SubtractWithCarry 从 std::subtract_with_carry_engine 的文本状态 (最近的 LongLag 个值, 然后是进位) 继续生成相同的序列
+		auto CheckStandard = [&IsPassed]<typename Engine, typename StandardEngine>(std::string_view EngineName)
+		{
+			using DataType = typename Engine::result_type;
+
+			StandardEngine Standard(2024);
+			Standard.discard(3);
+			std::stringstream Text;
+			Text << Standard;
+			std::array<DataType, Engine::long_lag> PreviousOutputs {};
+			unsigned long long Word = 0;
+			for (auto& Output : PreviousOutputs)
+			{
+				Text >> Word;
+				Output = static_cast<DataType>(Word);
+			}
+			Text >> Word;
+			const DataType Carry = static_cast<DataType>(Word);
+
+			//libstdc++ writes its ring buffer as stored and appends the ring position, the oldest value is at that position
+			//libstdc++ 按存储顺序写出环形缓冲区并附加环形位置, 最旧的值位于该位置
+			if (Text >> Word)
+				std::ranges::rotate(PreviousOutputs, PreviousOutputs.begin() + Word % Engine::long_lag);
+
+			Engine Generator(PreviousOutputs, Carry);
+			bool IsEnginePassed = true;
+			std::vector<DataType> Values(10 * Engine::long_lag + 3);
+			Generator.fill(Values);
+			for (const auto Value : Values)
+				IsEnginePassed &= Value == Standard();
+
+			std::cout << EngineName << " against std::subtract_with_carry_engine: " << (IsEnginePassed ? "passed" : "failed") << std::endl;
+			IsPassed &= IsEnginePassed;
+		};
+		CheckStandard.template operator()<SubtractWithCarryBlock<std::uint16_t, 5, 23>, std::subtract_with_carry_engine<std::uint32_t, 16, 5, 23>>("SubtractWithCarryBlock<uint16_t, 5, 23>");
+		CheckStandard.template operator()<SubtractWithCarryBlock<std::uint32_t, 3, 17>, std::subtract_with_carry_engine<std::uint32_t, 32, 3, 17>>("SubtractWithCarryBlock<uint32_t, 3, 17>");
+		CheckStandard.template operator()<SubtractWithCarryBlock<std::uint64_t, 5, 62>, std::subtract_with_carry_engine<std::uint64_t, 64, 5, 62>>("SubtractWithCarryBlock<uint64_t, 5, 62>");
+
+		//Seeded like AdditionWithCarry / SubtractWithBorrow / SubtractWithCarry, and usable with the <random> distributions
+		//与 AdditionWithCarry / SubtractWithBorrow / SubtractWithCarry 一样播种, 并且可以用于 <random> 的分布
+		SubtractWithCarryBlock<std::uint64_t, 5, 62> Generator(5);
+		std::uniform_real_distribution<double> Unit(0.0, 1.0);
+		for (std::size_t Count = 0; Count < 1000; ++Count)
+		{
+			const double Fraction = Unit(Generator);
+			IsPassed &= Fraction >= 0.0 && Fraction < 1.0;
+		}
+
+		std::cout << "Lagged Fibonacci block: " << (IsPassed ? "passed" : "failed") << std::endl;
+	}
+
+	//Checks CMWC4096 against known answers, an exact-division recurrence and ComplementaryMultiplyWithCarry, and every lane of the multi-lane engines against a scalar one
+	//用已知答案, 精确除法的递推与 ComplementaryMultiplyWithCarry 检查 CMWC4096, 并用标量引擎检查多通道引擎的每个通道
+	inline void TestComplementaryMultiplyWithCarry4096()
+	{
+		bool IsPassed = true;
+
+		//Known answers of seed 1: the first four outputs, and the four that start the second round of the ring, where the lagged words are outputs and the carry has come all the way round
+		//种子 1 的已知答案: 前四个输出, 以及开始环的第二圈的四个输出, 这时被滞后读取的字都是输出, 进位也已绕环一周
+		ComplementaryMultiplyWithCarry32Bit4096 KnownAnswers(1);
+		IsPassed &= KnownAnswers() == 0xB3B77476UL && KnownAnswers() == 0x490CC04EUL && KnownAnswers() == 0xB3064B38UL && KnownAnswers() == 0x0EBE574AUL;
+		KnownAnswers.discard(ComplementaryMultiplyWithCarry32Bit4096::STATE_SIZE - 4);
+		IsPassed &= KnownAnswers() == 0xB26D58DFUL && KnownAnswers() == 0x8A7ADCEAUL && KnownAnswers() == 0x783D2131UL && KnownAnswers() == 0x4F37A14BUL;
+
+		//The carry as the exact quotient by 2^32 - 1 rather than the add-and-compare reduction, over three rounds of the ring from the documented seeding
+		//进位写成除以 2^32 - 1 的精确商, 而不是加法与比较的约简, 从文档中的播种开始走环的三圈
+		for (const std::uint64_t Seed : { 2ULL, 2024ULL })
+		{
+			constexpr std::uint64_t Base = 0xFFFFFFFFULL;
+			std::vector<std::uint32_t> Ring(ComplementaryMultiplyWithCarry32Bit4096::STATE_SIZE);
+			const std::uint64_t NewSeed = Linear_Congruential(Seed, 1);
+			Ring[0] = static_cast<std::uint32_t>(NewSeed);
+			Ring[1] = static_cast<std::uint32_t>(NewSeed >> 32);
+			for (std::uint32_t Index = 2; Index < Ring.size(); ++Index)
+				Ring[Index] = 0x6C078965UL * (Ring[Index - 1] ^ (Ring[Index - 2] >> 30)) + Index;
+			std::uint64_t Carry = ComplementaryMultiplyWithCarry32Bit4096::INITIAL_CARRY;
+
+			ComplementaryMultiplyWithCarry32Bit4096 Generator(Seed);
+			for (std::size_t Count = 0; Count < 3 * Ring.size(); ++Count)
+			{
+				std::uint32_t& Word = Ring[Count % Ring.size()];
+				const std::uint64_t Product = ComplementaryMultiplyWithCarry32Bit4096::MULTIPLIER * Word + Carry;
+				Carry = Product / Base;
+				Word = static_cast<std::uint32_t>(Base - 1 - Product % Base);
+				IsPassed &= Generator() == Word;
+			}
+		}
+
+		//The 32-bit engine against NumberGeneration32Bit, whose printing is sent nowhere; two rounds of the ring and a bit
+		//32 位引擎与 NumberGeneration32Bit 对照, 后者的打印被丢弃; 环的两圈多一点
+		std::ostringstream Discarded;
+		std::streambuf* const Previous = std::cout.rdbuf(Discarded.rdbuf());
+		for (const std::uint32_t Seed : { 1U, 2U, 2024U })
+		{
+			ComplementaryMultiplyWithCarry Legacy(Seed);
+			ComplementaryMultiplyWithCarry32Bit4096 Generator(Seed);
+			for (std::size_t Count = 0; Count < 2 * ComplementaryMultiplyWithCarry32Bit4096::STATE_SIZE + 100; ++Count)
+				IsPassed &= Generator() == Legacy.NumberGeneration32Bit(1);
+		}
+		std::cout.rdbuf(Previous);
+		std::cout << "CMWC4096 32-bit against ComplementaryMultiplyWithCarry: " << (IsPassed ? "passed" : "failed") << std::endl;
+
+		//fill and discard start part way round the ring, so their runs cross its end
+		//fill 与 discard 从环的中途开始, 所以它们的分段会跨过环的末尾
+		auto CheckEngine = [&IsPassed]<typename Engine>(std::string_view EngineName)
+		{
+			const bool IsEnginePassed = CheckEngineConformance<Engine>({ 0, 1, 1000, 2047, 4096, 5000, 10000 }, 1500);
+
+			std::cout << EngineName << ": " << (IsEnginePassed ? "passed" : "failed") << std::endl;
+			IsPassed &= IsEnginePassed;
+		};
+		CheckEngine.template operator()<ComplementaryMultiplyWithCarry32Bit4096>("ComplementaryMultiplyWithCarry32Bit4096");
+		CheckEngine.template operator()<ComplementaryMultiplyWithCarry64Bit4096>("ComplementaryMultiplyWithCarry64Bit4096");
+
+		//A 64-bit output is two consecutive 32-bit outputs, the first in the high half
+		//一个 64 位输出是两个连续的 32 位输出, 第一个在高半部分
+		ComplementaryMultiplyWithCarry32Bit4096 Words(5);
+		ComplementaryMultiplyWithCarry64Bit4096 Pairs(5);
+		for (std::size_t Count = 0; Count < 3000; ++Count)
+		{
+			const std::uint64_t High = Words();
+			IsPassed &= Pairs() == ((High << 32) | Words());
+		}
+
+		//Every lane is its own scalar stream, and lane() continues it
+		//每个通道都是各自的标量流, lane() 延续它
+		auto CheckLanes = [&IsPassed]<typename LanesType>(std::string_view LanesName)
+		{
+			using Generator = typename LanesType::Generator;
+			constexpr std::size_t LaneCount = LanesType::lane_count;
+			bool IsLanesPassed = true;
+
+			std::vector<Generator> Streams;
+			for (std::size_t Lane = 0; Lane < LaneCount; ++Lane)
+			{
+				Streams.emplace_back(3 + Lane);
+				Streams.back().discard(Lane * 1000);
+			}
+			auto Lanes = std::make_unique<LanesType>(std::span<const Generator, LaneCount>(Streams.data(), LaneCount));
+
+			std::vector<std::uint32_t> Values(5000 * LaneCount + 3);
+			Lanes->fill(Values);
+			for (std::size_t Index = 0; Index < Values.size(); ++Index)
+				IsLanesPassed &= Values[Index] == Streams[Index % LaneCount]();
+			for (std::size_t Lane = 3; Lane < LaneCount; ++Lane)
+				Streams[Lane]();
+			for (std::size_t Lane = 0; Lane < LaneCount; ++Lane)
+			{
+				//lane() keeps the ring rotated to the shared index, so compare outputs rather than the raw words
+				//lane() 的环保持按共用下标旋转, 所以比较输出而不是原始的字
+				Generator Continued = Lanes->lane(Lane);
+				for (std::size_t Count = 0; Count < Generator::STATE_SIZE + 10; ++Count)
+					IsLanesPassed &= Continued() == Streams[Lane]();
+			}
+
+			//Seeded with S, lane i is the scalar engine seeded with S + i, through more than two rounds of the ring
+			//以 S 播种时, 通道 i 就是以 S + i 播种的标量引擎, 走过环的两圈以上
+			auto Seeded = std::make_unique<LanesType>(std::uint64_t(9));
+			std::vector<Generator> Scalars;
+			for (std::size_t Lane = 0; Lane < LaneCount; ++Lane)
+				Scalars.emplace_back(9 + Lane);
+			const auto Block = (*Seeded)();
+			for (std::size_t Lane = 0; Lane < LaneCount; ++Lane)
+				IsLanesPassed &= Block[Lane] == Scalars[Lane]();
+			auto Interleaved = std::make_unique<LanesType>(*Seeded);
+			Values.assign(2 * Generator::STATE_SIZE * LaneCount + 5, 0);
+			Interleaved->fill(Values);
+			for (std::size_t Index = 0; Index < Values.size(); ++Index)
+				IsLanesPassed &= Values[Index] == Scalars[Index % LaneCount]();
+
+			auto Buffered = std::make_unique<LaneBufferedGenerator<LanesType>>(*Seeded);
+			auto Reference = std::make_unique<LanesType>(*Seeded);
+			for (std::size_t Count = 0; Count < 100; ++Count)
+			{
+				const auto Next = (*Reference)();
+				for (const auto Value : Next)
+					IsLanesPassed &= (*Buffered)() == Value;
+			}
+
+			std::cout << LanesName << ": " << (IsLanesPassed ? "passed" : "failed") << std::endl;
+			IsPassed &= IsLanesPassed;
+		};
+		CheckLanes.template operator()<cmwc4096x4>("cmwc4096x4");
+		CheckLanes.template operator()<cmwc4096x8>("cmwc4096x8");
+
+		std::cout << "CMWC4096: " << (IsPassed ? "passed" : "failed") << std::endl;
+	}
+}
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "../MainProgram/Support+Library/Support-Library.hpp"
+#include "PseudoRandomNumberGenerators.hpp"
 
 namespace CommonSecurity
 {
@@ -1024,15 +1025,13 @@ namespace CommonSecurity
 		operator()(RandomAccessIteratorType first, SentinelIteratorType last, RNG_Type&& functionRNG)
 		{
 			using iterator_difference_t = std::iter_difference_t<RandomAccessIteratorType>;
-			using number_distribution_t = RND::UniformIntegerDistribution<iterator_difference_t>;
-			using number_distribution_param_t = typename number_distribution_t::param_type;
 
-			number_distribution_t number_distribution_object;
 			const auto distance { last - first };
 
 			for(iterator_difference_t index{1}; index < distance; ++index)
 			{
-				std::ranges::iter_swap(first + index, first + number_distribution_object(functionRNG, number_distribution_param_t(0, index)));
+				const auto random_index = static_cast<iterator_difference_t>( PseudoRandomNumberGenerators::BoundedRandom( functionRNG, static_cast<std::uint64_t>( index ) + 1 ) );
+				std::ranges::iter_swap(first + index, first + random_index);
 			}
 			return std::ranges::next(first, last);
 		}
@@ -1051,7 +1050,7 @@ namespace CommonSecurity
 		{
 			for ( std::iter_difference_t<RandomAccessIteratorType> difference_value = end - begin - 1; difference_value >= 1; --difference_value )
 			{
-				std::size_t iterator_offset = functionRNG() % ( difference_value + 1 );
+				const auto iterator_offset = static_cast<std::iter_difference_t<RandomAccessIteratorType>>( PseudoRandomNumberGenerators::BoundedRandom( functionRNG, static_cast<std::uint64_t>( difference_value ) + 1 ) );
 				if ( iterator_offset != difference_value )
 				{
 					std::iter_swap( begin + iterator_offset, begin + difference_value );
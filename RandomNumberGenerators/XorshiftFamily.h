@@ -776,4 +776,446 @@ namespace PseudoRandomNumberGenerators::Xorshift
 		virtual ~XorShift1024Star() = default;
 	};
 
+	/*
+		Inline XorShift engines.
+		The classes above go through a virtual call per number and return only the last value of an Iterations run, so they cannot feed the <random> distributions directly.
+		XorShiftEngine runs the same recurrences as a standard uniform random bit generator: each algorithm below is a stateless policy with a state type, a Seed and a Next step,
+		and the engine around it adds operator(), discard, fill, seed and ==, all inline and without virtual dispatch.
+		A generator seeded with S gives exactly the sequence of the matching class constructed with S and called as NumberGeneration32Bit(1) / NumberGeneration64Bit(1).
+		The 128 to 1024 bit algorithms keep the rotated array of XorshiftWithExtraState as a ring with a moving start, so a step no longer moves the whole state.
+		内联的 XorShift 引擎。
+		上面的类每个数都要一次虚调用, 并且只返回 Iterations 次运行的最后一个值, 所以无法直接配合 <random> 的分布使用。
+		XorShiftEngine 以标准均匀随机位生成器的形式运行同样的递推: 下面每个算法都是无状态的策略, 提供状态类型, Seed 与 Next 一步,
+		外层引擎再加上 operator(), discard, fill, seed 与 ==, 全部内联, 没有虚分派。
+		用 S 播种的生成器给出的序列, 与用 S 构造并以 NumberGeneration32Bit(1) / NumberGeneration64Bit(1) 调用的对应类完全相同。
+		128 到 1024 位的算法把 XorshiftWithExtraState 中被轮转的数组保存为起点移动的环, 因此每一步不再移动整个状态。
+	*/
+	template<typename Algorithm>
+	concept XorShiftAlgorithm = requires(typename Algorithm::state_type& State, std::uint64_t Seed)
+	{
+		requires std::unsigned_integral<typename Algorithm::result_type>;
+		requires std::equality_comparable<typename Algorithm::state_type>;
+		{ Algorithm::Seed(Seed) } -> std::same_as<typename Algorithm::state_type>;
+		{ Algorithm::Next(State) } -> std::same_as<typename Algorithm::result_type>;
+		{ Algorithm::DISCARDED_ROUNDS } -> std::convertible_to<std::size_t>;
+	};
+
+	template<XorShiftAlgorithm Algorithm>
+	class XorShiftEngine : public UniformRandomBitGenerator<typename Algorithm::result_type>
+	{
+	public:
+		using result_type = typename Algorithm::result_type;
+		using state_type = typename Algorithm::state_type;
+
+		static constexpr std::uint64_t default_seed = 1;
+
+		constexpr XorShiftEngine()
+			: XorShiftEngine(default_seed)
+		{
+		}
+
+		explicit constexpr XorShiftEngine(std::uint64_t Seed)
+		{
+			this->seed(Seed);
+		}
+
+		constexpr void seed(std::uint64_t Seed = default_seed)
+		{
+			this->State = Algorithm::Seed(Seed);
+			this->discard(Algorithm::DISCARDED_ROUNDS);
+		}
+
+		constexpr result_type operator()()
+		{
+			return Algorithm::Next(this->State);
+		}
+
+		//The state is worked on in a local copy, so the compiler can keep it in registers instead of reloading it after every store to Values
+		//状态在局部副本上推进, 编译器因此可以把它留在寄存器里, 而不必在每次写入 Values 之后重新读取
+		constexpr void fill(std::span<result_type> Values)
+		{
+			state_type LocalState = this->State;
+			for (result_type& Value : Values)
+				Value = Algorithm::Next(LocalState);
+			this->State = LocalState;
+		}
+
+		constexpr void discard(unsigned long long Count)
+		{
+			state_type LocalState = this->State;
+			for (; Count > 0; --Count)
+				Algorithm::Next(LocalState);
+			this->State = LocalState;
+		}
+
+		constexpr const state_type& get_state() const
+		{
+			return this->State;
+		}
+
+		//Only the state counts, the UniformRandomBitGenerator base has nothing to compare
+		//只比较状态, UniformRandomBitGenerator 基类没有可比较的内容
+		friend constexpr bool operator==(const XorShiftEngine& Left, const XorShiftEngine& Right)
+		{
+			return Left.State == Right.State;
+		}
+
+	private:
+		state_type State {};
+	};
+
+	namespace Algorithms
+	{
+		//The same SplitMix64 as XorShift::SplitMix64
+		//与 XorShift::SplitMix64 相同的 SplitMix64
+		constexpr std::uint64_t SplitMix64(std::uint64_t Seed)
+		{
+			Seed += 0x9e3779b97f4a7c15;
+			Seed = (Seed ^ (Seed >> 30)) * 0xbf58476d1ce4e5b9;
+			Seed = (Seed ^ (Seed >> 27)) * 0x94d049bb133111eb;
+			return Seed ^ (Seed >> 31);
+		}
+
+		/* XorShift32Bit Algorithms */
+
+		//Marsaglia's 13, 17, 15 triple on one 32-bit word; Output maps the new state to the result and may write back to it (the ++ and ** variants do)
+		//Marsaglia 的 13, 17, 15 三元组, 作用于一个32位字; Output 把新状态映射为结果, 也可能写回状态 (++ 与 ** 变体如此)
+		template<typename OutputFunction>
+		struct XorShift32Bit
+		{
+			using result_type = std::uint32_t;
+			using state_type = std::uint32_t;
+
+			static constexpr std::size_t DISCARDED_ROUNDS = 0;
+
+			static constexpr state_type Seed(std::uint64_t Seed)
+			{
+				//A zero state would stay zero
+				//零状态会一直为零
+				const state_type State = static_cast<state_type>(SplitMix64(Seed) >> 32);
+				return State != 0 ? State : 1;
+			}
+
+			static constexpr result_type Next(state_type& State)
+			{
+				State ^= State << 13;
+				State ^= State >> 17;
+				State ^= State << 15;
+				return OutputFunction()(State);
+			}
+		};
+
+		struct XorShift32Output
+		{
+			constexpr std::uint32_t operator()(std::uint32_t& State) const { return State; }
+		};
+		struct XorShift32PlusOutput
+		{
+			constexpr std::uint32_t operator()(std::uint32_t& State) const { return State + 0x9E3779B9; }
+		};
+		struct XorShift32PlusPlusOutput
+		{
+			constexpr std::uint32_t operator()(std::uint32_t& State) const { State += 0x9E3779B9; return State + 0x9E3779B9; }
+		};
+		struct XorShift32StarOutput
+		{
+			constexpr std::uint32_t operator()(std::uint32_t& State) const { return State * 0x2545F491; }
+		};
+		struct XorShift32StarStarOutput
+		{
+			constexpr std::uint32_t operator()(std::uint32_t& State) const { State *= 0x2545F491; return State * 0x2545F491; }
+		};
+
+		/* XorShift64Bit Algorithms */
+
+		//Marsaglia's 16, 5, 17 triple on two 32-bit words; the result joins both words, State[1] in the upper half
+		//Marsaglia 的 16, 5, 17 三元组, 作用于两个32位字; 结果由两个字拼成, State[1] 在高半部分
+		template<typename OutputFunction>
+		struct XorShift64Bit
+		{
+			using result_type = std::uint64_t;
+			using state_type = std::array<std::uint32_t, 2>;
+
+			static constexpr std::size_t DISCARDED_ROUNDS = 0;
+
+			static constexpr state_type Seed(std::uint64_t Seed)
+			{
+				state_type State {};
+				State[0] = static_cast<std::uint32_t>(SplitMix64(Seed) >> 32);
+				State[1] = static_cast<std::uint32_t>(SplitMix64(State[0]) >> 32);
+				if (State[0] == 0 && State[1] == 0)
+					State[0] = 1;
+				return State;
+			}
+
+			static constexpr result_type Next(state_type& State)
+			{
+				const std::uint32_t TransformedState = State[0] ^ (State[0] << 16); //a
+				State[0] = State[1];
+				State[1] = (State[1] ^ (State[1] >> 17)) ^ (TransformedState ^ (TransformedState >> 5)); //c, b
+				return OutputFunction()(static_cast<std::uint64_t>(State[1]) << 32 | State[0], State);
+			}
+		};
+
+		struct XorShift64Output
+		{
+			constexpr std::uint64_t operator()(std::uint64_t Joined, const std::array<std::uint32_t, 2>&) const { return Joined; }
+		};
+		struct XorShift64PlusOutput
+		{
+			constexpr std::uint64_t operator()(std::uint64_t Joined, const std::array<std::uint32_t, 2>&) const { return Joined + 0x9E3779B97F4A7C15; }
+		};
+		struct XorShift64PlusPlusOutput
+		{
+			constexpr std::uint64_t operator()(std::uint64_t Joined, const std::array<std::uint32_t, 2>& State) const
+			{
+				return Joined + (static_cast<std::uint64_t>(State[1]) + State[0]) + 0x9E3779B97F4A7C15;
+			}
+		};
+		struct XorShift64StarOutput
+		{
+			constexpr std::uint64_t operator()(std::uint64_t Joined, const std::array<std::uint32_t, 2>&) const { return Joined * 0x2545F4914F6CDD1D; }
+		};
+		struct XorShift64StarStarOutput
+		{
+			constexpr std::uint64_t operator()(std::uint64_t Joined, const std::array<std::uint32_t, 2>& State) const
+			{
+				return Joined * (static_cast<std::uint64_t>(State[1]) * State[0]) * 0x2545F4914F6CDD1D;
+			}
+		};
+
+		/* XorShift(128/256/512/1024)Bit Algorithms */
+
+		//StateWords 64-bit words and the index of the next one, seeded as a SplitMix64 chain like ResetState
+		//StateWords 个64位字和下一个字的下标, 与 ResetState 一样用 SplitMix64 链播种
+		template<std::size_t StateWords>
+		struct RingState
+		{
+			static_assert(std::has_single_bit(StateWords), "");
+
+			std::array<std::uint64_t, StateWords> Words {};
+			std::uint32_t Index = 0;
+
+			static constexpr RingState Seed(std::uint64_t Seed)
+			{
+				RingState State;
+				State.Words[0] = SplitMix64(Seed != 0 ? Seed : 1);
+				for (std::size_t Word = 0; Word + 1 < StateWords; ++Word)
+					State.Words[Word + 1] = SplitMix64(State.Words[Word]);
+				return State;
+			}
+
+			constexpr bool operator==(const RingState&) const = default;
+		};
+
+		//XorshiftWithExtraState: the first word is transformed and rotated to the back. Index is where the logical array starts, so the rotation is Index + 1
+		//XorshiftWithExtraState: 第一个字变换后被轮转到末尾。Index 是逻辑数组的起点, 所以轮转就是 Index + 1
+		template<std::size_t StateWords>
+		struct XorShiftWithExtraState
+		{
+			using result_type = std::uint64_t;
+			using state_type = RingState<StateWords>;
+
+			static constexpr std::size_t DISCARDED_ROUNDS = 128;
+
+			static constexpr state_type Seed(std::uint64_t Seed) { return state_type::Seed(Seed); }
+
+			static constexpr result_type Next(state_type& State)
+			{
+				//a, b, c == 31, 11, 10
+				std::uint64_t& First = State.Words[State.Index];
+				const std::uint64_t TransformedState = First ^ (First << 31);
+				First = (First ^ First >> 10) ^ (TransformedState ^ (TransformedState >> 11)) * static_cast<std::uint64_t>(0x106689D45497FDB5);
+				State.Index = (State.Index + 1) & (StateWords - 1);
+				return First;
+			}
+		};
+
+		//XorshiftStarWithExtraState, with a mask in place of the % on the index
+		//XorshiftStarWithExtraState, 下标上的 % 换成了掩码
+		template<std::size_t StateWords>
+		struct XorShiftStarWithExtraState
+		{
+			using result_type = std::uint64_t;
+			using state_type = RingState<StateWords>;
+
+			static constexpr std::size_t DISCARDED_ROUNDS = 128;
+
+			static constexpr state_type Seed(std::uint64_t Seed) { return state_type::Seed(Seed); }
+
+			static constexpr result_type Next(state_type& State)
+			{
+				//a, b, c == 31, 11, 10
+				std::uint64_t A = State.Words[State.Index];
+				State.Index = (State.Index + 1) & (StateWords - 1);
+				std::uint64_t B = State.Words[State.Index];
+
+				B ^= B << 31;
+				B ^= B >> 11;
+				A ^= A >> 10;
+
+				State.Words[State.Index] = A ^ B;
+				return State.Words[State.Index] * static_cast<std::uint64_t>(0x106689D45497FDB5);
+			}
+		};
+	}
+
+	using xorshift32 = XorShiftEngine<Algorithms::XorShift32Bit<Algorithms::XorShift32Output>>;
+	using xorshift32plus = XorShiftEngine<Algorithms::XorShift32Bit<Algorithms::XorShift32PlusOutput>>;
+	using xorshift32plusplus = XorShiftEngine<Algorithms::XorShift32Bit<Algorithms::XorShift32PlusPlusOutput>>;
+	using xorshift32star = XorShiftEngine<Algorithms::XorShift32Bit<Algorithms::XorShift32StarOutput>>;
+	using xorshift32starstar = XorShiftEngine<Algorithms::XorShift32Bit<Algorithms::XorShift32StarStarOutput>>;
+
+	using xorshift64 = XorShiftEngine<Algorithms::XorShift64Bit<Algorithms::XorShift64Output>>;
+	using xorshift64plus = XorShiftEngine<Algorithms::XorShift64Bit<Algorithms::XorShift64PlusOutput>>;
+	using xorshift64plusplus = XorShiftEngine<Algorithms::XorShift64Bit<Algorithms::XorShift64PlusPlusOutput>>;
+	using xorshift64star = XorShiftEngine<Algorithms::XorShift64Bit<Algorithms::XorShift64StarOutput>>;
+	using xorshift64starstar = XorShiftEngine<Algorithms::XorShift64Bit<Algorithms::XorShift64StarStarOutput>>;
+
+	using xorshift128 = XorShiftEngine<Algorithms::XorShiftWithExtraState<2>>;
+	using xorshift128star = XorShiftEngine<Algorithms::XorShiftStarWithExtraState<2>>;
+	using xorshift256 = XorShiftEngine<Algorithms::XorShiftWithExtraState<4>>;
+	using xorshift256star = XorShiftEngine<Algorithms::XorShiftStarWithExtraState<4>>;
+	using xorshift512 = XorShiftEngine<Algorithms::XorShiftWithExtraState<8>>;
+	using xorshift512star = XorShiftEngine<Algorithms::XorShiftStarWithExtraState<8>>;
+	using xorshift1024 = XorShiftEngine<Algorithms::XorShiftWithExtraState<16>>;
+	using xorshift1024star = XorShiftEngine<Algorithms::XorShiftStarWithExtraState<16>>;
+
+	static_assert(std::uniform_random_bit_generator<xorshift32> && std::uniform_random_bit_generator<xorshift64starstar> && std::uniform_random_bit_generator<xorshift1024star>);
+
+}
+
+namespace PseudoRandomNumberGenerators
+{
+	inline void TestXorShiftEngines()
+	{
+		using namespace Xorshift;
+
+		bool IsPassed = true;
+
+		//Every engine against its class, then the shared fill, discard and seed checks
+		//每个引擎先与对应的类对照, 再做共用的 fill, discard 与 seed 检查
+		auto CheckEngine = [&IsPassed]<typename Engine, typename LegacyClass>(std::string_view EngineName, auto NumberGeneration)
+		{
+			bool IsEnginePassed = true;
+
+			for (const std::uint32_t Seed : { 0U, 1U, 2024U })
+			{
+				Engine Generator(Seed);
+				LegacyClass Legacy(Seed);
+				for (std::size_t Count = 0; Count < 1000; ++Count)
+					IsEnginePassed &= Generator() == NumberGeneration(Legacy);
+			}
+
+			IsEnginePassed &= CheckEngineConformance<Engine>({ 0, 1, 500, 777 });
+
+			std::cout << EngineName << ": " << (IsEnginePassed ? "passed" : "failed") << std::endl;
+			IsPassed &= IsEnginePassed;
+		};
+		auto Call32Bit = [](auto& Legacy) { return Legacy.NumberGeneration32Bit(1); };
+		auto Call64Bit = [](auto& Legacy) { return Legacy.NumberGeneration64Bit(1); };
+
+		CheckEngine.template operator()<xorshift32, XorShift32>("xorshift32", Call32Bit);
+		CheckEngine.template operator()<xorshift32plus, XorShift32Plus>("xorshift32plus", Call32Bit);
+		CheckEngine.template operator()<xorshift32plusplus, XorShift32PlusPlus>("xorshift32plusplus", Call32Bit);
+		CheckEngine.template operator()<xorshift32star, XorShift32Star>("xorshift32star", Call32Bit);
+		CheckEngine.template operator()<xorshift32starstar, XorShift32StarStar>("xorshift32starstar", Call32Bit);
+		CheckEngine.template operator()<xorshift64, XorShift64>("xorshift64", Call64Bit);
+		CheckEngine.template operator()<xorshift64plus, XorShift64Plus>("xorshift64plus", Call64Bit);
+		CheckEngine.template operator()<xorshift64plusplus, XorShift64PlusPlus>("xorshift64plusplus", Call64Bit);
+		CheckEngine.template operator()<xorshift64star, XorShift64Star>("xorshift64star", Call64Bit);
+		CheckEngine.template operator()<xorshift64starstar, XorShift64StarStar>("xorshift64starstar", Call64Bit);
+		CheckEngine.template operator()<xorshift128, XorShift128>("xorshift128", Call64Bit);
+		CheckEngine.template operator()<xorshift128star, XorShift128Star>("xorshift128star", Call64Bit);
+		CheckEngine.template operator()<xorshift256, XorShift256>("xorshift256", Call64Bit);
+		CheckEngine.template operator()<xorshift256star, XorShift256Star>("xorshift256star", Call64Bit);
+		CheckEngine.template operator()<xorshift512, XorShift512>("xorshift512", Call64Bit);
+		CheckEngine.template operator()<xorshift512star, XorShift512Star>("xorshift512star", Call64Bit);
+		CheckEngine.template operator()<xorshift1024, XorShift1024>("xorshift1024", Call64Bit);
+		CheckEngine.template operator()<xorshift1024star, XorShift1024Star>("xorshift1024star", Call64Bit);
+
+		//Each step against its shift triple written out on the state: 13, 17, 15 on one word, 16, 5, 17 on two words, and 31, 11, 10 around the ring
+		//每一步与直接作用在状态上的移位三元组对照: 一个字上的 13, 17, 15, 两个字上的 16, 5, 17, 以及环上的 31, 11, 10
+		xorshift32 Word(2024);
+		for (std::size_t Count = 0; Count < 100; ++Count)
+		{
+			std::uint32_t State = Word.get_state();
+			State ^= State << 13;
+			State ^= State >> 17;
+			State ^= State << 15;
+			IsPassed &= Word() == State && Word.get_state() == State;
+		}
+
+		xorshift64 Pair(2024);
+		for (std::size_t Count = 0; Count < 100; ++Count)
+		{
+			auto [Low, High] = Pair.get_state();
+			std::uint32_t Transformed = Low ^ (Low << 16);
+			Transformed ^= Transformed >> 5;
+			Low = High;
+			High ^= (High >> 17) ^ Transformed;
+			IsPassed &= Pair() == (static_cast<std::uint64_t>(High) << 32 | Low) && Pair.get_state() == std::array { Low, High };
+		}
+
+		//StateWords + 3 steps, so the index wraps around the ring
+		//走 StateWords + 3 步, 下标因此绕过环的末尾
+		auto CheckRing = [&IsPassed]<typename Engine, bool IsStar>()
+		{
+			constexpr std::size_t StateWords = std::tuple_size_v<decltype(Engine().get_state().Words)>;
+			Engine Generator(2024);
+			for (std::size_t Count = 0; Count < StateWords + 3; ++Count)
+			{
+				auto [Words, Index] = Generator.get_state();
+				std::uint64_t Expected = 0;
+				if constexpr (IsStar)
+				{
+					std::uint64_t A = Words[Index];
+					Index = (Index + 1) % StateWords;
+					std::uint64_t B = Words[Index];
+					B ^= B << 31;
+					B ^= B >> 11;
+					A ^= A >> 10;
+					Words[Index] = A ^ B;
+					Expected = Words[Index] * 0x106689D45497FDB5ULL;
+				}
+				else
+				{
+					std::uint64_t B = Words[Index];
+					B ^= B << 31;
+					B ^= B >> 11;
+					Words[Index] = (Words[Index] ^ (Words[Index] >> 10)) ^ B * 0x106689D45497FDB5ULL;
+					Expected = Words[Index];
+					Index = (Index + 1) % StateWords;
+				}
+				IsPassed &= Generator() == Expected && Generator.get_state().Words == Words && Generator.get_state().Index == Index;
+			}
+		};
+		CheckRing.template operator()<xorshift128, false>();
+		CheckRing.template operator()<xorshift128star, true>();
+		CheckRing.template operator()<xorshift1024, false>();
+		CheckRing.template operator()<xorshift1024star, true>();
+
+		//The engines plug straight into the <random> distributions
+		//引擎可以直接用于 <random> 的分布
+		xorshift1024star Generator(5);
+		std::uniform_int_distribution<int> Dice(1, 6);
+		std::uniform_real_distribution<double> Unit(0.0, 1.0);
+		for (std::size_t Count = 0; Count < 1000; ++Count)
+		{
+			const int Face = Dice(Generator);
+			const double Fraction = Unit(Generator);
+			IsPassed &= Face >= 1 && Face <= 6 && Fraction >= 0.0 && Fraction < 1.0;
+		}
+
+		//Evaluated at compile time as well
+		//也可以在编译期求值
+		static_assert([]
+		{
+			xorshift128star Engine(3);
+			Engine.discard(10);
+			return Engine() != 0;
+		}());
+
+		std::cout << "XorShift engines: " << (IsPassed ? "passed" : "failed") << std::endl;
+	}
 }
\ No newline at end of file
@@ -0,0 +1,111 @@
+#include "./PseudoRandomNumberGenerators.hpp"
+#include "./XoshiroKernels.h"
+
+namespace PseudoRandomNumberGenerators
+{
+	namespace
+	{
+		using CommonToolkit::CPU_FeatureDispatch::CPU_Feature;
+		using CommonToolkit::CPU_FeatureDispatch::NoFeatures;
+
+		//Each lane in turn through the scalar engine itself, so the lanes match xorshiro256 / xorshiro512 by construction
+		//依次用标量引擎本身推进每个通道, 因此各通道自然与 xorshiro256 / xorshiro512 一致
+		template<typename ScalarEngine, std::size_t LaneCount>
+		void GeneratePortable(std::uint64_t* State, std::uint64_t* Values, std::size_t Steps)
+		{
+			constexpr std::size_t StateWords = ScalarEngine::num_state_words;
+
+			for (std::size_t Lane = 0; Lane < LaneCount; ++Lane)
+			{
+				typename ScalarEngine::state_type Words {};
+				for (std::size_t Word = 0; Word < StateWords; ++Word)
+					Words[Word] = State[Word * LaneCount + Lane];
+
+				ScalarEngine Engine;
+				Engine.set_state(Words);
+				for (std::size_t Step = 0; Step < Steps; ++Step)
+					Values[Step * LaneCount + Lane] = Engine();
+
+				for (std::size_t Word = 0; Word < StateWords; ++Word)
+					State[Word * LaneCount + Lane] = Engine.get_state()[Word];
+			}
+		}
+
+		#if defined(APPLIED_CRYPTOGRAPHY_HAS_AVX512_KERNELS)
+		constexpr XorshiroLanesKernels<xorshiro256, 8> Xorshiro256x8KernelsAVX512 { "avx512", static_cast<std::uint32_t>(CPU_Feature::AVX512F), &XoshiroKernels::Xoshiro256StarStar8LanesAVX512 };
+		constexpr XorshiroLanesKernels<xorshiro512, 8> Xorshiro512x8KernelsAVX512 { "avx512", static_cast<std::uint32_t>(CPU_Feature::AVX512F), &XoshiroKernels::Xoshiro512StarStar8LanesAVX512 };
+		#endif
+		#if defined(APPLIED_CRYPTOGRAPHY_HAS_AVX2_KERNELS)
+		constexpr XorshiroLanesKernels<xorshiro256, 4> Xorshiro256x4KernelsAVX2 { "avx2", static_cast<std::uint32_t>(CPU_Feature::AVX2), &XoshiroKernels::Xoshiro256StarStar4LanesAVX2 };
+		constexpr XorshiroLanesKernels<xorshiro256, 8> Xorshiro256x8KernelsAVX2 { "avx2", static_cast<std::uint32_t>(CPU_Feature::AVX2), &XoshiroKernels::Xoshiro256StarStar8LanesAVX2 };
+		constexpr XorshiroLanesKernels<xorshiro512, 4> Xorshiro512x4KernelsAVX2 { "avx2", static_cast<std::uint32_t>(CPU_Feature::AVX2), &XoshiroKernels::Xoshiro512StarStar4LanesAVX2 };
+		constexpr XorshiroLanesKernels<xorshiro512, 8> Xorshiro512x8KernelsAVX2 { "avx2", static_cast<std::uint32_t>(CPU_Feature::AVX2), &XoshiroKernels::Xoshiro512StarStar8LanesAVX2 };
+		#endif
+		constexpr XorshiroLanesKernels<xorshiro256, 4> Xorshiro256x4KernelsPortable { "portable", NoFeatures, &GeneratePortable<xorshiro256, 4> };
+		constexpr XorshiroLanesKernels<xorshiro256, 8> Xorshiro256x8KernelsPortable { "portable", NoFeatures, &GeneratePortable<xorshiro256, 8> };
+		constexpr XorshiroLanesKernels<xorshiro512, 4> Xorshiro512x4KernelsPortable { "portable", NoFeatures, &GeneratePortable<xorshiro512, 4> };
+		constexpr XorshiroLanesKernels<xorshiro512, 8> Xorshiro512x8KernelsPortable { "portable", NoFeatures, &GeneratePortable<xorshiro512, 8> };
+
+		constexpr const XorshiroLanesKernels<xorshiro256, 4>* Xorshiro256x4KernelCandidates[] =
+		{
+			#if defined(APPLIED_CRYPTOGRAPHY_HAS_AVX2_KERNELS)
+			&Xorshiro256x4KernelsAVX2,
+			#endif
+			&Xorshiro256x4KernelsPortable,
+		};
+
+		constexpr const XorshiroLanesKernels<xorshiro256, 8>* Xorshiro256x8KernelCandidates[] =
+		{
+			#if defined(APPLIED_CRYPTOGRAPHY_HAS_AVX512_KERNELS)
+			&Xorshiro256x8KernelsAVX512,
+			#endif
+			#if defined(APPLIED_CRYPTOGRAPHY_HAS_AVX2_KERNELS)
+			&Xorshiro256x8KernelsAVX2,
+			#endif
+			&Xorshiro256x8KernelsPortable,
+		};
+
+		constexpr const XorshiroLanesKernels<xorshiro512, 4>* Xorshiro512x4KernelCandidates[] =
+		{
+			#if defined(APPLIED_CRYPTOGRAPHY_HAS_AVX2_KERNELS)
+			&Xorshiro512x4KernelsAVX2,
+			#endif
+			&Xorshiro512x4KernelsPortable,
+		};
+
+		constexpr const XorshiroLanesKernels<xorshiro512, 8>* Xorshiro512x8KernelCandidates[] =
+		{
+			#if defined(APPLIED_CRYPTOGRAPHY_HAS_AVX512_KERNELS)
+			&Xorshiro512x8KernelsAVX512,
+			#endif
+			#if defined(APPLIED_CRYPTOGRAPHY_HAS_AVX2_KERNELS)
+			&Xorshiro512x8KernelsAVX2,
+			#endif
+			&Xorshiro512x8KernelsPortable,
+		};
+	}
+
+	template<>
+	std::span<const XorshiroLanesKernels<xorshiro256, 4>* const> xorshiro256x4::KernelCandidates()
+	{
+		return Xorshiro256x4KernelCandidates;
+	}
+
+	template<>
+	std::span<const XorshiroLanesKernels<xorshiro256, 8>* const> xorshiro256x8::KernelCandidates()
+	{
+		return Xorshiro256x8KernelCandidates;
+	}
+
+	template<>
+	std::span<const XorshiroLanesKernels<xorshiro512, 4>* const> xorshiro512x4::KernelCandidates()
+	{
+		return Xorshiro512x4KernelCandidates;
+	}
+
+	template<>
+	std::span<const XorshiroLanesKernels<xorshiro512, 8>* const> xorshiro512x8::KernelCandidates()
+	{
+		return Xorshiro512x8KernelCandidates;
+	}
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+/*
+	Multi-lane kernels of xoshiro256** and xoshiro512** (xorshiro256 / xorshiro512), one translation unit per instruction set (Xoshiro_<instruction set>.cpp).
+	Those files are compiled with their own instruction set flags, so this header only declares plain functions.
+	The lane states are stored word-major, word w of lane l at State[w * Lanes + l], so each state word of all lanes is one (or two) vector registers;
+	a kernel runs Steps steps of every lane and writes the output of step s in lane l to Values[s * Lanes + l].
+	The ** scrambler needs only * 5 and * 9, which are shift-and-add, so no 64-bit vector multiplication is required.
+	xoshiro256** 与 xoshiro512** (xorshiro256 / xorshiro512) 的多通道内核, 每个指令集一个翻译单元 (Xoshiro_<指令集>.cpp)。
+	这些文件用各自指令集的选项编译, 所以本头文件只声明普通函数。
+	通道状态按字优先存放, 通道 l 的第 w 个字位于 State[w * Lanes + l], 因此所有通道的同一个状态字正好是一个 (或两个) 向量寄存器;
+	内核让每个通道运行 Steps 步, 并把通道 l 第 s 步的输出写到 Values[s * Lanes + l]。
+	** 扰乱函数只需要 * 5 与 * 9, 都是移位加法, 因此不需要 64 位向量乘法。
+*/
+namespace PseudoRandomNumberGenerators::XoshiroKernels
+{
+	//4 lanes, one 256-bit vector per state word
+	//4 个通道, 每个状态字一个 256 位向量
+	void Xoshiro256StarStar4LanesAVX2(std::uint64_t* State, std::uint64_t* Values, std::size_t Steps);
+	void Xoshiro512StarStar4LanesAVX2(std::uint64_t* State, std::uint64_t* Values, std::size_t Steps);
+
+	//8 lanes, two 256-bit vectors per state word, stepped together to hide the latency of each dependency chain
+	//8 个通道, 每个状态字两个 256 位向量, 一起推进以掩盖各条依赖链的延迟
+	void Xoshiro256StarStar8LanesAVX2(std::uint64_t* State, std::uint64_t* Values, std::size_t Steps);
+	void Xoshiro512StarStar8LanesAVX2(std::uint64_t* State, std::uint64_t* Values, std::size_t Steps);
+
+	//8 lanes, one 512-bit vector per state word
+	//8 个通道, 每个状态字一个 512 位向量
+	void Xoshiro256StarStar8LanesAVX512(std::uint64_t* State, std::uint64_t* Values, std::size_t Steps);
+	void Xoshiro512StarStar8LanesAVX512(std::uint64_t* State, std::uint64_t* Values, std::size_t Steps);
+}
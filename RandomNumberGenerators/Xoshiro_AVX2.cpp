@@ -0,0 +1,101 @@
+#include "XoshiroKernels.h"
+
+#include <immintrin.h>
+
+namespace PseudoRandomNumberGenerators::XoshiroKernels
+{
+	namespace
+	{
+		constexpr std::size_t VectorLanes = 4;
+
+		template<unsigned Shift>
+		__m256i RotateLeft(__m256i Value)
+		{
+			return _mm256_or_si256(_mm256_slli_epi64(Value, Shift), _mm256_srli_epi64(Value, 64 - Shift));
+		}
+
+		//rotl(s[1] * 5, 7) * 9, with x * 5 = x + (x << 2) and x * 9 = x + (x << 3)
+		//rotl(s[1] * 5, 7) * 9, 其中 x * 5 = x + (x << 2), x * 9 = x + (x << 3)
+		__m256i Scramble(__m256i Word)
+		{
+			const __m256i Rotated = RotateLeft<7>(_mm256_add_epi64(Word, _mm256_slli_epi64(Word, 2)));
+			return _mm256_add_epi64(Rotated, _mm256_slli_epi64(Rotated, 3));
+		}
+
+		//One step of every lane in the vectors, the same word operations as xorshiro256 / xorshiro512::operator()
+		//向量中每个通道走一步, 字运算与 xorshiro256 / xorshiro512::operator() 相同
+		template<std::size_t StateWords>
+		void StepState(__m256i (&S)[StateWords])
+		{
+			if constexpr (StateWords == 4)
+			{
+				const __m256i T = _mm256_slli_epi64(S[1], 17);
+				S[2] = _mm256_xor_si256(S[2], S[0]);
+				S[3] = _mm256_xor_si256(S[3], S[1]);
+				S[1] = _mm256_xor_si256(S[1], S[2]);
+				S[0] = _mm256_xor_si256(S[0], S[3]);
+				S[2] = _mm256_xor_si256(S[2], T);
+				S[3] = RotateLeft<45>(S[3]);
+			}
+			else
+			{
+				const __m256i T = _mm256_slli_epi64(S[1], 11);
+				S[2] = _mm256_xor_si256(S[2], S[0]);
+				S[5] = _mm256_xor_si256(S[5], S[1]);
+				S[1] = _mm256_xor_si256(S[1], S[2]);
+				S[7] = _mm256_xor_si256(S[7], S[3]);
+				S[3] = _mm256_xor_si256(S[3], S[4]);
+				S[4] = _mm256_xor_si256(S[4], S[5]);
+				S[0] = _mm256_xor_si256(S[0], S[6]);
+				S[6] = _mm256_xor_si256(S[6], S[7]);
+				S[6] = _mm256_xor_si256(S[6], T);
+				S[7] = RotateLeft<21>(S[7]);
+			}
+		}
+
+		//Groups vectors of lanes, loaded into registers once per call
+		//Groups 个通道向量, 每次调用只载入寄存器一次
+		template<std::size_t StateWords, std::size_t Groups>
+		void Generate(std::uint64_t* State, std::uint64_t* Values, std::size_t Steps)
+		{
+			constexpr std::size_t Lanes = VectorLanes * Groups;
+
+			__m256i Words[Groups][StateWords];
+			for (std::size_t Group = 0; Group < Groups; ++Group)
+				for (std::size_t Word = 0; Word < StateWords; ++Word)
+					Words[Group][Word] = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(State + Word * Lanes + Group * VectorLanes));
+
+			for (std::size_t Step = 0; Step < Steps; ++Step)
+			{
+				for (std::size_t Group = 0; Group < Groups; ++Group)
+					_mm256_storeu_si256(reinterpret_cast<__m256i*>(Values + Step * Lanes + Group * VectorLanes), Scramble(Words[Group][1]));
+				for (std::size_t Group = 0; Group < Groups; ++Group)
+					StepState(Words[Group]);
+			}
+
+			for (std::size_t Group = 0; Group < Groups; ++Group)
+				for (std::size_t Word = 0; Word < StateWords; ++Word)
+					_mm256_storeu_si256(reinterpret_cast<__m256i*>(State + Word * Lanes + Group * VectorLanes), Words[Group][Word]);
+		}
+	}
+
+	void Xoshiro256StarStar4LanesAVX2(std::uint64_t* State, std::uint64_t* Values, std::size_t Steps)
+	{
+		Generate<4, 1>(State, Values, Steps);
+	}
+
+	void Xoshiro512StarStar4LanesAVX2(std::uint64_t* State, std::uint64_t* Values, std::size_t Steps)
+	{
+		Generate<8, 1>(State, Values, Steps);
+	}
+
+	void Xoshiro256StarStar8LanesAVX2(std::uint64_t* State, std::uint64_t* Values, std::size_t Steps)
+	{
+		Generate<4, 2>(State, Values, Steps);
+	}
+
+	void Xoshiro512StarStar8LanesAVX2(std::uint64_t* State, std::uint64_t* Values, std::size_t Steps)
+	{
+		Generate<8, 2>(State, Values, Steps);
+	}
+}
@@ -0,0 +1,75 @@
+#include "XoshiroKernels.h"
+
+#include <immintrin.h>
+
+//The same steps as Xoshiro_AVX2.cpp, 8 lanes per vector and a native rotate
+//与 Xoshiro_AVX2.cpp 相同的步骤, 每个向量 8 个通道, 并使用原生循环移位
+namespace PseudoRandomNumberGenerators::XoshiroKernels
+{
+	namespace
+	{
+		constexpr std::size_t Lanes = 8;
+
+		__m512i Scramble(__m512i Word)
+		{
+			const __m512i Rotated = _mm512_rol_epi64(_mm512_add_epi64(Word, _mm512_slli_epi64(Word, 2)), 7);
+			return _mm512_add_epi64(Rotated, _mm512_slli_epi64(Rotated, 3));
+		}
+
+		template<std::size_t StateWords>
+		void StepState(__m512i (&S)[StateWords])
+		{
+			if constexpr (StateWords == 4)
+			{
+				const __m512i T = _mm512_slli_epi64(S[1], 17);
+				S[2] = _mm512_xor_si512(S[2], S[0]);
+				S[3] = _mm512_xor_si512(S[3], S[1]);
+				S[1] = _mm512_xor_si512(S[1], S[2]);
+				S[0] = _mm512_xor_si512(S[0], S[3]);
+				S[2] = _mm512_xor_si512(S[2], T);
+				S[3] = _mm512_rol_epi64(S[3], 45);
+			}
+			else
+			{
+				const __m512i T = _mm512_slli_epi64(S[1], 11);
+				S[2] = _mm512_xor_si512(S[2], S[0]);
+				S[5] = _mm512_xor_si512(S[5], S[1]);
+				S[1] = _mm512_xor_si512(S[1], S[2]);
+				S[7] = _mm512_xor_si512(S[7], S[3]);
+				S[3] = _mm512_xor_si512(S[3], S[4]);
+				S[4] = _mm512_xor_si512(S[4], S[5]);
+				S[0] = _mm512_xor_si512(S[0], S[6]);
+				S[6] = _mm512_xor_si512(S[6], S[7]);
+				S[6] = _mm512_xor_si512(S[6], T);
+				S[7] = _mm512_rol_epi64(S[7], 21);
+			}
+		}
+
+		template<std::size_t StateWords>
+		void Generate(std::uint64_t* State, std::uint64_t* Values, std::size_t Steps)
+		{
+			__m512i Words[StateWords];
+			for (std::size_t Word = 0; Word < StateWords; ++Word)
+				Words[Word] = _mm512_loadu_si512(State + Word * Lanes);
+
+			for (std::size_t Step = 0; Step < Steps; ++Step)
+			{
+				_mm512_storeu_si512(Values + Step * Lanes, Scramble(Words[1]));
+				StepState(Words);
+			}
+
+			for (std::size_t Word = 0; Word < StateWords; ++Word)
+				_mm512_storeu_si512(State + Word * Lanes, Words[Word]);
+		}
+	}
+
+	void Xoshiro256StarStar8LanesAVX512(std::uint64_t* State, std::uint64_t* Values, std::size_t Steps)
+	{
+		Generate<4>(State, Values, Steps);
+	}
+
+	void Xoshiro512StarStar8LanesAVX512(std::uint64_t* State, std::uint64_t* Values, std::size_t Steps)
+	{
+		Generate<8>(State, Values, Steps);
+	}
+}
@@ -17,7 +17,7 @@ namespace StreamDataCryption::AlgorithmSample
 
 		//Advanced encryption/decryption standard byte substitution box
 		//高级加密/解密标准的字节替换盒
-		std::array<std::uint8_t, 256> AES_BOX
+		static constexpr std::array<std::uint8_t, 256> AES_BOX
 		{
 			0x63, 0x7C, 0x77, 0x7B, 0xF2, 0x6B, 0x6F, 0xC5, 0x30, 0x01, 0x67, 0x2B, 0xFE, 0xD7, 0xAB, 0x76,
 			0xCA, 0x82, 0xC9, 0x7D, 0xFA, 0x59, 0x47, 0xF0, 0xAD, 0xD4, 0xA2, 0xAF, 0x9C, 0xA4, 0x72, 0xC0,
@@ -37,6 +37,16 @@ namespace StreamDataCryption::AlgorithmSample
 			0x8C, 0xA1, 0x89, 0x0D, 0xBF, 0xE6, 0x42, 0x68, 0x41, 0x99, 0x2D, 0x0F, 0xB0, 0x54, 0xBB, 0x16
 		};
 
+		//AES_BOX[AES_BOX[Byte]], one lookup per byte
+		//两次替换合并成一个表
+		static constexpr std::array<std::uint8_t, 256> DOUBLE_AES_BOX = []()
+		{
+			std::array<std::uint8_t, 256> Box {};
+			for (std::size_t Index = 0; Index < Box.size(); ++Index)
+				Box[Index] = AES_BOX[AES_BOX[Index]];
+			return Box;
+		}();
+
 		//Generate pseudo-random numbers
 		//生成伪随机数
 		void GenerateDataWithPRNG(std::span<std::uint64_t> Datas)
@@ -49,87 +59,110 @@ namespace StreamDataCryption::AlgorithmSample
 		//字节替换 (非线性函数/混淆)
 		std::uint8_t ByteSubtition(std::uint8_t Byte)
 		{
-			Byte = AES_BOX[AES_BOX[Byte]];
+			return DOUBLE_AES_BOX[Byte];
+		}
+
+		//Pseudo-hadamard transform, forward on words 0 and 1, backward on words 2 and 3 of every group of four
+		//伪哈达玛德变换, 每4个字一组: 前两个正向, 后两个反向
+		void PseudoHadamardTransform(std::span<std::uint64_t> Datas)
+		{
+			//Plain loop over the groups so the compiler can vectorize it
+			//普通循环, 便于编译器向量化
+			std::uint64_t* Words = Datas.data();
+			for (std::size_t OffsetIndex = 0; OffsetIndex + 4 <= Datas.size(); OffsetIndex += 4)
+			{
+				const std::uint64_t Word0 = Words[OffsetIndex], Word1 = Words[OffsetIndex + 1], Word2 = Words[OffsetIndex + 2], Word3 = Words[OffsetIndex + 3];
+
+				Words[OffsetIndex] = Word0 + Word1;
+				Words[OffsetIndex + 1] = Word0 + 2 * Word1;
+				Words[OffsetIndex + 2] = Word3 - Word2;
+				Words[OffsetIndex + 3] = 2 * Word2 - Word3;
+			}
+		}
 
-			return Byte;
+		//Substitutes every byte of every word in place
+		//替换每个字的每个字节
+		void SubstituteBytes(std::span<std::uint64_t> Datas)
+		{
+			for (auto& Data : Datas)
+			{
+				std::uint64_t Bit64 = 0;
+				for (std::size_t ByteIndex = 0; ByteIndex < 8; ++ByteIndex)
+					Bit64 |= static_cast<std::uint64_t>(ByteSubtition(static_cast<std::uint8_t>(Data >> (ByteIndex * 8)))) << (ByteIndex * 8);
+				Data = Bit64;
+			}
 		}
 
-		//Arrays data shuffle(Approximate nonlinear function/diffusion)
-		//数组数据洗牌(近似非线性函数/扩散)
+		//Arrays data shuffle(Approximate nonlinear function/diffusion), Fisher-Yates with unbiased division-free indices
+		//数组数据洗牌(近似非线性函数/扩散), 使用无偏且无除法索引的 Fisher-Yates 洗牌
 		void ShuffleArray(std::span<std::uint64_t> Datas)
 		{
-			for (std::size_t index = 0; index < Datas.size(); ++index)
+			for (std::size_t index = 1; index < Datas.size(); ++index)
 			{
-				std::swap(Datas[index], Datas[PRNG() % Datas.size()]);
+				std::swap(Datas[index], Datas[PseudoRandomNumberGenerators::BoundedRandom(PRNG, index + 1)]);
 			}
 		}
 
 	public:
 
-		std::vector<std::uint64_t> GenerateKeyStream(std::size_t GeneratedSize)
+		//Accumulated time of each pipeline stage, filled in when a StageTimings is passed to GenerateKeyStream
+		//流水线每个阶段的累计耗时
+		struct StageTimings
 		{
-			std::size_t ElementIndex = 0;
-			std::vector<std::uint64_t> KeyStream;
+			std::chrono::nanoseconds Fill {};
+			std::chrono::nanoseconds PseudoHadamard {};
+			std::chrono::nanoseconds Shuffle {};
+			std::chrono::nanoseconds Substitute {};
+		};
+
+		//Number of keystream words produced by one batch (the whole state array)
+		//每一批生成的密钥流字数
+		static constexpr std::size_t BatchSize = std::tuple_size_v<decltype(KeyStreamState)>;
 
-			for(std::size_t GenerateCount = 0; GenerateCount < GeneratedSize; GenerateCount += this->KeyStreamState.size());
+		//Runs one batch: 128 rounds of fill, pseudo-hadamard transform, shuffle, substitute, shuffle over KeyStreamState
+		//运行一批: 对 KeyStreamState 做128轮 填充, 伪哈达玛德变换, 洗牌, 替换, 洗牌
+		void GenerateBatch(StageTimings* Timings = nullptr)
+		{
+			auto RunStage = [Timings](std::chrono::nanoseconds StageTimings::* Stage, auto&& StageFunction)
 			{
-				for (size_t round = 0; round < 128; round++)
+				if (Timings == nullptr)
 				{
-					this->GenerateDataWithPRNG(this->KeyStreamState);
-			
-					//View arrays as a range of memory views.
-					//把数组作为一个内存视图范围看待
-					std::span<std::uint64_t> KeyStreamStateSpan(this->KeyStreamState);
-
-					for(std::size_t OffsetIndex = 0; OffsetIndex < KeyStreamStateSpan.size(); OffsetIndex += 4)
-					{
-						//Gets the view of the sub-memory range.
-						//获取子内存范围的视图
-						std::span<std::uint64_t> KeyStreamStateSubSpan = KeyStreamStateSpan.subspan(OffsetIndex, 4);
-				
-						//Pseudo-hadamard transform (forward)
-						//伪哈达玛德变换(正向)
-						std::uint64_t a = KeyStreamStateSubSpan[0] + KeyStreamStateSubSpan[1];
-						std::uint64_t b = KeyStreamStateSubSpan[0] + 2 * KeyStreamStateSubSpan[1];
-						KeyStreamStateSubSpan[0] = a;
-						KeyStreamStateSubSpan[1] = b;
-
-						//Pseudo-hadamard transform (backward)
-						//伪哈达玛德变换(反向)
-						std::uint64_t c = KeyStreamStateSubSpan[3] - KeyStreamStateSubSpan[2];
-						std::uint64_t d = 2 * KeyStreamStateSubSpan[2] - KeyStreamStateSubSpan[3];
-						KeyStreamStateSubSpan[2] = c;
-						KeyStreamStateSubSpan[3] = d;
-
-						a = b = c = d = 0;
-					}
-			
-					this->ShuffleArray(this->KeyStreamState);
-			
-					for(std::size_t Index = 0; Index < KeyStreamState.size(); ++Index)
-					{
-						std::uint64_t Bit64 = KeyStreamState[Index];
-
-						//Moves 64 bits of data to bits in different locations using bitwise operations. This way the conversion to 8 bits of a byte is truncated to 8 bits of a different 8 part
-						//将64比特的数据用位运算移动到比特不同位置。这样转换到字节的8个比特的时候，会截断到不同的8个部分的8个比特
-						Bit64 = static_cast<std::uint64_t>(ByteSubtition(Bit64 >> 56))
-						| static_cast<std::uint64_t>(ByteSubtition(Bit64 >> 48))
-						| static_cast<std::uint64_t>(ByteSubtition(Bit64 >> 40))
-						| static_cast<std::uint64_t>(ByteSubtition(Bit64 >> 32))
-						| static_cast<std::uint64_t>(ByteSubtition(Bit64 >> 24))
-						| static_cast<std::uint64_t>(ByteSubtition(Bit64 >> 16))
-						| static_cast<std::uint64_t>(ByteSubtition(Bit64 >> 8))
-						| static_cast<std::uint64_t>(ByteSubtition(Bit64));
-
-						 KeyStreamState[Index] = Bit64;
-					}
-			
-					this->ShuffleArray(this->KeyStreamState);
+					StageFunction();
+					return;
 				}
 
-				std::copy(KeyStreamState.begin(), KeyStreamState.end(), std::back_inserter(KeyStream));
+				const auto StartTime = std::chrono::steady_clock::now();
+				StageFunction();
+				Timings->*Stage += std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - StartTime);
+			};
+
+			for (std::size_t round = 0; round < 128; round++)
+			{
+				RunStage(&StageTimings::Fill, [this] { this->GenerateDataWithPRNG(this->KeyStreamState); });
+				RunStage(&StageTimings::PseudoHadamard, [this] { this->PseudoHadamardTransform(this->KeyStreamState); });
+				RunStage(&StageTimings::Shuffle, [this] { this->ShuffleArray(this->KeyStreamState); });
+				RunStage(&StageTimings::Substitute, [this] { this->SubstituteBytes(this->KeyStreamState); });
+				RunStage(&StageTimings::Shuffle, [this] { this->ShuffleArray(this->KeyStreamState); });
 			}
+		}
+
+		//Fills KeyStream with exactly KeyStream.size() words, one batch per BatchSize words
+		//生成恰好 KeyStream.size() 个字, 每 BatchSize 个字运行一批
+		void GenerateKeyStream(std::span<std::uint64_t> KeyStream, StageTimings* Timings = nullptr)
+		{
+			for (std::size_t GenerateCount = 0; GenerateCount < KeyStream.size(); GenerateCount += BatchSize)
+			{
+				this->GenerateBatch(Timings);
 
+				const std::size_t CopySize = std::min(BatchSize, KeyStream.size() - GenerateCount);
+				std::copy_n(KeyStreamState.begin(), CopySize, KeyStream.begin() + GenerateCount);
+			}
+		}
+
+		std::vector<std::uint64_t> GenerateKeyStream(std::size_t GeneratedSize)
+		{
+			std::vector<std::uint64_t> KeyStream(GeneratedSize);
+			this->GenerateKeyStream(KeyStream);
 			return KeyStream;
 		}
 
@@ -152,4 +185,44 @@ namespace StreamDataCryption::AlgorithmSample
 		StreamCipherBasedAES() = delete;
 		~StreamCipherBasedAES() = default;
 	};
+	//Checks the keystream length, that both GenerateKeyStream overloads and StageTimings give the same words, and that a shorter request is a prefix of a longer one
+	//检查密钥流长度, 两个 GenerateKeyStream 重载以及 StageTimings 得到相同的字, 并且较短的请求是较长请求的前缀
+	inline void TestStreamCipherBasedAES()
+	{
+		constexpr std::uint64_t Seed = 0x0123456789ABCDEFULL;
+		constexpr std::size_t LongestSize = 1000;
+
+		bool IsPassed = true;
+
+		StreamCipherBasedAES LongestCipher(Seed);
+		const std::vector<std::uint64_t> LongestKeyStream = LongestCipher.GenerateKeyStream(LongestSize);
+		IsPassed &= LongestKeyStream.size() == LongestSize;
+
+		for (const std::size_t GeneratedSize : { std::size_t(0), std::size_t(1), std::size_t(128), std::size_t(129), LongestSize })
+		{
+			StreamCipherBasedAES VectorCipher(Seed);
+			const std::vector<std::uint64_t> VectorKeyStream = VectorCipher.GenerateKeyStream(GeneratedSize);
+			IsPassed &= VectorKeyStream.size() == GeneratedSize;
+
+			//The span overload must not write past the span, checked with a guard word after it
+			//span 重载不得写到 span 之外, 用其后的保护字检查
+			constexpr std::uint64_t GuardWord = 0xA5A5A5A5A5A5A5A5ULL;
+			std::vector<std::uint64_t> SpanKeyStream(GeneratedSize + 1, GuardWord);
+			StreamCipherBasedAES SpanCipher(Seed);
+			SpanCipher.GenerateKeyStream(std::span<std::uint64_t>(SpanKeyStream.data(), GeneratedSize));
+			IsPassed &= SpanKeyStream.back() == GuardWord;
+			SpanKeyStream.pop_back();
+			IsPassed &= SpanKeyStream == VectorKeyStream;
+
+			std::vector<std::uint64_t> TimedKeyStream(GeneratedSize);
+			StreamCipherBasedAES::StageTimings Timings;
+			StreamCipherBasedAES TimedCipher(Seed);
+			TimedCipher.GenerateKeyStream(TimedKeyStream, &Timings);
+			IsPassed &= TimedKeyStream == VectorKeyStream;
+
+			IsPassed &= std::equal(VectorKeyStream.begin(), VectorKeyStream.end(), LongestKeyStream.begin());
+		}
+
+		std::cout << "StreamCipherBasedAES keystream: " << (IsPassed ? "passed" : "failed") << std::endl;
+	}
 }
\ No newline at end of file
@@ -0,0 +1,65 @@
+#include "../MainProgram/Support+Library/Support-Library.hpp"
+
+//namespace RandomNumberGenerators
+#include "../RandomNumberGenerators/PseudoRandomNumberGenerators.hpp"
+
+//namespace StreamDataCryption
+#include "../StreamDataCryption/ChinaShangYongMiMa/ZUC.hpp"
+#include "../StreamDataCryption/CipherAlgorithmSample.cpp"
+
+//namespace BlockDataCryption
+#include "../BlockDataCryption/BlockDataCryption.hpp"
+
+#include "../MainProgram/Support+Library/TitianWallCiphers.hpp"
+
+/*
+	Runs one of the self-checks that MainProgram keeps commented out, selected by name, so CTest can run each as its own test.
+	The checks report "passed"/"failed" on standard output; CTest matches that text, which also works in release builds where assert is disabled.
+	按名字运行 MainProgram 中被注释掉的某个自检, 使 CTest 能把每个自检作为单独的测试运行。
+	自检在标准输出上报告 "passed"/"failed", 由 CTest 匹配这段文本, 因此在 assert 被禁用的发布构建中也有效。
+*/
+auto main(int argument_cout, char* argument_vector[]) -> int
+{
+	const std::map<std::string_view, void (*)()> SelfTests
+	{
+		{ "ZUC", &ChinaShangYongMiMa::ZUC::TestZUC },
+		{ "StreamCipherBasedAES", &StreamDataCryption::AlgorithmSample::TestStreamCipherBasedAES },
+		{ "TinyEncryptionAlgorithmUnrolled", &BlockDataCryption::TinyEncryptionAlgorithmGroup::TestTinyEncryptionAlgorithmUnrolled },
+		{ "XXTEALargeBuffer", &BlockDataCryption::TinyEncryptionAlgorithmGroup::TestXXTEALargeBuffer },
+		{ "XTEABlocks", &BlockDataCryption::TinyEncryptionAlgorithmGroup::TestXTEABlocks },
+		{ "TitanWallBlockCipherRoundCore", &TestTitanWallBlockCipherRoundCore },
+		{ "TitanWallBlockCipherModes", &TestTitanWallBlockCipherModes },
+		{ "TitanWallBlockKernels", &TestTitanWallBlockKernels },
+		{ "TitanWallStreamCipherStreaming", &TestTitanWallStreamCipherStreaming },
+		{ "TitanWallNLFSR", &TestTitanWallNLFSR },
+		{ "TitanWallMixPass", &TestTitanWallMixPass },
+		{ "TitanWallKeySchedule", &TestTitanWallKeySchedule },
+		{ "BoundedRandom", &PseudoRandomNumberGenerators::TestBoundedRandom },
+		{ "InversiveCongruentialGenerator", &PseudoRandomNumberGenerators::TestInversiveCongruentialGenerator },
+		{ "LinearCongruentialGenerator", &PseudoRandomNumberGenerators::TestLinearCongruentialGenerator },
+		{ "BlumBlumShub", &PseudoRandomNumberGenerators::TestBlumBlumShub },
+		{ "MersenneTwisterBlock", &PseudoRandomNumberGenerators::TestMersenneTwisterBlock },
+		{ "MersenneTwisterJump", &PseudoRandomNumberGenerators::TestMersenneTwisterJump },
+		{ "XorshiroLanes", &PseudoRandomNumberGenerators::TestXorshiroLanes },
+		{ "XorshiroJump", &PseudoRandomNumberGenerators::TestXorshiroJump },
+		{ "XorShiftEngines", &PseudoRandomNumberGenerators::TestXorShiftEngines },
+		{ "LaggedFibonacciBlock", &PseudoRandomNumberGenerators::TestLaggedFibonacciBlock },
+		{ "ComplementaryMultiplyWithCarry4096", &PseudoRandomNumberGenerators::TestComplementaryMultiplyWithCarry4096 },
+		{ "CPU_FeatureOverride", &CommonToolkit::CPU_FeatureDispatch::TestCPU_FeatureOverride },
+	};
+
+	if (argument_cout == 2)
+	{
+		const auto Iterator = SelfTests.find(argument_vector[1]);
+		if (Iterator != SelfTests.end())
+		{
+			Iterator->second();
+			return 0;
+		}
+	}
+
+	std::cerr << "Usage: " << argument_vector[0] << " <test name>, one of:" << std::endl;
+	for (const auto& [Name, Function] : SelfTests)
+		std::cerr << "\t" << Name << std::endl;
+	return 1;
+}
@@ -0,0 +1,69 @@
+# Per instruction set object libraries.
+# 按指令集划分的对象库。
+#
+# SIMD kernels live in their own translation units and are compiled with the flags of one instruction set only,
+# so the rest of a library keeps the baseline flags and still runs on any x86-64 (or non-x86) processor.
+# Which kernel actually runs is decided at run time by the CPU feature dispatch, never by the build machine.
+# SIMD 内核放在单独的翻译单元中, 只用某一个指令集的编译选项编译,
+# 库的其余部分保持基线选项, 仍可在任何 x86-64 (或非 x86) 处理器上运行。实际运行哪个内核由运行时的 CPU 特性分派决定, 而不是由构建机器决定。
+#
+#   target_instruction_set_sources(<target> <SSE2|SSE41|AVX2|AVX512> <source>...)
+#
+# Creates the OBJECT library <target>_<instruction set>, links its objects into <target>,
+# and defines APPLIED_CRYPTOGRAPHY_HAS_<instruction set>_KERNELS on <target> so the dispatch code knows the kernels exist.
+# On processors the instruction set does not belong to, or compilers without the flags, nothing is added.
+# 创建对象库 <target>_<指令集>, 把其目标文件链接进 <target>,
+# 并在 <target> 上定义 APPLIED_CRYPTOGRAPHY_HAS_<指令集>_KERNELS, 让分派代码知道这些内核存在。
+# 若处理器不属于该指令集, 或编译器不支持这些选项, 则什么也不添加。
+
+include_guard(GLOBAL)
+include(CheckCXXCompilerFlag)
+
+if(CMAKE_SYSTEM_PROCESSOR MATCHES "^(x86_64|AMD64|amd64|i[3-6]86|x86)$")
+	set(APPLIED_CRYPTOGRAPHY_X86 ON)
+else()
+	set(APPLIED_CRYPTOGRAPHY_X86 OFF)
+endif()
+
+if(MSVC)
+	set(APPLIED_CRYPTOGRAPHY_FLAGS_SSE2 "")
+	set(APPLIED_CRYPTOGRAPHY_FLAGS_SSE41 "")
+	set(APPLIED_CRYPTOGRAPHY_FLAGS_AVX2 "/arch:AVX2")
+	set(APPLIED_CRYPTOGRAPHY_FLAGS_AVX512 "/arch:AVX512")
+else()
+	set(APPLIED_CRYPTOGRAPHY_FLAGS_SSE2 "-msse2")
+	set(APPLIED_CRYPTOGRAPHY_FLAGS_SSE41 "-msse4.1")
+	set(APPLIED_CRYPTOGRAPHY_FLAGS_AVX2 "-mavx2;-mbmi2")
+	set(APPLIED_CRYPTOGRAPHY_FLAGS_AVX512 "-mavx512f;-mavx512vl;-mavx512bw;-mavx512dq")
+endif()
+
+function(target_instruction_set_sources Target InstructionSet)
+	if(NOT APPLIED_CRYPTOGRAPHY_X86)
+		return()
+	endif()
+	if(NOT DEFINED APPLIED_CRYPTOGRAPHY_FLAGS_${InstructionSet})
+		message(FATAL_ERROR "Unknown instruction set '${InstructionSet}', expected SSE2, SSE41, AVX2 or AVX512")
+	endif()
+
+	set(Flags ${APPLIED_CRYPTOGRAPHY_FLAGS_${InstructionSet}})
+	string(REPLACE ";" " " FlagText "${Flags}")
+	if(FlagText)
+		check_cxx_compiler_flag("${FlagText}" APPLIED_CRYPTOGRAPHY_COMPILER_HAS_${InstructionSet})
+		if(NOT APPLIED_CRYPTOGRAPHY_COMPILER_HAS_${InstructionSet})
+			message(STATUS "${Target}: compiler lacks ${InstructionSet} flags, those kernels are skipped")
+			return()
+		endif()
+	endif()
+
+	set(ObjectLibrary ${Target}_${InstructionSet})
+	add_library(${ObjectLibrary} OBJECT ${ARGN})
+	target_compile_options(${ObjectLibrary} PRIVATE ${Flags})
+	target_compile_features(${ObjectLibrary} PRIVATE cxx_std_20)
+	get_target_property(TargetType ${Target} TYPE)
+	if(NOT TargetType STREQUAL "STATIC_LIBRARY")
+		set_target_properties(${ObjectLibrary} PROPERTIES POSITION_INDEPENDENT_CODE ON)
+	endif()
+
+	target_sources(${Target} PRIVATE $<TARGET_OBJECTS:${ObjectLibrary}>)
+	target_compile_definitions(${Target} PUBLIC APPLIED_CRYPTOGRAPHY_HAS_${InstructionSet}_KERNELS=1)
+endfunction()